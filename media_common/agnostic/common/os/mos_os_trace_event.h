@@ -394,6 +394,7 @@ typedef enum _MEDIA_EVENT
     EVENT_DECODE_DDI_SETGPUPRIORITYVA,             //! event for Decode DDI SetGpuPriority
     EVENT_DECODE_FEATURE_DECODEMODE_REPORTVA,      //! event for Decode Feature Decode Mode Report
     EVENT_DECODE_INFO_PICTUREVA,                   //! event for Decode Picture Info VA
+    EVENT_RESOURCE_LOCK_STALL,                     //! event for CPU lock of GPU busy resource
 } MEDIA_EVENT;
 
 typedef enum _MEDIA_EVENT_TYPE
@@ -27,7 +27,12 @@
 #ifndef __MEDIA_USER_SETTING_CONFIGURE__H__
 #define __MEDIA_USER_SETTING_CONFIGURE__H__
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "media_user_setting_definition.h"
 #include "mos_utilities.h"
 
@@ -134,6 +139,29 @@ public:
         bool isForReport,
         uint32_t option = MEDIA_USER_SETTING_INTERNAL);
 
+    //!
+    //! \brief    Refresh the snapshot of resolved user settings
+    //! \details  The snapshot will be rebuilt on next read, so that changes of
+    //!           registry or environment variables after last build are picked up.
+    //! \return   void
+    //!
+    void RefreshSnapshot()
+    {
+        m_mutexLock.Lock();
+        m_snapshotGeneration++;
+        m_mutexLock.Unlock();
+    }
+
+    //!
+    //! \brief    Check whether reads are served from snapshot
+    //! \return   bool
+    //!           true if snapshot mode is enabled, otherwise false
+    //!
+    bool IsSnapshotEnabled()
+    {
+        return m_snapshotEnabled;
+    }
+
     //!
     //! \brief    Get the report path of the key
     //! \return   std::string
@@ -214,6 +242,51 @@ protected:
 
     const uint32_t GetRegAccessDataType(MOS_USER_FEATURE_VALUE_TYPE type);
 
+    //!
+    //! \brief    Resolve value of specific item from registry and environment variable
+    //! \param    [out] value
+    //!           The resolved value of the item
+    //! \param    [in] itemName
+    //!           Name of the item
+    //! \param    [in] def
+    //!           Definition of the item
+    //! \param    [in] option
+    //!           Internal or external user setting
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if the item is set, otherwise failed reason
+    //!
+    MOS_STATUS ResolveValue(
+        Value &value,
+        const std::string &itemName,
+        std::shared_ptr<Definition> def,
+        uint32_t option);
+
+    //!
+    //! \brief    Resolved value of one item in snapshot
+    //!
+    struct SnapshotItem
+    {
+        MOS_STATUS status    = MOS_STATUS_SUCCESS;  //!< Status of resolving
+        Value      value;                           //!< Resolved value, default value if resolving failed
+        bool       debugOnly = false;               //!< Debug only key in release driver, always default value
+    };
+
+    //!
+    //! \brief    Immutable snapshot of resolved internal user settings
+    //!
+    struct Snapshot
+    {
+        uint32_t                                      generation = 0;  //!< m_snapshotGeneration the snapshot was built from
+        std::unordered_map<std::size_t, SnapshotItem> items[Group::MaxCount];
+    };
+
+    //!
+    //! \brief    Get current snapshot, rebuild it if out of date
+    //! \return   std::shared_ptr<const Snapshot>
+    //!           Current snapshot, nullptr if failed to build
+    //!
+    std::shared_ptr<const Snapshot> GetSnapshot();
+
 protected:
     MosMutex m_mutexLock; //!< mutex for protecting definitions
     Definitions m_definitions[Group::MaxCount]{}; //!< definitions of media user setting
@@ -227,6 +300,12 @@ protected:
     static const std::map<uint32_t, ExtPathCFG> m_pathOption;
     std::string                                 m_statedConfigPath = "";
     std::string                                 m_statedReportPath = "";
+
+    bool                                        m_snapshotEnabled = false;      //!< Serve internal reads from snapshot
+    std::atomic<uint32_t>                       m_snapshotGeneration{1};        //!< Bumped under m_mutexLock when resolved values may change
+    std::shared_ptr<const Snapshot>             m_snapshot = nullptr;           //!< Current snapshot, accessed by std::atomic_load/store
+    std::mutex                                  m_snapshotBuildMutex;           //!< Serializes snapshot rebuilds
+    static const char                          *m_snapshotEnvName;
 };
 }
 }
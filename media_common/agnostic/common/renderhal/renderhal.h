@@ -762,6 +762,8 @@ typedef struct _RENDERHAL_KRN_ALLOCATION
     Kdll_CacheEntry             *pKernelEntry;                                  // Pointer to Kernel entry for VP/KDLL
     RENDERHAL_CLONE_KERNEL_PARAM cloneKernelParams;                             // CM - Clone kernel information
     int32_t                 iAllocIndex;                                        // Kernel allocation index (index in kernel allocation table)
+    int32_t                 iHashNext;                                          // Next kernel allocation in same residency hash bucket, -1 if last
+    uint32_t                dwUseCount;                                         // Number of loads served by this allocation since it was loaded
 
     // DSH - Dynamic list of kernel allocations
     PMHW_STATE_HEAP_MEMORY_BLOCK pMemoryBlock;                                  // Memory block in ISH
@@ -780,6 +782,43 @@ typedef struct _RENDERHAL_KRN_ALLOC_LIST
     int32_t                   iCount;                                           // Number of objects
 } RENDERHAL_KRN_ALLOC_LIST, *PRENDERHAL_KRN_ALLOC_LIST;
 
+//!
+//! \brief  Kernel residency statistics, accumulated between RenderHal resets
+//!
+typedef struct _RENDERHAL_KRN_RESIDENCY_STATS
+{
+    uint32_t            dwLoadHits;                                             // Kernel loads served by a resident kernel
+    uint32_t            dwLoadMisses;                                           // Kernel loads which copied kernel into ISH
+    uint32_t            dwEvictions;                                            // Resident kernels unloaded to make room
+    uint64_t            ui64IshBytesCopied;                                     // Bytes of kernel binary copied into ISH
+} RENDERHAL_KRN_RESIDENCY_STATS, *PRENDERHAL_KRN_RESIDENCY_STATS;
+
+//!
+//! \brief  Surface state cache, encoded surface states reused across frames
+//!         while surface parameters other than address are unchanged
+//!
+#define RENDERHAL_SURFACE_STATE_CACHE_ENTRIES       64                          // Number of cache entries, power of 2
+#define RENDERHAL_SURFACE_STATE_CACHE_MAX_SIZE      64                          // Max encoded surface state size in bytes
+// Key of surface state cache is MHW_SURFACE_STATE_PARAMS from dwCacheabilityControl to L1CacheConfig plus the GMM tile mode
+#define RENDERHAL_SURFACE_STATE_CACHE_KEY_SIZE \
+    (offsetof(MHW_SURFACE_STATE_PARAMS, L1CacheConfig) + sizeof(uint32_t) - offsetof(MHW_SURFACE_STATE_PARAMS, dwCacheabilityControl))
+
+typedef struct _RENDERHAL_SURFACE_STATE_CACHE_ENTRY
+{
+    MHW_SURFACE_STATE_PARAMS    Params;                                         // Surface state parameters, key fields only
+    uint32_t                    dwSize;                                         // Encoded surface state size, 0 if entry is empty
+    uint32_t                    dwCmdOffset;                                    // Offset of address to patch in encoded state
+    uint32_t                    dwLocationInCmd;                                // DW location of address to patch
+    uint8_t                     State[RENDERHAL_SURFACE_STATE_CACHE_MAX_SIZE];  // Encoded surface state without address
+} RENDERHAL_SURFACE_STATE_CACHE_ENTRY, *PRENDERHAL_SURFACE_STATE_CACHE_ENTRY;
+
+typedef struct _RENDERHAL_SURFACE_STATE_CACHE
+{
+    RENDERHAL_SURFACE_STATE_CACHE_ENTRY Entry[RENDERHAL_SURFACE_STATE_CACHE_ENTRIES];
+    uint32_t                    dwHits;                                         // Surface states reused in current frame
+    uint32_t                    dwMisses;                                       // Surface states encoded in current frame
+} RENDERHAL_SURFACE_STATE_CACHE, *PRENDERHAL_SURFACE_STATE_CACHE;
+
 typedef struct _RENDERHAL_MEDIA_STATE *PRENDERHAL_MEDIA_STATE;
 
 typedef struct _RENDERHAL_MEDIA_STATE
@@ -949,6 +988,9 @@ typedef struct _RENDERHAL_STATE_HEAP
     uint8_t                 *pKernelLoadMap;                                     // Kernel load map
     uint32_t                dwAccessCounter;                                    // Incremented when a kernel is loaded/used, for dynamic allocation
     int32_t                 iKernelUsedForDump;                                 // The kernel size to be dumped in oca buffer.
+    int32_t                 *pKernelHashTable;                                   // Kernel residency hash buckets, allocation index of bucket head or -1
+    uint32_t                dwKernelHashMask;                                   // Number of kernel residency hash buckets - 1
+    RENDERHAL_KRN_RESIDENCY_STATS KernelStats;                                  // Kernel residency statistics of current frame
 
     // Kernel Spill Area
     uint32_t                dwScratchSpaceSize;                                 // Size of the Scratch Area
@@ -1269,6 +1311,7 @@ typedef struct _RENDERHAL_INTERFACE
 #endif
 
     MediaPerfProfiler           *pPerfProfiler = nullptr; //!< Performance data profiler
+    PRENDERHAL_SURFACE_STATE_CACHE pSurfaceStateCache = nullptr; //!< Encoded surface state cache
     bool                        eufusionBypass = false;
     MediaUserSettingSharedPtr   userSettingPtr = nullptr; //!< Shared pointer to User Setting instance
     //---------------------------
@@ -1772,6 +1815,23 @@ void RenderHal_GetPixelsPerSample(
     MOS_FORMAT                  format,
     uint32_t                    *pdwPixelsPerSampleUV);
 
+//!
+//! \brief    Set Surface State Entry
+//! \details  Encode surface state through MHW, or copy the state encoded for
+//!           identical parameters from surface state cache. Surface address
+//!           is not part of the encoded state, it is patched on submission.
+//!           CM does not use it, CmSurfaceStateManager keeps encoded states
+//!           per surface and parameter set already.
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to Hardware Interface Structure
+//! \param    PMHW_SURFACE_STATE_PARAMS pParams
+//!           [in/out] Pointer to MHW surface state parameters
+//! \return   MOS_STATUS
+//!
+MOS_STATUS RenderHal_SetSurfaceStateEntry(
+    PRENDERHAL_INTERFACE        pRenderHal,
+    PMHW_SURFACE_STATE_PARAMS   pParams);
+
 //!
 //! \brief    Set Surface for HW Access
 //! \details  Common Function for setting up surface state
@@ -78,6 +78,8 @@
 
 #define DL_CSC_DISABLED -1  // CSC is disabled
 
+#define DL_CSC_COEFF_CACHE_SIZE 16  // CSC coefficient cache entries per Kdll_State
+
 #define DL_CSC_MAX_G5 2  // 2 CSC matrices max for Gen5
 
 #define DL_CHROMASITING_DISABLE -1  // Chromasiting is disabled
@@ -547,6 +549,29 @@ typedef struct tagKdll_CSC_Matrix
                                    //                   [V'/B']   [8  9 10]   [V/B]   [11]
 } Kdll_CSC_Matrix;
 
+// Structure that defines a cached CSC+PA coefficient set
+typedef struct tagKdll_CscCoeffCacheEntry
+{
+    bool         bValid;        // Entry is valid
+    bool         bProcamp;      // Procamp was applied to the coefficients
+    VPHAL_CSPACE SrcSpace;      // Source Color Space
+    VPHAL_CSPACE DstSpace;      // Destination Color Space
+    float        fBrightness;   // Procamp parameters the coefficients were computed with
+    float        fContrast;
+    float        fHue;
+    float        fSaturation;
+    short        Coeff[12];     // Kernel CSC coefficients (same layout as Kdll_CSC_Matrix)
+} Kdll_CscCoeffCacheEntry;
+
+// Structure that defines the CSC+PA coefficient cache
+typedef struct tagKdll_CscCoeffCache
+{
+    Kdll_CscCoeffCacheEntry Entry[DL_CSC_COEFF_CACHE_SIZE];  // Cached coefficient sets
+    uint32_t                uiNext;                          // Next entry to replace (round robin)
+    uint32_t                uiHits;                          // Cache hits (statistics)
+    uint32_t                uiMisses;                        // Cache misses (statistics)
+} Kdll_CscCoeffCache;
+
 // Structure that defines a full set of CSC or CSC+PA parameters to be used by a combined kernel
 typedef struct tagKdll_CSC_Params
 {
@@ -726,6 +751,9 @@ typedef struct tagKdll_State
     Kdll_Procamp *pProcamp;      // Array of Procamp parameters
     int32_t       iProcampSize;  // Size of the array of Procamp parameters
 
+    // CSC+PA coefficients already computed, keyed by (src, dst, procamp)
+    Kdll_CscCoeffCache CscCoeffCache;
+
     // Colorfill
     VPHAL_CSPACE colorfill_cspace;  // Selected colorfill Color Space by Kdll
 
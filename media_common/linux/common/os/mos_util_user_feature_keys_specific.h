@@ -40,5 +40,8 @@
 #define __MEDIA_USER_FEATURE_VALUE_ENABLE_SOFTPIN       "Enable Softpin"
 #define __MEDIA_USER_FEATURE_VALUE_DISABLE_KMD_WATCHDOG "Disable KMD Watchdog"
 #define __MEDIA_USER_FEATURE_VALUE_ENABLE_VM_BIND       "Enable VM Bind"
+#define __MEDIA_USER_FEATURE_VALUE_ENABLE_LOCK_STALL_PROFILER "Enable Lock Stall Profiler"
+#define __MEDIA_USER_FEATURE_VALUE_LOCK_STALL_PROFILER_OUTPUT_FILE_NAME "Lock Stall Profiler Output File Name"
+#define __MEDIA_USER_FEATURE_VALUE_DEVICE_PROBE_CACHE_PATH "Device Probe Cache Path"
 
 #endif // __MOS_UTIL_USER_FEATURE_KEYS_SPECIFIC_H__
@@ -1439,6 +1439,8 @@ MOS_STATUS CmSurfaceState2Dor3D::UpdateSurfaceState()
                 }
             }
         }
+        // Not through the RenderHal surface state cache: the state is kept in m_cmds and
+        // reused by CmSurfaceStateManager until the surface parameters change.
         m_renderhal->pMhwStateHeap->SetSurfaceStateEntry(&SurfStateParams);
     }
 
@@ -1490,6 +1492,7 @@ MOS_STATUS CmSurfaceStateBuffer::GenerateSurfaceState(CM_HAL_BUFFER_SURFACE_STAT
     // Default tile mode of surface state buffer is linear
     params.bGMMTileEnabled = true;
 
+    // Kept in m_cmds like the 2D/3D states, so not through the RenderHal surface state cache
     m_renderhal->pMhwStateHeap->SetSurfaceStateEntry(&params);
 
     return MOS_STATUS_SUCCESS;
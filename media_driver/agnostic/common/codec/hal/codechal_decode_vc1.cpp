@@ -303,6 +303,69 @@ static const uint32_t CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[] =
     (uint32_t)-1
 };
 
+static const uint32_t CODECHAL_DECODE_VC1_VldNorm2PairTable[] =
+{
+    3, /* max bits */
+    1, /* 1-bit codes */
+    0, 0,
+    1, /* 2-bit codes */
+    3, 3,
+    2, /* 3-bit codes */
+    4, 2,
+    5, 1,
+    (uint32_t)-1
+};
+
+//!
+//! \struct  CodechalDecodeVc1CodeLengthLut
+//! \brief   Direct code length lookup of a VLC table, indexed by the next maxBits of bitstream,
+//!          plus the run of complete codes found in each byte
+//!
+template <uint32_t maxBits>
+struct CodechalDecodeVc1CodeLengthLut
+{
+    explicit CodechalDecodeVc1CodeLengthLut(const uint32_t *table)
+    {
+        MOS_ZeroMemory(length, sizeof(length));
+        CODECHAL_DECODE_ASSERT(table[0] == maxBits);
+
+        uint32_t index = 1;
+        for (uint32_t codeLength = 1; codeLength <= maxBits; codeLength++)
+        {
+            uint32_t subtableSize = table[index++];
+            while (subtableSize--)
+            {
+                uint32_t first = table[index] << (maxBits - codeLength);
+                for (uint32_t i = 0; i < (1u << (maxBits - codeLength)); i++)
+                {
+                    length[first + i] = (uint8_t)codeLength;
+                }
+                index += 2;
+            }
+        }
+
+        for (uint32_t byte = 0; byte < 256; byte++)
+        {
+            uint32_t count = 0, bits = 0;
+            while (bits < 8)
+            {
+                // zero padded past the byte, so a code only counts if it ends inside the byte
+                uint32_t next = (((byte << bits) & 0xFF) << 8) >> (16 - maxBits);
+                if (length[next] == 0 || length[next] > 8 - bits)
+                {
+                    break;
+                }
+                bits += length[next];
+                count++;
+            }
+            run[byte] = (uint16_t)((count << 8) | bits);
+        }
+    }
+
+    uint8_t  length[1 << maxBits];  //!< code length, 0 if the prefix is not a valid code
+    uint16_t run[256];              //!< number of complete codes in a byte << 8 | their total bits
+};
+
 static const uint32_t CODECHAL_DECODE_VC1_VldPictureTypeTable[] =
 {
     4,  /* max bits */
@@ -1731,7 +1794,7 @@ MOS_STATUS CodechalDecodeVc1::InitialiseBitstream(
 
 MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+    static const CodechalDecodeVc1CodeLengthLut<3> norm2Lut(CODECHAL_DECODE_VC1_VldNorm2PairTable);
 
     uint16_t frameFieldHeightInMb;
     CodecHal_GetFrameFieldHeightInMb(
@@ -1743,32 +1806,38 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
     uint32_t count = frameFieldWidthInMb * frameFieldHeightInMb;
 
     uint32_t value = 0;
-    if ((frameFieldWidthInMb * frameFieldHeightInMb) & 1)
+    if (count & 1)
     {
         CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
 
         count--;
     }
 
-    for (uint32_t i = 0; i < count / 2; i++)
+    uint32_t pairNum = count / 2;
+    while (pairNum > 0)
     {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-        if (value)
+        CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBitplaneSymbols(pairNum, norm2Lut.length, norm2Lut.run, 3));
+        if (pairNum > 0)
         {
             CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-            if (value == 0)
+            if (value)
             {
                 CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
+                if (value == 0)
+                {
+                    CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
+                }
             }
+            pairNum--;
         }
     }
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+    static const CodechalDecodeVc1CodeLengthLut<13> tileLut(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable);
 
     uint16_t frameFieldHeightInMb;
     CodecHal_GetFrameFieldHeightInMb(
@@ -1781,72 +1850,42 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
 
     uint32_t heightInTiles = 0, widthInTiles = 0;
     uint32_t residualX = 0, residualY = 0;
-    uint32_t value = 0;
     if (is2x3Tiled)
     {
-        widthInTiles = frameFieldWidthInMb / 2;
+        widthInTiles  = frameFieldWidthInMb / 2;
         heightInTiles = frameFieldHeightInMb / 3;
-
-        for (uint32_t j = 0; j < heightInTiles; j++)
-        {
-            for (uint32_t i = 0; i < widthInTiles; i++)
-            {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
-            }
-        }
-
-        residualX = frameFieldWidthInMb & 1;
-        residualY = 0;
+        residualX     = frameFieldWidthInMb & 1;
+        residualY     = 0;
     }
     else // 3x2 tiles
     {
-        widthInTiles = frameFieldWidthInMb / 3;
+        widthInTiles  = frameFieldWidthInMb / 3;
         heightInTiles = frameFieldHeightInMb / 2;
-
-        for (uint32_t j = 0; j < heightInTiles; j++)
-        {
-            for (uint32_t i = 0; i < widthInTiles; i++)
-            {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
-            }
-        }
-
-        residualX = frameFieldWidthInMb % 3;
-        residualY = frameFieldHeightInMb & 1;
+        residualX     = frameFieldWidthInMb % 3;
+        residualY     = frameFieldHeightInMb & 1;
     }
 
-    // ResidualY 0 or 1 or 2
-    for (uint32_t i = 0; i < residualX; i++)
+    uint32_t tileNum = widthInTiles * heightInTiles;
+    uint32_t value   = 0;
+    while (tileNum > 0)
     {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(CODECHAL_DECODE_VC1_BITS_BITPLANE_COLSKIP, value));
-
-        if (value)
+        CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBitplaneSymbols(tileNum, tileLut.length, tileLut.run, 13));
+        if (tileNum > 0)
         {
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipWords(frameFieldHeightInMb >> 4, value));
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(frameFieldHeightInMb & 0xF, value));
+            CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
+            tileNum--;
         }
     }
 
-    // ResidualY 0 or 1
-    for (uint32_t j = 0; j < residualY; j++)
-    {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(CODECHAL_DECODE_VC1_BITS_BITPLANE_ROWSKIP, value));
+    // ResidualX 0 or 1 or 2, coded as colskip
+    CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBitplaneLines(residualX, frameFieldHeightInMb));
 
-        if (value)
-        {
-            uint32_t skipBits = frameFieldWidthInMb - residualX;
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipWords(skipBits >> 4, value));
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(skipBits & 0xF, value));
-        }
-    }
-
-    return eStatus;
+    // ResidualY 0 or 1, coded as rowskip
+    return SkipBitplaneLines(residualY, frameFieldWidthInMb - residualX);
 }
 
 MOS_STATUS CodechalDecodeVc1::BitplaneRowskipMode()
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-
     uint16_t frameFieldHeightInMb;
     CodecHal_GetFrameFieldHeightInMb(
         m_vc1PicParams->CurrPic,
@@ -1854,25 +1893,11 @@ MOS_STATUS CodechalDecodeVc1::BitplaneRowskipMode()
         frameFieldHeightInMb);
     uint16_t frameFieldWidthInMb = m_picWidthInMb;
 
-    uint32_t value = 0;
-    for (uint32_t j = 0; j < frameFieldHeightInMb; j++)
-    {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(CODECHAL_DECODE_VC1_BITS_BITPLANE_ROWSKIP, value));
-
-        if (value)
-        {
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipWords(frameFieldWidthInMb >> 4, value));
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(frameFieldWidthInMb & 0xF, value));
-        }
-    }
-
-    return eStatus;
+    return SkipBitplaneLines(frameFieldHeightInMb, frameFieldWidthInMb);
 }
 
 MOS_STATUS CodechalDecodeVc1::BitplaneColskipMode()
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-
     uint16_t meFieldHeightInMb;
     CodecHal_GetFrameFieldHeightInMb(
         m_vc1PicParams->CurrPic,
@@ -1880,21 +1905,102 @@ MOS_STATUS CodechalDecodeVc1::BitplaneColskipMode()
         meFieldHeightInMb);
     uint16_t frameFieldWidthInMb = m_picWidthInMb;
 
+    return SkipBitplaneLines(frameFieldWidthInMb, meFieldHeightInMb);
+}
+
+uint32_t CodechalDecodeVc1::GetBitsLeftInCache()
+{
+    uint32_t *dataEnd   = m_bitstream.pu32CacheDataEnd;
+    int32_t   offsetEnd = m_bitstream.iBitOffsetEnd;
+
+    // A read starting in the last uint32_t refills the cache, only count the bits before it
+    if (m_bitstream.pu32Cache < m_bitstream.pu32CacheEnd && dataEnd == m_bitstream.pu32CacheEnd)
+    {
+        dataEnd   = m_bitstream.pu32CacheEnd - 1;
+        offsetEnd = 0;
+    }
+
+    int32_t bitsLeft = (int32_t)(dataEnd - m_bitstream.pu32Cache) * 32 +
+                       m_bitstream.iBitOffset - offsetEnd;
+
+    return bitsLeft > 0 ? (uint32_t)bitsLeft : 0;
+}
+
+MOS_STATUS CodechalDecodeVc1::SkipBitplaneSymbols(
+    uint32_t       &symbolNum,
+    const uint8_t  *codeLength,
+    const uint16_t *codeRun,
+    uint32_t        maxCodeLength)
+{
+    CODECHAL_DECODE_CHK_NULL_RETURN(codeLength);
+    CODECHAL_DECODE_CHK_NULL_RETURN(codeRun);
+    CODECHAL_DECODE_ASSERT(maxCodeLength > 0 && maxCodeLength <= 16);
+
+    while (symbolNum > 0)
+    {
+        // The window must not cover a refill, nor the end of data where each read checks end of stream
+        uint32_t windowBits = MOS_MIN(GetBitsLeftInCache(), 16);
+        if (windowBits < maxCodeLength)
+        {
+            break;
+        }
+
+        uint32_t window   = PeekBits(windowBits) << (16 - windowBits);
+        uint32_t consumed = 0;
+
+        while (symbolNum > 0)
+        {
+            uint32_t bits = (window << consumed) & 0xFFFF;
+
+            // Take all complete codes of the next byte at once while it is inside the window
+            uint32_t run = codeRun[bits >> 8];
+            if (consumed + 8 <= windowBits && (run >> 8) != 0 && (run >> 8) <= symbolNum)
+            {
+                consumed += run & 0xFF;
+                symbolNum -= run >> 8;
+                continue;
+            }
+
+            // Bits past the window are zero padded, so a code is only taken if it ends inside the window
+            uint32_t length = codeLength[bits >> (16 - maxCodeLength)];
+            if (length == 0 || length > windowBits - consumed)
+            {
+                break;
+            }
+            consumed += length;
+            symbolNum--;
+        }
+
+        if (consumed == 0)
+        {
+            CODECHAL_DECODE_ASSERTMESSAGE("Code is not in VLC table.");
+            return MOS_STATUS_UNKNOWN;
+        }
+
+        uint32_t value = 0;
+        CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(consumed, value));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS CodechalDecodeVc1::SkipBitplaneLines(
+    uint32_t lineNum,
+    uint32_t lineBits)
+{
     uint32_t value = 0;
-    uint32_t colSkip = 0;
-    for (uint32_t i = 0; i < frameFieldWidthInMb; i++)
+    for (uint32_t i = 0; i < lineNum; i++)
     {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(CODECHAL_DECODE_VC1_BITS_BITPLANE_COLSKIP, value));
-        colSkip = value;
+        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
 
         if (value)
         {
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipWords(meFieldHeightInMb >> 4, value));
-            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(meFieldHeightInMb & 0xF, value));
+            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipWords(lineBits >> 4, value));
+            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(lineBits & 0xF, value));
         }
     }
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS CodechalDecodeVc1::ParseVopDquant()
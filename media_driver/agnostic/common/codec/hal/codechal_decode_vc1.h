@@ -867,6 +867,52 @@ private:
     //!
     uint32_t SkipBits(uint32_t bitsRead);
 
+    //!
+    //! \brief    Get number of valid bits which can be read from the cache before a refill
+    //! \details  Counts up to the end of data or to the last uint32_t of the cache, as a read
+    //!           starting there refills the cache
+    //! \return   uint32_t
+    //!           Number of bits left
+    //!
+    uint32_t GetBitsLeftInCache();
+
+    //!
+    //! \brief    Skip a run of VLC coded bitplane symbols
+    //! \details  Decodes code lengths from 16-bit windows with direct lookup tables
+    //!           and consumes each window with a single skip. Windows end before a refill
+    //!           or the end of data. Stops when fewer than maxCodeLength bits are left, the
+    //!           caller reads the next symbol as before so both are handled at the same position
+    //! \param    [in, out] symbolNum
+    //!           Number of symbols to be skipped, updated with the symbols left
+    //! \param    [in] codeLength
+    //!           Code length lookup indexed by the next maxCodeLength bits, 0 for invalid codes
+    //! \param    [in] codeRun
+    //!           Complete codes in a byte, indexed by the byte, as count << 8 | total bits
+    //! \param    [in] maxCodeLength
+    //!           Max code length of the VLC table, no more than 16
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SkipBitplaneSymbols(
+        uint32_t       &symbolNum,
+        const uint8_t  *codeLength,
+        const uint16_t *codeRun,
+        uint32_t        maxCodeLength);
+
+    //!
+    //! \brief    Skip bitplane rows or columns coded with a skip flag
+    //! \details  Each line is a 1-bit flag followed by lineBits raw bits if the flag is set
+    //! \param    [in] lineNum
+    //!           Number of lines
+    //! \param    [in] lineBits
+    //!           Number of raw bits of a coded line
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SkipBitplaneLines(
+        uint32_t lineNum,
+        uint32_t lineBits);
+
     //!
     //! \brief    Pack Chroma/Luma Motion Vectors for Interlaced frame
     //! \param    [in] fieldSelect
@@ -304,7 +304,7 @@ MOS_STATUS XRenderHal_Interface_g11::SetupSurfaceState (
         }
 
         // Call MHW to setup the Surface State Heap entry
-        MHW_RENDERHAL_CHK_STATUS(pRenderHal->pMhwStateHeap->SetSurfaceStateEntry(&SurfStateParams));
+        MHW_RENDERHAL_CHK_STATUS(RenderHal_SetSurfaceStateEntry(pRenderHal, &SurfStateParams));
 
         // Setup OS specific states
         MHW_RENDERHAL_CHK_STATUS(pRenderHal->pfnSetupSurfaceStatesOs(pRenderHal, pParams, pSurfaceEntry));
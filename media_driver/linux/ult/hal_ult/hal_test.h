@@ -0,0 +1,93 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test.h
+//! \brief    Common helpers of the HAL unit tests.
+//! \details  The HAL unit tests link the static driver library and call HAL code
+//!           directly, without a driver .so, GPU or KMD. Correctness tests run by
+//!           default. Perf tests are disabled by default, run them with
+//!           halult --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_Perf*
+//!           HAL_ULT_PERF_LOOPS overrides the number of timed iterations.
+//!
+#ifndef __HAL_TEST_H__
+#define __HAL_TEST_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <functional>
+#include "gtest/gtest.h"
+
+//!
+//! \brief  Get number of timed iterations of a perf test
+//! \param  [in] defaultLoops
+//!         Iterations when HAL_ULT_PERF_LOOPS is not set
+//! \return uint32_t
+//!
+inline uint32_t HalTestPerfLoops(uint32_t defaultLoops)
+{
+    const char *env = getenv("HAL_ULT_PERF_LOOPS");
+    if (env && atoi(env) > 0)
+    {
+        return (uint32_t)atoi(env);
+    }
+    return defaultLoops;
+}
+
+//!
+//! \brief  Time a function and print its cost per call
+//! \details One tenth of the loops is run first as warm up and not counted.
+//! \param  [in] name
+//!         Name printed with the result
+//! \param  [in] loops
+//!         Timed iterations
+//! \param  [in] func
+//!         Function to time, returns false on failure
+//! \return bool
+//!         true if every call of func succeeded
+//!
+inline bool HalTestMeasure(const char *name, uint32_t loops, const std::function<bool()> &func)
+{
+    for (uint32_t i = 0; i < loops / 10 + 1; i++)
+    {
+        if (!func())
+        {
+            return false;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++)
+    {
+        if (!func())
+        {
+            return false;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    printf("%-48s %12.1f ns/call (%u calls)\n", name, ns / loops, loops);
+    return true;
+}
+
+#endif  // __HAL_TEST_H__
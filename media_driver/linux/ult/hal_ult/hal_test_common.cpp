@@ -0,0 +1,66 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_common.cpp
+//! \brief    Unit tests of the common HAL unit test helpers.
+//! \details  Checks the perf loop override and the measure helper every perf test
+//!           relies on, so halult has a case that builds and runs on any platform.
+//!
+#include "hal_test.h"
+
+TEST(HalTestCommon, PerfLoopsDefault)
+{
+    unsetenv("HAL_ULT_PERF_LOOPS");
+    EXPECT_EQ(1000u, HalTestPerfLoops(1000));
+}
+
+TEST(HalTestCommon, PerfLoopsOverride)
+{
+    setenv("HAL_ULT_PERF_LOOPS", "25", 1);
+    EXPECT_EQ(25u, HalTestPerfLoops(1000));
+
+    // Invalid values keep the default
+    setenv("HAL_ULT_PERF_LOOPS", "0", 1);
+    EXPECT_EQ(1000u, HalTestPerfLoops(1000));
+    setenv("HAL_ULT_PERF_LOOPS", "abc", 1);
+    EXPECT_EQ(1000u, HalTestPerfLoops(1000));
+    unsetenv("HAL_ULT_PERF_LOOPS");
+}
+
+TEST(HalTestCommon, MeasureRunsWarmUpAndTimedLoops)
+{
+    uint32_t calls = 0;
+    EXPECT_TRUE(HalTestMeasure("common.COUNT", 100, [&]() {
+        calls++;
+        return true;
+    }));
+    EXPECT_EQ(100u + 100u / 10 + 1, calls);
+}
+
+TEST(HalTestCommon, MeasureStopsOnFailure)
+{
+    uint32_t calls = 0;
+    EXPECT_FALSE(HalTestMeasure("common.FAIL", 100, [&]() {
+        return ++calls < 20;
+    }));
+    EXPECT_EQ(20u, calls);
+}
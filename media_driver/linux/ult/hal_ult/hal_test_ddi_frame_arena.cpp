@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_ddi_frame_arena.cpp
+//! \brief    Unit tests of the DDI codec frame arena.
+//! \details  The decode DDI places slice data created before BeginPicture in the
+//!           arena and reads it back at EndPicture, so storage must stay intact
+//!           across any number of allocations and block spills until Reset().
+//!
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "hal_test.h"
+#include "ddi_codec_frame_arena_specific.h"
+
+using namespace std;
+using namespace codec;
+
+class DdiFrameArenaTest : public testing::Test
+{
+protected:
+    virtual void SetUp() { }
+
+    virtual void TearDown() { }
+
+    //! \brief  Allocate one buffer per size and fill each with its own value
+    void AllocFrame(const vector<size_t> &sizes)
+    {
+        m_buffers.clear();
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            uint8_t *data = (uint8_t *)m_arena.Alloc(sizes[i]);
+            ASSERT_NE(nullptr, data);
+            EXPECT_EQ(0u, (uintptr_t)data % DdiCodecFrameArena::m_alignment);
+            for (size_t j = 0; j < sizes[i]; j++)
+            {
+                ASSERT_EQ(0, data[j]) << "allocation " << i << " byte " << j;
+            }
+            m_fill = (uint8_t)(m_fill % 255 + 1);
+            memset(data, m_fill, sizes[i]);
+            m_buffers.push_back({data, sizes[i], m_fill});
+        }
+    }
+
+    void ExpectFrameIntact()
+    {
+        for (size_t i = 0; i < m_buffers.size(); i++)
+        {
+            for (size_t j = 0; j < m_buffers[i].size; j++)
+            {
+                ASSERT_EQ(m_buffers[i].value, m_buffers[i].data[j]) << "allocation " << i << " byte " << j;
+            }
+        }
+    }
+
+    struct Buffer
+    {
+        uint8_t *data;
+        size_t   size;
+        uint8_t  value;  //!< Fill value, unique among recent buffers
+    };
+
+    DdiCodecFrameArena m_arena;
+    vector<Buffer>     m_buffers;
+    uint8_t            m_fill = 0;
+};
+
+TEST_F(DdiFrameArenaTest, StorageSurvivesSpillsUntilReset)
+{
+    // Slice copies larger than the first block force several spills in one frame
+    vector<size_t> sizes;
+    for (size_t i = 0; i < 24; i++)
+    {
+        sizes.push_back(1 + i * 9973);
+    }
+    AllocFrame(sizes);
+    ExpectFrameIntact();
+    EXPECT_EQ(sizes.size(), m_arena.GetFrameAllocCount());
+    EXPECT_LT(1u, m_arena.GetFrameHeapAllocCount());
+
+    // After Reset the blocks are merged, so the same frame needs no heap block
+    m_arena.Reset();
+    EXPECT_EQ(0u, m_arena.GetFrameAllocCount());
+    uint32_t heapAllocs = m_arena.GetHeapAllocCount();
+
+    AllocFrame(sizes);
+    ExpectFrameIntact();
+    EXPECT_EQ(0u, m_arena.GetFrameHeapAllocCount());
+    EXPECT_EQ(heapAllocs, m_arena.GetHeapAllocCount());
+}
+
+TEST_F(DdiFrameArenaTest, RecycledStorageIsZeroed)
+{
+    AllocFrame({100, 1000, 0, 17});
+    m_arena.Reset();
+    AllocFrame({17, 0, 1000, 100});
+    ExpectFrameIntact();
+}
+
+TEST_F(DdiFrameArenaTest, FrameWithoutResetKeepsGrowing)
+{
+    // A frame which failed before EndPicture is not reset, its storage and
+    // that of the next frame are recycled together at the next EndPicture
+    AllocFrame({60 * 1024, 60 * 1024});
+    vector<Buffer> failedFrame = m_buffers;
+    AllocFrame({60 * 1024, 60 * 1024});
+    ExpectFrameIntact();
+    m_buffers = failedFrame;
+    ExpectFrameIntact();
+
+    m_arena.Reset();
+    AllocFrame({60 * 1024, 60 * 1024, 60 * 1024, 60 * 1024});
+    EXPECT_EQ(0u, m_arena.GetFrameHeapAllocCount());
+}
+
+TEST_F(DdiFrameArenaTest, AppendedAppDataStaysOffHeapInSteadyState)
+{
+    // JPEG encode appends each packed header to the app data of the frame by
+    // copying it to a new arena allocation, AVC encode adds a delta QP list
+    const uint32_t headerSizes[] = {18, 4096, 65535};
+    for (uint32_t frame = 0; frame < 4; frame++)
+    {
+        uint8_t *appData     = nullptr;
+        uint32_t appDataSize = 0;
+        for (uint32_t size : headerSizes)
+        {
+            uint8_t *newData = (uint8_t *)m_arena.Alloc(appDataSize + size);
+            ASSERT_NE(nullptr, newData);
+            if (appDataSize > 0)
+            {
+                memcpy(newData, appData, appDataSize);
+            }
+            memset(newData + appDataSize, (uint8_t)(size + frame), size);
+            appData      = newData;
+            appDataSize += size;
+        }
+        uint8_t *deltaQp = (uint8_t *)m_arena.Alloc(4);
+        ASSERT_NE(nullptr, deltaQp);
+
+        uint32_t offset = 0;
+        for (uint32_t size : headerSizes)
+        {
+            for (uint32_t j = 0; j < size; j++)
+            {
+                ASSERT_EQ((uint8_t)(size + frame), appData[offset + j]) << "frame " << frame;
+            }
+            offset += size;
+        }
+        if (frame > 0)
+        {
+            EXPECT_EQ(0u, m_arena.GetFrameHeapAllocCount()) << "frame " << frame;
+        }
+        m_arena.Reset();
+    }
+}
@@ -0,0 +1,547 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_decode_vp8_entropy.cpp
+//! \brief    Unit tests of the VP8 frame head parser.
+//! \details  Frames are written with a VP8 boolean encoder and parsed by
+//!           Vp8EntropyState. The golden values were produced by the parser
+//!           before the byte loop refill was replaced with a word refill, so any
+//!           change in the parsed entropy state, partition offsets or
+//!           probabilities is caught.
+//!
+#include <stdint.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include "hal_test.h"
+#include "decode_vp8_entropy_state.h"
+
+using namespace std;
+using namespace decode;
+
+static const uint32_t HAL_TEST_VP8_STREAMS = 6;
+static const uint32_t HAL_TEST_VP8_FRAMES  = 8;
+
+//! \brief  Coefficient probability update rate of each stream
+static const uint32_t Vp8TestUpdateRates[HAL_TEST_VP8_STREAMS] = {0, 4, 32, 128, 256, 16};
+
+//!
+//! \brief  VP8 boolean entropy encoder of RFC 6386 section 7.3
+//!
+class Vp8TestBoolEncoder
+{
+public:
+    void Write(uint8_t prob, uint32_t bit)
+    {
+        uint32_t split = 1 + (((m_range - 1) * prob) >> 8);
+        if (bit)
+        {
+            m_bottom += split;
+            m_range -= split;
+        }
+        else
+        {
+            m_range = split;
+        }
+
+        while (m_range < 128)
+        {
+            m_range <<= 1;
+            if (m_bottom & (1u << 31))
+            {
+                AddOne();
+            }
+            m_bottom <<= 1;
+            if (!--m_bitCount)
+            {
+                m_data.push_back((uint8_t)(m_bottom >> 24));
+                m_bottom &= (1 << 24) - 1;
+                m_bitCount = 8;
+            }
+        }
+    }
+
+    void WriteValue(uint32_t value, uint32_t bits)
+    {
+        while (bits--)
+        {
+            Write(128, (value >> bits) & 1);
+        }
+    }
+
+    void WriteSigned(int32_t value, uint32_t bits)
+    {
+        WriteValue(value < 0 ? -value : value, bits);
+        Write(128, value < 0);
+    }
+
+    vector<uint8_t> &Flush()
+    {
+        int32_t  c = m_bitCount;
+        uint32_t v = m_bottom;
+        if (v & (1u << (32 - c)))
+        {
+            AddOne();
+        }
+        v <<= c & 7;
+        c >>= 3;
+        while (--c >= 0)
+        {
+            v <<= 8;
+        }
+        for (c = 0; c < 4; c++)
+        {
+            m_data.push_back((uint8_t)(v >> 24));
+            v <<= 8;
+        }
+        return m_data;
+    }
+
+private:
+    void AddOne()
+    {
+        size_t i = m_data.size();
+        while (i > 0 && m_data[i - 1] == 255)
+        {
+            m_data[--i] = 0;
+        }
+        if (i > 0)
+        {
+            m_data[i - 1]++;
+        }
+    }
+
+    vector<uint8_t> m_data;
+    uint32_t        m_range    = 255;
+    uint32_t        m_bottom   = 0;
+    int32_t         m_bitCount = 24;
+};
+
+static int32_t RandomSigned(mt19937 &rng, uint32_t bits)
+{
+    int32_t magnitude = (int32_t)(rng() % (1 << bits));
+    return (rng() & 1) ? -magnitude : magnitude;
+}
+
+//!
+//! \brief  Write one VP8 frame with a random but valid frame header
+//! \details The syntax follows RFC 6386 section 19.2. updateRate is the
+//!          chance in 256 that a coefficient probability is updated.
+//! \param  [in] rng          source of the header fields
+//! \param  [in] keyFrame     write a key frame
+//! \param  [in] updateRate   coefficient probability update rate
+//! \param  [out] frame       uncompressed data chunk, partitions and partition sizes
+//! \param  [out] firstPartitionSize  size of the first partition
+//!
+static void WriteVp8Frame(mt19937 &rng, bool keyFrame, uint32_t updateRate, vector<uint8_t> &frame, uint32_t &firstPartitionSize)
+{
+    Vp8TestBoolEncoder bc;
+    auto flag = [&](uint32_t chance) { uint32_t bit = rng() % 256 < chance; bc.Write(128, bit); return bit; };
+
+    if (keyFrame)
+    {
+        bc.WriteValue(rng() & 1, 1);  // Color space
+        bc.WriteValue(rng() & 1, 1);  // Clamping type
+    }
+
+    if (flag(128))  // Segmentation enabled
+    {
+        uint32_t updateMap  = flag(128);
+        uint32_t updateData = flag(128);
+        if (updateData)
+        {
+            flag(128);  // Abs delta
+            for (uint32_t i = 0; i < VP8_MB_LVL_MAX; i++)
+            {
+                for (uint32_t j = 0; j < VP8_MAX_MB_SEGMENTS; j++)
+                {
+                    if (flag(160))
+                    {
+                        bc.WriteSigned(RandomSigned(rng, MbFeatureDataBits[i]), MbFeatureDataBits[i]);
+                    }
+                }
+            }
+        }
+        if (updateMap)
+        {
+            for (uint32_t i = 0; i < VP8_MB_SEGMENT_TREE_PROBS; i++)
+            {
+                if (flag(160))
+                {
+                    bc.WriteValue(rng() % 256, 8);
+                }
+            }
+        }
+    }
+
+    bc.WriteValue(rng() & 1, 1);    // Filter type
+    bc.WriteValue(rng() % 64, 6);   // Loop filter level
+    bc.WriteValue(rng() % 8, 3);    // Sharpness
+    if (flag(128) && flag(128))     // Mode ref lf delta enabled and update
+    {
+        for (uint32_t i = 0; i < VP8_MAX_REF_LF_DELTAS + VP8_MAX_MODE_LF_DELTAS; i++)
+        {
+            if (flag(128))
+            {
+                bc.WriteSigned(RandomSigned(rng, 6), 6);
+            }
+        }
+    }
+
+    uint32_t partitions = rng() % 4;
+    bc.WriteValue(partitions, 2);
+
+    bc.WriteValue(rng() % 128, 7);  // Base q index
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        if (flag(96))
+        {
+            bc.WriteSigned(RandomSigned(rng, 4), 4);
+        }
+    }
+
+    if (!keyFrame)
+    {
+        uint32_t refreshGolden = flag(64);
+        uint32_t refreshAlt    = flag(64);
+        if (!refreshGolden)
+        {
+            bc.WriteValue(rng() % 3, 2);
+        }
+        if (!refreshAlt)
+        {
+            bc.WriteValue(rng() % 3, 2);
+        }
+        flag(128);  // Golden sign bias
+        flag(128);  // Alt sign bias
+    }
+
+    flag(192);  // Refresh entropy probs
+    if (!keyFrame)
+    {
+        flag(192);  // Refresh last
+    }
+
+    const uint8_t *updateProbs = &CoefUpdateProbs[0][0][0][0];
+    for (uint32_t i = 0; i < sizeof(CoefUpdateProbs); i++)
+    {
+        uint32_t update = rng() % 256 < updateRate;
+        bc.Write(updateProbs[i], update);
+        if (update)
+        {
+            bc.WriteValue(rng() % 256, 8);
+        }
+    }
+
+    if (flag(192))  // MB no coeff skip
+    {
+        bc.WriteValue(rng() % 256, 8);
+    }
+
+    if (!keyFrame)
+    {
+        bc.WriteValue(rng() % 256, 8);  // Prob intra
+        bc.WriteValue(rng() % 256, 8);  // Prob last
+        bc.WriteValue(rng() % 256, 8);  // Prob golden
+        if (flag(96))
+        {
+            bc.WriteValue(rng(), 32);  // Four Y mode probs
+        }
+        if (flag(96))
+        {
+            bc.WriteValue(rng() % (1 << 24), 24);  // Three UV mode probs
+        }
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            for (uint32_t j = 0; j < CODEC_VP8_MVP_COUNT; j++)
+            {
+                uint32_t update = rng() % 256 < 64;
+                bc.Write(MvUpdateProbs[i].MvProb[j], update);
+                if (update)
+                {
+                    bc.WriteValue(rng() % 128, 7);
+                }
+            }
+        }
+    }
+
+    // Macroblock header data fills the rest of the first partition
+    uint32_t mbBits = rng() % 4096;
+    for (uint32_t i = 0; i < mbBits; i++)
+    {
+        uint8_t prob = (uint8_t)(rng() % 255 + 1);
+        bc.Write(prob, rng() % 256 >= prob);
+    }
+
+    vector<uint8_t> &firstPartition = bc.Flush();
+    firstPartitionSize              = (uint32_t)firstPartition.size();
+
+    // Frame tag, then start code and a 176x144 frame size for key frames
+    uint32_t tag = (keyFrame ? 0 : 1) | ((rng() % 4) << 1) | (1 << 4) | (firstPartitionSize << 5);
+    frame.assign({(uint8_t)tag, (uint8_t)(tag >> 8), (uint8_t)(tag >> 16)});
+    if (keyFrame)
+    {
+        frame.insert(frame.end(), {0x9d, 0x01, 0x2a, 176, 0, 144, 0});
+    }
+    frame.insert(frame.end(), firstPartition.begin(), firstPartition.end());
+
+    // Partition size table and token partitions, some frames have almost no token data
+    vector<uint32_t> sizes(1 << partitions);
+    for (auto &size : sizes)
+    {
+        size = (rng() % 4) ? rng() % 4000 : rng() % 4;
+    }
+    for (uint32_t i = 0; i + 1 < sizes.size(); i++)
+    {
+        frame.insert(frame.end(), {(uint8_t)sizes[i], (uint8_t)(sizes[i] >> 8), (uint8_t)(sizes[i] >> 16)});
+    }
+    for (auto size : sizes)
+    {
+        for (uint32_t i = 0; i < size; i++)
+        {
+            frame.push_back((uint8_t)rng());
+        }
+    }
+}
+
+static uint32_t Vp8TestHash(const void *data, size_t size, uint32_t hash = 2166136261u)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+//!
+//! \brief  Hash the frame head fields parsed from the first partition
+//!
+static uint32_t Vp8TestHashFrameHead(const CODECHAL_DECODE_VP8_FRAME_HEAD &head)
+{
+    const int32_t fields[] = {
+        head.iFrameType, head.iShowframe, head.iMbNoCoeffSkip, head.iProbSkipFalse, head.iBaseQIndex,
+        head.iY1DcDeltaQ, head.iY2DcDeltaQ, head.iY2AcDeltaQ, head.iUVDcDeltaQ, head.iUVAcDeltaQ,
+        head.FilterType, head.iFilterLevel, head.iSharpnessLevel,
+        head.iRefreshLastFrame, head.iRefreshGoldenFrame, head.iRefreshAltFrame,
+        head.iCopyBufferToGolden, head.iCopyBufferToAlt, head.iRefreshEntropyProbs,
+        head.RefFrameSignBias[VP8_GOLDEN_FRAME], head.RefFrameSignBias[VP8_ALTREF_FRAME],
+        head.MultiTokenPartition, head.u8SegmentationEnabled, head.u8UpdateMbSegmentationMap,
+        head.u8UpdateMbSegmentationData, head.u8MbSegementAbsDelta, head.u8ModeRefLfDeltaEnabled,
+        head.u8ModeRefLfDeltaUpdate, head.ProbIntra, head.ProbLast, head.ProbGf};
+
+    uint32_t hash = Vp8TestHash(fields, sizeof(fields));
+    hash          = Vp8TestHash(head.MbSegmentTreeProbs, sizeof(head.MbSegmentTreeProbs), hash);
+    hash          = Vp8TestHash(head.SegmentFeatureData, sizeof(head.SegmentFeatureData), hash);
+    hash          = Vp8TestHash(head.LoopFilterLevel, sizeof(head.LoopFilterLevel), hash);
+    hash          = Vp8TestHash(head.RefLFDeltas, sizeof(head.RefLFDeltas), hash);
+    hash          = Vp8TestHash(head.ModeLFDeltas, sizeof(head.ModeLFDeltas), hash);
+    hash          = Vp8TestHash(head.YModeProbs, sizeof(head.YModeProbs), hash);
+    hash          = Vp8TestHash(head.UVModeProbs, sizeof(head.UVModeProbs), hash);
+    hash          = Vp8TestHash(head.Y1DeQuant, sizeof(head.Y1DeQuant), hash);
+    hash          = Vp8TestHash(head.Y2DeQuant, sizeof(head.Y2DeQuant), hash);
+    return Vp8TestHash(head.UVDeQuant, sizeof(head.UVDeQuant), hash);
+}
+
+struct Vp8EntropyGolden
+{
+    uint32_t stream;
+    uint32_t frame;
+    uint8_t  p0EntropyCount;
+    uint8_t  p0EntropyValue;
+    uint32_t p0EntropyRange;
+    uint32_t firstMbByteOffset;
+    uint32_t partitionSize[9];
+    uint32_t coefProbsHash;
+    uint32_t frameContextHash;
+    uint32_t lastFrameContextHash;
+    uint32_t frameHeadHash;
+};
+
+//!
+//! \brief  Output of the original parser for every frame of every stream
+//!
+static const Vp8EntropyGolden Vp8EntropyGoldens[HAL_TEST_VP8_STREAMS * HAL_TEST_VP8_FRAMES] = {
+    {0, 0, 7, 0x0f, 192,   22, {183, 1470, 3299, 0, 0, 0, 0, 0, 0}, 0x604f561b, 0xd7b71c14, 0x5f3fd9ef, 0x6410fe5b},
+    {0, 1, 7, 0xe5, 252,   29, {194, 3, 3681, 3802, 2725, 0, 0, 0, 0}, 0x604f561b, 0xabfb8a67, 0xd7b71c14, 0xdd70f6df},
+    {0, 2, 1, 0xde, 239,   39, {262, 3547, 0, 0, 0, 0, 0, 0, 0}, 0x604f561b, 0x1351ec57, 0xd7b71c14, 0x92f5a14e},
+    {0, 3, 2, 0x30, 252,   28, {265, 2387, 3, 3066, 3695, 963, 1352, 1735, 245}, 0x604f561b, 0x1351ec57, 0x1351ec57, 0xfc7e7e7d},
+    {0, 4, 8, 0x12, 128,   36, {221, 1624, 1, 2420, 2997, 440, 837, 3, 2}, 0x604f561b, 0x530b2a16, 0x1351ec57, 0x2ba05d12},
+    {0, 5, 2, 0x2c, 128,   32, {182, 2093, 3952, 1955, 1372, 0, 0, 0, 0}, 0x604f561b, 0x22af760e, 0x1351ec57, 0x7ae9a603},
+    {0, 6, 6, 0x7d, 128,   36, {124, 2920, 2240, 0, 0, 0, 0, 0, 0}, 0x604f561b, 0x677f324c, 0x1351ec57, 0xa2ed1694},
+    {0, 7, 5, 0x7e, 128,   44, {205, 1842, 2363, 1, 3122, 0, 0, 0, 0}, 0x604f561b, 0x97aa53ce, 0x1351ec57, 0xe6b6f5ea},
+    {1, 0, 6, 0x63, 222,   57, {265, 672, 3500, 3739, 0, 2, 0, 1059, 814}, 0x439a2cd0, 0x574b8cfb, 0x5f3fd9ef, 0xb70f0dc0},
+    {1, 1, 6, 0x62, 254,   77, {355, 1568, 2238, 3855, 3106, 1467, 3892, 2397, 592}, 0x199124fc, 0x9e91fa81, 0x5f3fd9ef, 0xab51abde},
+    {1, 2, 5, 0x30, 182,   52, {187, 2, 1797, 0, 0, 0, 0, 0, 0}, 0x1c372fc5, 0xc7cd4ca5, 0x5f3fd9ef, 0x7c8aae6c},
+    {1, 3, 3, 0x4d, 250,   61, {294, 0, 3451, 2497, 1163, 0, 0, 0, 0}, 0xceb46fbc, 0xdcfacfc5, 0x5f3fd9ef, 0xcbb59bf6},
+    {1, 4, 3, 0x2e, 154,   77, {306, 2202, 1, 0, 0, 0, 0, 0, 0}, 0x0c71ad50, 0x0aa7c0cc, 0x5f3fd9ef, 0x03e89307},
+    {1, 5, 3, 0x7e, 128,   69, {297, 2715, 0, 1, 0, 0, 0, 0, 0}, 0x07ff3417, 0x6d120c77, 0x5f3fd9ef, 0x17b36523},
+    {1, 6, 6, 0xd6, 238,   83, {258, 3369, 1, 0, 0, 0, 0, 0, 0}, 0x024daccf, 0x56b921a5, 0x5f3fd9ef, 0x953bf71d},
+    {1, 7, 3, 0x82, 154,   80, {118, 3864, 179, 0, 0, 0, 0, 0, 0}, 0x08d0c878, 0x44fd1d97, 0x56b921a5, 0x9cea139e},
+    {2, 0, 8, 0x92, 226,  264, {183, 1, 2869, 0, 0, 0, 0, 0, 0}, 0xfb10a879, 0x7ab71aa2, 0xd7b71c14, 0x01a97a24},
+    {2, 1, 6, 0x82, 252,  300, {3, 3446, 3966, 1474, 2905, 0, 0, 0, 0}, 0xee58f743, 0x4cb01cb0, 0xd7b71c14, 0x38cdac4f},
+    {2, 2, 7, 0xc9, 252,  272, {128, 1968, 0, 0, 0, 0, 0, 0, 0}, 0x2a639afb, 0xdb59357f, 0xd7b71c14, 0x55c2fac7},
+    {2, 3, 3, 0x8c, 239,  271, {223, 1874, 2417, 1, 0, 1446, 3641, 3, 3803}, 0xe04836b4, 0x1d727854, 0xd7b71c14, 0x6e6054ac},
+    {2, 4, 1, 0x20, 252,  273, {165, 3904, 652, 0, 0, 0, 0, 0, 0}, 0x78ce1beb, 0x7c1bac2b, 0x1d727854, 0xea3a6d40},
+    {2, 5, 8, 0x66, 154,  274, {277, 1146, 2904, 2217, 710, 0, 0, 0, 0}, 0xef59ce5c, 0x3242b8ac, 0x1d727854, 0x3294759d},
+    {2, 6, 3, 0x19, 150,  286, {248, 3, 0, 0, 0, 0, 0, 0, 0}, 0xfe0681ff, 0x814fd033, 0x1d727854, 0x47131b20},
+    {2, 7, 2, 0x27, 154,  294, {229, 1, 1137, 2, 1221, 3931, 2595, 859, 1363}, 0xa8fc567f, 0xd3078cb3, 0x1d727854, 0x0a77b16b},
+    {3, 0, 6, 0x38, 254, 1031, {127, 1722, 1, 0, 0, 0, 0, 0, 0}, 0x79c78ef9, 0x811d4896, 0x5f3fd9ef, 0x24100028},
+    {3, 1, 6, 0x1c, 239, 1084, {269, 317, 2796, 0, 0, 0, 0, 0, 0}, 0x43f9aebe, 0xabd6de6b, 0x5f3fd9ef, 0xbf6d9819},
+    {3, 2, 1, 0x70, 252, 1038, {107, 530, 3, 66, 2177, 0, 0, 0, 0}, 0x1159c3c0, 0x03962cfd, 0x5f3fd9ef, 0xd595f61d},
+    {3, 3, 3, 0x0e, 128, 1048, {246, 173, 3, 0, 0, 0, 0, 0, 0}, 0xb667c39c, 0x7dc2d261, 0x5f3fd9ef, 0x59a3fd1a},
+    {3, 4, 4, 0x60, 150, 1057, {158, 1368, 3952, 3617, 498, 2462, 3259, 3765, 1082}, 0x0bc6d90b, 0x0121683e, 0x7dc2d261, 0xd87b516e},
+    {3, 5, 1, 0x1e, 254, 1040, {235, 1221, 0, 0, 0, 0, 0, 0, 0}, 0xc16d8b67, 0x86431f0a, 0x7dc2d261, 0x03383ad0},
+    {3, 6, 7, 0x2e, 128, 1065, {139, 3, 0, 3469, 0, 0, 1689, 2749, 3171}, 0x1903459a, 0x4ce3c16a, 0x86431f0a, 0xbe6462b9},
+    {3, 7, 8, 0xb3, 234, 1057, {297, 2659, 2959, 2022, 2299, 1229, 1, 2910, 1194}, 0x6a860207, 0x47b88b12, 0x86431f0a, 0x609ee544},
+    {4, 0, 4, 0x03, 128, 1975, {82, 2804, 520, 0, 0, 0, 0, 0, 0}, 0x3d609a25, 0x20126006, 0x5f3fd9ef, 0x52dfe58d},
+    {4, 1, 7, 0xe0, 254, 1986, {25, 1, 3489, 0, 0, 0, 0, 0, 0}, 0xae9e2c25, 0x5acb7206, 0x20126006, 0xf16c4703},
+    {4, 2, 5, 0x75, 254, 1996, {338, 1955, 284, 3566, 3228, 3178, 0, 0, 2775}, 0x7dec6743, 0xf76c7fe0, 0x20126006, 0x9d9e8486},
+    {4, 3, 3, 0xb3, 182, 1989, {327, 2091, 2443, 0, 0, 0, 0, 0, 0}, 0x73f864f9, 0x638bf49e, 0x20126006, 0x6a6ac495},
+    {4, 4, 4, 0xdd, 254, 1991, {104, 2043, 2352, 86, 461, 883, 251, 1, 2156}, 0x145b1020, 0x65770e9c, 0x20126006, 0xbdbc8690},
+    {4, 5, 1, 0xfc, 254, 1986, {137, 3319, 3900, 2913, 454, 0, 0, 0, 0}, 0x010b2fa6, 0xb1221c8e, 0x20126006, 0x84e5b57b},
+    {4, 6, 2, 0x22, 128, 1993, {56, 784, 482, 0, 0, 0, 0, 0, 0}, 0xa73dbea3, 0x834db14f, 0x20126006, 0x3a1944b4},
+    {4, 7, 6, 0x18, 154, 1998, {14, 2062, 3, 534, 3713, 0, 0, 0, 0}, 0x43c14bb3, 0x961976d8, 0x20126006, 0x45822899},
+    {5, 0, 1, 0xdd, 244,  156, {101, 2174, 1623, 2192, 3, 0, 0, 0, 0}, 0x07d7c02b, 0xd3d9d8ac, 0x5f3fd9ef, 0x5da0601d},
+    {5, 1, 7, 0xd8, 238,  176, {114, 3752, 0, 0, 0, 0, 0, 0, 0}, 0x736d809e, 0xbb032a73, 0x5f3fd9ef, 0x56401288},
+    {5, 2, 6, 0x34, 154,  157, {251, 2, 794, 3377, 0, 0, 1038, 2366, 1429}, 0x82f154dc, 0x1f4807e1, 0x5f3fd9ef, 0x2cc5629b},
+    {5, 3, 6, 0x44, 154,  178, {275, 3528, 0, 0, 0, 0, 0, 0, 0}, 0x1fede56e, 0xa7a30e0b, 0x5f3fd9ef, 0x366be73c},
+    {5, 4, 4, 0xaf, 254,  135, {229, 3056, 0, 0, 0, 0, 0, 0, 0}, 0x2d893a8f, 0xc54274c4, 0xd7b71c14, 0xbf93f4dc},
+    {5, 5, 2, 0xb9, 254,  164, {121, 2, 0, 0, 0, 0, 0, 0, 0}, 0x9f163450, 0x9db86a74, 0xd7b71c14, 0x8435d062},
+    {5, 6, 7, 0x26, 232,  166, {208, 3629, 2, 0, 0, 0, 0, 0, 0}, 0x00ba3f93, 0xe4f54bbb, 0x9db86a74, 0x16aa47c4},
+    {5, 7, 5, 0xc9, 238,  179, {21, 2950, 821, 680, 209, 0, 0, 0, 0}, 0x1a8183dd, 0x2b043293, 0x9db86a74, 0x246ee374},
+};
+
+class DecodeVp8EntropyTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        m_head = MOS_New(CODECHAL_DECODE_VP8_FRAME_HEAD);
+        ASSERT_NE(nullptr, m_head);
+    }
+
+    virtual void TearDown()
+    {
+        MOS_Delete(m_head);
+    }
+
+    //! \brief  Start a stream with a zeroed frame head, as the decoder does
+    void StartStream(uint32_t stream)
+    {
+        m_rng.seed(2026 + stream);
+        memset(m_head, 0, sizeof(*m_head));
+    }
+
+    //! \brief  Write the next frame of a stream and parse its frame head
+    MOS_STATUS ParseFrame(uint32_t stream, uint32_t frame)
+    {
+        bool keyFrame = frame == 0 || (stream == 5 && frame == 4);
+        uint32_t firstPartitionSize = 0;
+        WriteVp8Frame(m_rng, keyFrame, Vp8TestUpdateRates[stream], m_frame, firstPartitionSize);
+
+        memset(&m_picParams, 0, sizeof(m_picParams));
+        m_picParams.uiFirstPartitionSize = firstPartitionSize;
+
+        Vp8EntropyState state;
+        state.Initialize(m_head, m_frame.data(), (uint32_t)m_frame.size());
+        MOS_STATUS status     = state.ParseFrameHead(&m_picParams);
+        m_head->bNotFirstCall = true;
+        return status;
+    }
+
+    mt19937                         m_rng;
+    vector<uint8_t>                 m_frame;
+    CODEC_VP8_PIC_PARAMS            m_picParams = {};
+    CODECHAL_DECODE_VP8_FRAME_HEAD *m_head      = nullptr;
+};
+
+TEST_F(DecodeVp8EntropyTest, FrameHeadsMatchGolden)
+{
+    const Vp8EntropyGolden *golden = Vp8EntropyGoldens;
+    for (uint32_t stream = 0; stream < HAL_TEST_VP8_STREAMS; stream++)
+    {
+        StartStream(stream);
+        for (uint32_t frame = 0; frame < HAL_TEST_VP8_FRAMES; frame++, golden++)
+        {
+            SCOPED_TRACE(testing::Message() << "stream " << stream << " frame " << frame);
+            ASSERT_EQ(golden->stream, stream);
+            ASSERT_EQ(golden->frame, frame);
+            ASSERT_EQ(MOS_STATUS_SUCCESS, ParseFrame(stream, frame));
+
+            EXPECT_EQ(golden->p0EntropyCount, m_picParams.ucP0EntropyCount);
+            EXPECT_EQ(golden->p0EntropyValue, m_picParams.ucP0EntropyValue);
+            EXPECT_EQ(golden->p0EntropyRange, m_picParams.uiP0EntropyRange);
+            EXPECT_EQ(golden->firstMbByteOffset, m_picParams.uiFirstMbByteOffset);
+            for (uint32_t i = 0; i < 9; i++)
+            {
+                EXPECT_EQ(golden->partitionSize[i], m_picParams.uiPartitionSize[i]) << "partition " << i;
+            }
+            EXPECT_EQ(golden->coefProbsHash, Vp8TestHash(m_head->FrameContext.CoefProbs, sizeof(m_head->FrameContext.CoefProbs)));
+            EXPECT_EQ(golden->frameContextHash, Vp8TestHash(&m_head->FrameContext, sizeof(m_head->FrameContext)));
+            EXPECT_EQ(golden->lastFrameContextHash, Vp8TestHash(&m_head->LastFrameContext, sizeof(m_head->LastFrameContext)));
+            EXPECT_EQ(golden->frameHeadHash, Vp8TestHashFrameHead(*m_head));
+        }
+    }
+}
+
+TEST_F(DecodeVp8EntropyTest, CoefProbUpdatesFollowUpdateRate)
+{
+    for (uint32_t stream = 0; stream < HAL_TEST_VP8_STREAMS; stream++)
+    {
+        StartStream(stream);
+        ASSERT_EQ(MOS_STATUS_SUCCESS, ParseFrame(stream, 0));
+
+        uint32_t       updated  = 0;
+        const uint8_t *probs    = &m_head->FrameContext.CoefProbs[0][0][0][0];
+        const uint8_t *defaults = &DefaultCoefProbs[0][0][0][0];
+        for (uint32_t i = 0; i < sizeof(DefaultCoefProbs); i++)
+        {
+            updated += probs[i] != defaults[i];
+        }
+
+        if (Vp8TestUpdateRates[stream] == 0)
+        {
+            EXPECT_EQ(0u, updated) << "stream " << stream;
+        }
+        else
+        {
+            EXPECT_LT(0u, updated) << "stream " << stream;
+        }
+    }
+}
+
+TEST_F(DecodeVp8EntropyTest, DISABLED_PerfParseFrameHead)
+{
+    // Key frame of the stream that updates every coefficient probability
+    StartStream(4);
+    ASSERT_EQ(MOS_STATUS_SUCCESS, ParseFrame(4, 0));
+    CODECHAL_DECODE_VP8_FRAME_HEAD *head      = m_head;
+    vector<uint8_t>                &data      = m_frame;
+    CODEC_VP8_PIC_PARAMS            picParams = m_picParams;
+
+    EXPECT_TRUE(HalTestMeasure("Vp8EntropyState::ParseFrameHead", HalTestPerfLoops(20000), [&]() {
+        Vp8EntropyState state;
+        state.Initialize(head, data.data(), (uint32_t)data.size());
+        return state.ParseFrameHead(&picParams) == MOS_STATUS_SUCCESS;
+    }));
+}
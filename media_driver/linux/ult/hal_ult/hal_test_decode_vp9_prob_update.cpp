@@ -0,0 +1,273 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_decode_vp9_prob_update.cpp
+//! \brief    Unit tests of the VP9 decode prob buffer update.
+//! \details  The prob buffer used to be updated in place under a CPU lock. It is
+//!           now built in a staging buffer and copied by HuC, with inter probs
+//!           saved to and restored from a save buffer on GPU. Random flag
+//!           sequences run through both, and the prob buffers must stay equal.
+//!
+#include <string.h>
+#include <random>
+#include <vector>
+#include "hal_test.h"
+#include "decode_vp9_buffer_update.h"
+
+using namespace std;
+using namespace decode;
+
+//!
+//! \brief  Expose the static prob update helpers of DecodeVp9BufferUpdate
+//!
+class Vp9ProbUpdateTestAccess : public DecodeVp9BufferUpdate
+{
+public:
+    using DecodeVp9BufferUpdate::ProbBufCopy;
+    using DecodeVp9BufferUpdate::probCopyStagingToProb;
+    using DecodeVp9BufferUpdate::probCopyProbToSave;
+    using DecodeVp9BufferUpdate::probCopySaveToProb;
+    using DecodeVp9BufferUpdate::m_maxProbBufCopies;
+    using DecodeVp9BufferUpdate::BuildProbBufUpdate;
+    using DecodeVp9BufferUpdate::ContextBufferInit;
+    using DecodeVp9BufferUpdate::CtxBufDiffInit;
+    using DecodeVp9BufferUpdate::GetCtxBufDiffRegions;
+};
+
+typedef Vp9ProbUpdateTestAccess ProbAccess;
+
+class DecodeVp9ProbUpdateTest : public testing::Test
+{
+protected:
+    //! \brief  Previous CPU update of the prob buffer, in place
+    static void UpdateInPlace(const CODECHAL_DECODE_VP9_PROB_UPDATE &flags, bool fullUpdate, uint8_t *prob, uint8_t *saved)
+    {
+        bool key = flags.bResetKeyDefault ? true : false;
+
+        if (fullUpdate)
+        {
+            ProbAccess::ContextBufferInit(prob, key);
+            memcpy(prob + CODEC_VP9_SEG_PROB_OFFSET, flags.SegTreeProbs, 7);
+            memcpy(prob + CODEC_VP9_SEG_PROB_OFFSET + 7, flags.SegPredProbs, 3);
+            return;
+        }
+
+        if (flags.bSegProbCopy)
+        {
+            memcpy(prob + CODEC_VP9_SEG_PROB_OFFSET, flags.SegTreeProbs, 7);
+            memcpy(prob + CODEC_VP9_SEG_PROB_OFFSET + 7, flags.SegPredProbs, 3);
+        }
+        if (flags.bProbSave)
+        {
+            memcpy(saved, prob + CODEC_VP9_INTER_PROB_OFFSET, CODECHAL_VP9_INTER_PROB_SIZE);
+        }
+        if (flags.bProbReset)
+        {
+            if (flags.bResetFull)
+            {
+                ProbAccess::ContextBufferInit(prob, key);
+            }
+            else
+            {
+                ProbAccess::CtxBufDiffInit(prob, key);
+            }
+        }
+        if (flags.bProbRestore)
+        {
+            memcpy(prob + CODEC_VP9_INTER_PROB_OFFSET, saved, CODECHAL_VP9_INTER_PROB_SIZE);
+        }
+    }
+
+    //! \brief  New update, staging buffer and copies executed in order as HuC does
+    static uint32_t UpdateWithCopies(
+        const CODECHAL_DECODE_VP9_PROB_UPDATE &flags, bool fullUpdate, uint8_t *prob, uint8_t *save, uint8_t fill)
+    {
+        vector<uint8_t>         staging(CODEC_VP9_PROB_MAX_NUM_ELEM, fill);
+        ProbAccess::ProbBufCopy copies[ProbAccess::m_maxProbBufCopies];
+        uint32_t                copyNum = 0;
+
+        EXPECT_EQ(MOS_STATUS_SUCCESS, ProbAccess::BuildProbBufUpdate(flags, fullUpdate, staging.data(), copies, copyNum));
+        EXPECT_LE(copyNum, (uint32_t)ProbAccess::m_maxProbBufCopies);
+
+        for (uint32_t i = 0; i < copyNum; i++)
+        {
+            const ProbAccess::ProbBufCopy &copy = copies[i];
+            EXPECT_LE(copy.offset + copy.size, (uint32_t)CODEC_VP9_PROB_MAX_NUM_ELEM);
+            switch (copy.type)
+            {
+            case ProbAccess::probCopyProbToSave:
+                memcpy(save + copy.offset, prob + copy.offset, copy.size);
+                break;
+            case ProbAccess::probCopySaveToProb:
+                memcpy(prob + copy.offset, save + copy.offset, copy.size);
+                break;
+            default:
+                memcpy(prob + copy.offset, staging.data() + copy.offset, copy.size);
+                break;
+            }
+        }
+        return copyNum;
+    }
+
+    static void RandomFlags(mt19937 &rng, CODECHAL_DECODE_VP9_PROB_UPDATE &flags, bool &fullUpdate)
+    {
+        memset(&flags, 0, sizeof(flags));
+        flags.bSegProbCopy     = rng() & 1;
+        flags.bProbSave        = (rng() % 4) == 0;
+        flags.bProbRestore     = !flags.bProbSave && (rng() % 4) == 0;
+        flags.bProbReset       = rng() & 1;
+        flags.bResetFull       = rng() & 1;
+        flags.bResetKeyDefault = rng() & 1;
+        for (uint32_t i = 0; i < 7; i++)
+        {
+            flags.SegTreeProbs[i] = (uint8_t)rng();
+        }
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            flags.SegPredProbs[i] = (uint8_t)rng();
+        }
+        fullUpdate = flags.bProbReset && flags.bResetFull && flags.bSegProbCopy;
+    }
+};
+
+TEST_F(DecodeVp9ProbUpdateTest, DiffRegionsMatchCtxBufDiffInit)
+{
+    for (uint32_t key = 0; key < 2; key++)
+    {
+        vector<uint8_t> first(CODEC_VP9_PROB_MAX_NUM_ELEM, 0xa5);
+        vector<uint8_t> second(CODEC_VP9_PROB_MAX_NUM_ELEM, 0x5a);
+        ProbAccess::CtxBufDiffInit(first.data(), key != 0);
+        ProbAccess::CtxBufDiffInit(second.data(), key != 0);
+
+        ProbAccess::ProbBufCopy regions[2];
+        ProbAccess::GetCtxBufDiffRegions(key != 0, regions);
+
+        vector<bool> inRegion(CODEC_VP9_PROB_MAX_NUM_ELEM, false);
+        for (auto &region : regions)
+        {
+            EXPECT_EQ(ProbAccess::probCopyStagingToProb, region.type);
+            EXPECT_GE(region.offset, (uint32_t)CODEC_VP9_INTER_PROB_OFFSET);
+            EXPECT_LE(region.offset + region.size, (uint32_t)(CODEC_VP9_INTER_PROB_OFFSET + CODECHAL_VP9_INTER_PROB_SIZE));
+            for (uint32_t i = region.offset; i < region.offset + region.size; i++)
+            {
+                inRegion[i] = true;
+            }
+        }
+
+        // A byte is written if it does not keep the fill pattern.
+        for (uint32_t i = 0; i < CODEC_VP9_PROB_MAX_NUM_ELEM; i++)
+        {
+            EXPECT_EQ(first[i] == second[i], (bool)inRegion[i]) << "key " << key << " byte " << i;
+        }
+    }
+}
+
+TEST_F(DecodeVp9ProbUpdateTest, AllFlagCombinationsMatchInPlaceUpdate)
+{
+    for (uint32_t bits = 0; bits < 128; bits++)
+    {
+        CODECHAL_DECODE_VP9_PROB_UPDATE flags;
+        memset(&flags, 0, sizeof(flags));
+        flags.bSegProbCopy     = (bits >> 0) & 1;
+        flags.bProbSave        = (bits >> 1) & 1;
+        flags.bProbRestore     = (bits >> 2) & 1;
+        flags.bProbReset       = (bits >> 3) & 1;
+        flags.bResetFull       = (bits >> 4) & 1;
+        flags.bResetKeyDefault = (bits >> 5) & 1;
+        bool fullUpdate        = (bits >> 6) & 1;
+        memset(flags.SegTreeProbs, 0x11 + bits, sizeof(flags.SegTreeProbs));
+        memset(flags.SegPredProbs, 0x22 + bits, sizeof(flags.SegPredProbs));
+
+        vector<uint8_t> probOld(CODEC_VP9_PROB_MAX_NUM_ELEM);
+        vector<uint8_t> saved(CODECHAL_VP9_INTER_PROB_SIZE, 0x33);
+        vector<uint8_t> save(CODEC_VP9_PROB_MAX_NUM_ELEM, 0x44);
+        for (uint32_t i = 0; i < probOld.size(); i++)
+        {
+            probOld[i] = (uint8_t)(i * 13 + bits);
+        }
+        memcpy(save.data() + CODEC_VP9_INTER_PROB_OFFSET, saved.data(), saved.size());
+        vector<uint8_t> probNew = probOld;
+
+        UpdateInPlace(flags, fullUpdate, probOld.data(), saved.data());
+        uint32_t copyNum = UpdateWithCopies(flags, fullUpdate, probNew.data(), save.data(), 0xee);
+
+        EXPECT_EQ(probOld, probNew) << "flags " << bits;
+        EXPECT_EQ(0, memcmp(saved.data(), save.data() + CODEC_VP9_INTER_PROB_OFFSET, saved.size())) << "flags " << bits;
+        if (!fullUpdate && !flags.bSegProbCopy && !flags.bProbSave && !flags.bProbReset && !flags.bProbRestore)
+        {
+            EXPECT_EQ(0u, copyNum);
+        }
+    }
+}
+
+TEST_F(DecodeVp9ProbUpdateTest, RandomSequencesMatchInPlaceUpdate)
+{
+    mt19937 rng(2026);
+
+    for (uint32_t seq = 0; seq < 64; seq++)
+    {
+        vector<uint8_t> probOld(CODEC_VP9_PROB_MAX_NUM_ELEM, 0);
+        vector<uint8_t> saved(CODECHAL_VP9_INTER_PROB_SIZE, 0);
+        vector<uint8_t> save(CODEC_VP9_PROB_MAX_NUM_ELEM, 0);
+        vector<uint8_t> probNew = probOld;
+
+        for (uint32_t frame = 0; frame < 32; frame++)
+        {
+            CODECHAL_DECODE_VP9_PROB_UPDATE flags;
+            bool                            fullUpdate = false;
+            RandomFlags(rng, flags, fullUpdate);
+
+            UpdateInPlace(flags, fullUpdate, probOld.data(), saved.data());
+            UpdateWithCopies(flags, fullUpdate, probNew.data(), save.data(), (uint8_t)rng());
+            ASSERT_EQ(probOld, probNew) << "sequence " << seq << " frame " << frame;
+
+            // Backward adaptation of the decoded frame writes the prob buffer.
+            for (uint32_t i = 0; i < 64; i++)
+            {
+                uint32_t pos = rng() % CODEC_VP9_PROB_MAX_NUM_ELEM;
+                probOld[pos] = probNew[pos] = (uint8_t)rng();
+            }
+        }
+    }
+}
+
+TEST_F(DecodeVp9ProbUpdateTest, DISABLED_PerfBuildProbBufUpdate)
+{
+    CODECHAL_DECODE_VP9_PROB_UPDATE flags;
+    memset(&flags, 0, sizeof(flags));
+    flags.bProbReset       = 1;
+    flags.bResetFull       = 1;
+    flags.bSegProbCopy     = 1;
+
+    vector<uint8_t>         staging(CODEC_VP9_PROB_MAX_NUM_ELEM);
+    ProbAccess::ProbBufCopy copies[ProbAccess::m_maxProbBufCopies];
+    uint32_t                copyNum = 0;
+
+    EXPECT_TRUE(HalTestMeasure("Vp9 BuildProbBufUpdate full", HalTestPerfLoops(100000), [&]() {
+        return ProbAccess::BuildProbBufUpdate(flags, true, staging.data(), copies, copyNum) == MOS_STATUS_SUCCESS;
+    }));
+
+    flags.bResetFull = 0;
+    EXPECT_TRUE(HalTestMeasure("Vp9 BuildProbBufUpdate partial reset", HalTestPerfLoops(100000), [&]() {
+        return ProbAccess::BuildProbBufUpdate(flags, false, staging.data(), copies, copyNum) == MOS_STATUS_SUCCESS;
+    }));
+}
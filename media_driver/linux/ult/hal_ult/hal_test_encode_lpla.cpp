@@ -0,0 +1,617 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_encode_lpla.cpp
+//! \brief    Unit tests of the lookahead pass frame queue.
+//! \details  Drives EncodeLookaheadQueue the way VdencLplaAnalysis does: every frame is
+//!           submitted to the queue, the last pass of its LA update retires the oldest
+//!           queued frame once the queue is depth frames ahead, and status reports are
+//!           completed when the application parses them. The GPU completes status
+//!           reports with a varying lag and in bursts, the application parses them in
+//!           batches and never parses some of them. Every result is checked against a
+//!           reference model of the queue written with standard containers.
+//!           VdencLplaAnalysis itself is driven through the calls the HEVC VDEnc
+//!           pipeline and LA packets make per frame, with its DMEM buffers in system
+//!           memory, to check LA init and the valid records across stream, BRC and
+//!           resolution resets.
+//!
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "hal_test.h"
+#include "encode_lpla.h"
+#include "encode_vdenc_lpla_analysis.h"
+
+using namespace std;
+using namespace encode;
+
+//!
+//! \brief  Reference model of the lookahead queue
+//! \details A frame waits in queued until an LA update retires it to a status report,
+//!          then waits in pending until that status report is parsed. Only the newest
+//!          frame retired to a status report has its analysis in it. The oldest retired
+//!          frame is dropped when a frame is submitted with 2 * m_maxDepth frames queued
+//!          or pending. Reset drops the queued frames.
+//!
+class LplaQueueModel
+{
+public:
+    struct Frame
+    {
+        uint32_t frame;      //!< Frame number
+        uint32_t report;     //!< Status report number the frame is retired to
+        uint32_t submitted;  //!< Frames submitted before the frame
+    };
+
+    explicit LplaQueueModel(uint32_t depth) : m_depth(depth) {}
+
+    void Submit(uint32_t frame)
+    {
+        if (!m_pending.empty() && m_pending.size() + m_queued.size() >= 2 * EncodeLookaheadQueue::m_maxDepth)
+        {
+            m_pending.pop_front();
+            m_dropped++;
+        }
+        m_queued.push_back({frame, 0, m_submitted});
+        m_submitted++;
+    }
+
+    bool IsAhead() const { return m_queued.size() >= m_depth; }
+
+    void Reset() { m_queued.clear(); }
+
+    void Retire(uint32_t report)
+    {
+        Frame frame  = m_queued.front();
+        frame.report = report;
+        m_queued.pop_front();
+        m_pending.push_back(frame);
+    }
+
+    //!
+    //! \brief  Parse a status report
+    //! \param  [out] latency
+    //!         Frames submitted since the completed frame was submitted, including itself
+    //! \param  [out] frame
+    //!         Frame number of the completed frame
+    //! \return bool
+    //!         true if the status report carries a result
+    //!
+    bool Complete(uint32_t report, uint32_t &latency, uint32_t &frame)
+    {
+        auto it = find_if(m_pending.rbegin(), m_pending.rend(), [report](const Frame &f) { return f.report == report; });
+        if (it == m_pending.rend())
+        {
+            return false;
+        }
+
+        latency = m_submitted - it->submitted;
+        frame   = it->frame;
+
+        auto last = it.base();  // one past the completed frame
+        m_dropped += (uint32_t)(last - m_pending.begin()) - 1;
+        m_pending.erase(m_pending.begin(), last);
+        return true;
+    }
+
+    uint32_t GetQueuedCount() const { return (uint32_t)m_queued.size(); }
+    uint32_t GetPendingCount() const { return (uint32_t)m_pending.size(); }
+    uint32_t GetDropped() const { return m_dropped; }
+
+protected:
+    uint32_t      m_depth     = 1;
+    uint32_t      m_submitted = 0;
+    uint32_t      m_dropped   = 0;
+    deque<Frame>  m_queued;
+    deque<Frame>  m_pending;
+};
+
+//!
+//! \brief  Lookahead results of one stream
+//!
+struct LplaStreamStats
+{
+    uint32_t results    = 0;
+    uint32_t dropped    = 0;
+    uint64_t latencySum = 0;
+    uint32_t latencyMin = UINT32_MAX;
+    uint32_t latencyMax = 0;
+};
+
+//!
+//! \brief  GPU and application behaviour of one stream
+//!
+struct LplaStreamPattern
+{
+    function<uint32_t(uint32_t)> gpuLag;          //!< Frames submitted after a frame before its status report completes
+    function<bool(uint32_t)>     skipReport;      //!< true if the application never parses the status report
+    uint32_t                     parseInterval;   //!< Completed status reports are parsed every parseInterval frames
+    function<bool(uint32_t)>     resetAt;         //!< true if lookahead init runs before the frame, may be empty
+};
+
+class EncodeLookaheadQueueTest : public testing::Test
+{
+protected:
+    virtual void SetUp() { }
+
+    virtual void TearDown() { }
+
+    //!
+    //! \brief  Run a lookahead pass stream through the queue and the reference model
+    //! \details Status report numbers are the frame numbers, as with StatusReportFeedbackNumber
+    //!          counting frames. Status reports complete in submission order.
+    //!
+    void RunStream(uint32_t depth, uint32_t frameNum, const LplaStreamPattern &pattern, LplaStreamStats &stats)
+    {
+        EncodeLookaheadQueue queue;
+        LplaQueueModel       model(depth);
+        vector<uint32_t>     completeAt(frameNum);
+        uint32_t             nextReport = 0;
+        uint32_t             lastFrame  = 0;
+
+        for (uint32_t n = 0; n < frameNum; n++)
+        {
+            // Update of frame n, then the last pass of its LA update
+            if (pattern.resetAt && pattern.resetAt(n))
+            {
+                queue.Reset();
+                model.Reset();
+            }
+            queue.SetDepth(depth);
+            ASSERT_EQ(MOS_STATUS_SUCCESS, queue.Submit(n));
+            model.Submit(n);
+            ASSERT_EQ(model.IsAhead(), queue.IsAhead()) << "frame " << n;
+            if (queue.IsAhead())
+            {
+                ASSERT_EQ(MOS_STATUS_SUCCESS, queue.Retire(n));
+                model.Retire(n);
+            }
+
+            completeAt[n] = max(n ? completeAt[n - 1] : 0, n + pattern.gpuLag(n));
+
+            if ((n + 1) % pattern.parseInterval == 0 || n + 1 == frameNum)
+            {
+                for (; nextReport <= n && completeAt[nextReport] <= n; nextReport++)
+                {
+                    if (pattern.skipReport(nextReport))
+                    {
+                        continue;
+                    }
+
+                    uint32_t latency = 0;
+                    uint32_t frame   = 0;
+                    bool     expect  = model.Complete(nextReport, latency, frame);
+                    ASSERT_EQ(expect, queue.Complete(nextReport)) << "status report " << nextReport;
+                    if (!expect)
+                    {
+                        continue;
+                    }
+
+                    EXPECT_EQ(latency, queue.GetLastLatency()) << "status report " << nextReport;
+                    EXPECT_GE(latency, depth) << "status report " << nextReport;
+                    EXPECT_TRUE(stats.results == 0 || frame > lastFrame) << "status report " << nextReport;
+                    lastFrame = frame;
+
+                    stats.results++;
+                    stats.latencySum += latency;
+                    stats.latencyMin = min(stats.latencyMin, latency);
+                    stats.latencyMax = max(stats.latencyMax, latency);
+                }
+            }
+
+            ASSERT_EQ(model.GetQueuedCount(), queue.GetQueuedCount()) << "frame " << n;
+            ASSERT_EQ(model.GetPendingCount(), queue.GetPendingCount()) << "frame " << n;
+        }
+
+        stats.dropped = model.GetDropped();
+    }
+
+    //!
+    //! \brief  GPU stalls for 10 frames every 50 frames, otherwise completes 0 to 2 frames late.
+    //!          The application parses every 3 frames and never parses 1 in 17 status reports.
+    //!
+    LplaStreamPattern BurstyPattern()
+    {
+        LplaStreamPattern pattern;
+        pattern.gpuLag = [this](uint32_t n) {
+            uint32_t jitter = m_rand() % 3;
+            return (n % 50 < 10) ? 10 - n % 50 + jitter : jitter;
+        };
+        pattern.skipReport    = [](uint32_t report) { return report % 17 == 5; };
+        pattern.parseInterval = 3;
+        return pattern;
+    }
+
+    mt19937 m_rand{2026};
+};
+
+TEST_F(EncodeLookaheadQueueTest, SetDepthClamps)
+{
+    const uint32_t       maxDepth = EncodeLookaheadQueue::m_maxDepth;
+    EncodeLookaheadQueue queue;
+    queue.SetDepth(0);
+    EXPECT_EQ(1u, queue.GetDepth());
+    queue.SetDepth(maxDepth + 1);
+    EXPECT_EQ(maxDepth, queue.GetDepth());
+}
+
+TEST_F(EncodeLookaheadQueueTest, ConstantGpuLagLatency)
+{
+    // With status reports parsed lag frames after submission, every result arrives
+    // depth + lag frames after its frame entered the lookahead pass. The status reports
+    // of the last lag frames are not complete when the stream ends.
+    for (uint32_t depth : {1u, 8u, 60u, EncodeLookaheadQueue::m_maxDepth})
+    {
+        for (uint32_t lag : {0u, 2u, 7u})
+        {
+            LplaStreamPattern pattern;
+            pattern.gpuLag        = [lag](uint32_t) { return lag; };
+            pattern.skipReport    = [](uint32_t) { return false; };
+            pattern.parseInterval = 1;
+
+            LplaStreamStats stats;
+            RunStream(depth, 1000, pattern, stats);
+
+            EXPECT_EQ(1000 - depth + 1 - lag, stats.results) << "depth " << depth << ", lag " << lag;
+            EXPECT_EQ(depth + lag, stats.latencyMin) << "depth " << depth << ", lag " << lag;
+            EXPECT_EQ(depth + lag, stats.latencyMax) << "depth " << depth << ", lag " << lag;
+            EXPECT_EQ(0u, stats.dropped) << "depth " << depth << ", lag " << lag;
+        }
+    }
+}
+
+TEST_F(EncodeLookaheadQueueTest, BurstyStatusReportsMatchModel)
+{
+    for (uint32_t depth : {1u, 8u, 32u, 60u, EncodeLookaheadQueue::m_maxDepth})
+    {
+        LplaStreamStats stats;
+        RunStream(depth, 4000, BurstyPattern(), stats);
+
+        EXPECT_GT(stats.results, 0u) << "depth " << depth;
+        EXPECT_GT(stats.latencyMax, stats.latencyMin) << "depth " << depth;
+        EXPECT_GT(stats.dropped, 0u) << "depth " << depth;
+    }
+}
+
+TEST_F(EncodeLookaheadQueueTest, UnparsedStatusReportsDropped)
+{
+    // The application stops parsing status reports for 600 frames. The queue keeps
+    // accepting frames, drops the results nobody reads and recovers afterwards.
+    LplaStreamPattern pattern;
+    pattern.gpuLag        = [](uint32_t) { return 1u; };
+    pattern.skipReport    = [](uint32_t report) { return report >= 100 && report < 700; };
+    pattern.parseInterval = 1;
+
+    LplaStreamStats stats;
+    RunStream(8, 1000, pattern, stats);
+
+    EXPECT_EQ(1000u - 8 + 1 - 1 - 600, stats.results);
+    EXPECT_EQ(600u, stats.dropped);
+    EXPECT_EQ(8u + 1, stats.latencyMax);
+}
+
+TEST_F(EncodeLookaheadQueueTest, ResetDropsQueuedFramesOnly)
+{
+    // Lookahead init every 100 frames clears the records of the queued frames. The
+    // frames retired before it still get their results from their status reports.
+    LplaStreamPattern pattern;
+    pattern.gpuLag        = [](uint32_t) { return 2u; };
+    pattern.skipReport    = [](uint32_t) { return false; };
+    pattern.parseInterval = 1;
+    pattern.resetAt       = [](uint32_t n) { return n > 0 && n % 100 == 0; };
+
+    LplaStreamStats stats;
+    RunStream(8, 1000, pattern, stats);
+
+    EXPECT_EQ(10 * (100u - 8 + 1) - 2, stats.results);
+    EXPECT_EQ(0u, stats.dropped);
+    EXPECT_EQ(8u + 2, stats.latencyMin);
+    EXPECT_EQ(8u + 2, stats.latencyMax);
+}
+
+//!
+//! \brief  Encode allocator whose resources are plain system memory
+//!
+class LplaTestAllocator : public EncodeAllocator
+{
+public:
+    LplaTestAllocator() : EncodeAllocator(nullptr) { }
+
+    virtual void *LockResourceForWrite(MOS_RESOURCE *resource)
+    {
+        vector<uint8_t> &memory = m_memory[resource];
+        if (memory.empty())
+        {
+            memory.assign(sizeof(VdencHevcHucLaDmem), 0xcd);
+        }
+        return memory.data();
+    }
+
+    virtual MOS_STATUS UnLock(MOS_RESOURCE *resource)
+    {
+        return m_memory.count(resource) ? MOS_STATUS_SUCCESS : MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    map<const MOS_RESOURCE *, vector<uint8_t>> m_memory;
+};
+
+class LplaTestBasicFeature : public EncodeBasicFeature
+{
+public:
+    LplaTestBasicFeature() : EncodeBasicFeature(nullptr, nullptr, nullptr, nullptr) { }
+
+    virtual uint32_t GetProfileLevelMaxFrameSize() { return 0; }
+};
+
+//!
+//! \brief  Lookahead analysis with its DMEM buffers behind LplaTestAllocator
+//! \details The force intra stream in buffer is not used by the LA records and is
+//!          marked set up, so no HW interface is needed.
+//!
+class LplaTestAnalysis : public VdencLplaAnalysis
+{
+public:
+    LplaTestAnalysis(EncodeAllocator *allocator, EncodeBasicFeature *basicFeature) :
+        VdencLplaAnalysis(nullptr, allocator, nullptr, nullptr)
+    {
+        m_basicFeature               = basicFeature;
+        m_lplaHelper                 = MOS_New(EncodeLPLA);
+        m_forceIntraSteamInSetupDone = true;
+        m_vdencLaInitDmemBuffer      = &m_initDmem;
+        for (uint32_t i = 0; i < CODECHAL_ENCODE_RECYCLED_BUFFER_NUM; i++)
+        {
+            for (uint32_t j = 0; j < CODECHAL_LPLA_NUM_OF_PASSES; j++)
+            {
+                m_vdencLaUpdateDmemBuffer[i][j] = &m_updateDmem[i][j];
+            }
+        }
+    }
+
+    MOS_RESOURCE m_initDmem = {};
+    MOS_RESOURCE m_updateDmem[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM][CODECHAL_LPLA_NUM_OF_PASSES] = {};
+};
+
+class VdencLplaAnalysisTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        m_seqParams                            = {};
+        m_seqParams.LookaheadDepth             = 8;
+        m_seqParams.bLookAheadPhase            = 1;
+        m_seqParams.GopPicSize                 = 32;
+        m_seqParams.GopRefDist                 = 1;
+        m_seqParams.FrameRate.Numerator        = 30;
+        m_seqParams.FrameRate.Denominator      = 1;
+        m_seqParams.TargetBitRate              = 4000;
+        m_seqParams.VBVBufferSizeInBit         = 8000000;
+        m_seqParams.InitVBVBufferFullnessInBit = 4000000;
+
+        m_picParams            = {};
+        m_picParams.CodingType = P_TYPE;
+
+        m_encodeParams                 = {};
+        m_encodeParams.pSeqParams      = &m_seqParams;
+        m_encodeParams.pPicParams      = &m_picParams;
+        m_encodeParams.pSliceParams    = &m_slcParams;
+        m_encodeParams.ppNALUnitParams = &m_nalUnitParams;
+        m_encodeParams.pSlcHeaderData  = &m_slcData;
+        m_encodeParams.dwNumSlices     = 1;
+
+        m_basicFeature.m_frameWidth        = 1920;
+        m_basicFeature.m_frameHeight       = 1080;
+        m_basicFeature.m_resolutionChanged = true;
+    }
+
+    virtual void TearDown() { }
+
+    //!
+    //! \brief  Encode one frame of the lookahead pass the way the HEVC VDEnc pipeline does
+    //! \details Update, LA init if required, LA update, then the LA updates flushing the
+    //!          records after the last picture in stream.
+    //! \param  [out] laInit
+    //!         true if the frame ran LA init
+    //! \return uint32_t
+    //!         Valid stats records of the LA update of the frame
+    //!
+    uint32_t EncodeFrame(LplaTestAnalysis &analysis, uint32_t frame, bool &laInit)
+    {
+        m_picParams.StatusReportFeedbackNumber = frame;
+        EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.Update(&m_encodeParams));
+        m_basicFeature.m_resolutionChanged = false;
+
+        laInit = analysis.IsLaInitRequired();
+        if (laInit)
+        {
+            mhw::vdbox::huc::HUC_VIRTUAL_ADDR_STATE_PAR virtualAddrParams = {};
+            virtualAddrParams.function = LA_INIT;
+            EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.MHW_SETPAR_F(HUC_VIRTUAL_ADDR_STATE)(virtualAddrParams));
+        }
+
+        uint32_t validRecords = LaUpdate(analysis, frame);
+        if (analysis.IsLastPicInStream())
+        {
+            while (!analysis.IsLaRecordsEmpty())
+            {
+                EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.FlushLaRecord());
+                LaUpdate(analysis, frame);
+            }
+        }
+
+        EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.UpdateLaDataIdx());
+        return validRecords;
+    }
+
+    uint32_t LaUpdate(LplaTestAnalysis &analysis, uint32_t frame)
+    {
+        uint8_t                             recycledBufIdx = frame % CODECHAL_ENCODE_RECYCLED_BUFFER_NUM;
+        mhw::vdbox::huc::HUC_DMEM_STATE_PAR dmemParams     = {};
+        EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.SetLaUpdateDmemParameters(dmemParams, recycledBufIdx, 0, 1));
+        EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.CalculateLaRecords(true));
+
+        auto dmem = (VdencHevcHucLaDmem *)m_allocator.m_memory[dmemParams.hucDataSource].data();
+        return dmem ? dmem->validStatsRecords : 0;
+    }
+
+    //!
+    //! \brief  Parse the status report of a frame
+    //! \return bool
+    //!         true if the status report carries a lookahead result
+    //!
+    bool ParseReport(LplaTestAnalysis &analysis, uint32_t report)
+    {
+        EncodeStatusMfx        encodeStatusMfx  = {};
+        EncodeStatusReportData statusReportData = {};
+        encodeStatusMfx.lookaheadStatus.targetFrameSize = 64;
+        statusReportData.statusReportNumber             = report;
+        EXPECT_EQ(MOS_STATUS_SUCCESS, analysis.GetLplaStatusReport(&encodeStatusMfx, &statusReportData));
+        return statusReportData.pLookaheadStatus != nullptr;
+    }
+
+    LplaTestAllocator                 m_allocator;
+    LplaTestBasicFeature              m_basicFeature;
+    CODEC_HEVC_ENCODE_SEQUENCE_PARAMS m_seqParams     = {};
+    CODEC_HEVC_ENCODE_PICTURE_PARAMS  m_picParams     = {};
+    CODEC_HEVC_ENCODE_SLICE_PARAMS    m_slcParams     = {};
+    CODECHAL_NAL_UNIT_PARAMS          m_nalUnit       = {};
+    PCODECHAL_NAL_UNIT_PARAMS         m_nalUnitParams = &m_nalUnit;
+    CODEC_ENCODER_SLCDATA             m_slcData       = {};
+    EncoderParams                     m_encodeParams  = {};
+};
+
+TEST_F(VdencLplaAnalysisTest, ValidRecordsRampToDepth)
+{
+    LplaTestAnalysis analysis(&m_allocator, &m_basicFeature);
+    for (uint32_t n = 0; n < 40; n++)
+    {
+        bool laInit = false;
+        EXPECT_EQ(min(n + 1, 8u), EncodeFrame(analysis, n, laInit)) << "frame " << n;
+        EXPECT_EQ(n == 0, laInit) << "frame " << n;
+        EXPECT_EQ(n >= 8, ParseReport(analysis, n - 1)) << "frame " << n;
+    }
+}
+
+TEST_F(VdencLplaAnalysisTest, ResetBrcRestartsLookahead)
+{
+    // BRC reset at frame 20 runs LA init again, the records restart from the frame.
+    // Status reports of frames before it still carry the results retired to them.
+    LplaTestAnalysis analysis(&m_allocator, &m_basicFeature);
+    for (uint32_t n = 0; n < 40; n++)
+    {
+        m_seqParams.bResetBRC = (n == 20);
+
+        bool     laInit = false;
+        uint32_t valid  = EncodeFrame(analysis, n, laInit);
+        EXPECT_EQ(n == 0 || n == 20, laInit) << "frame " << n;
+        EXPECT_EQ(n < 20 ? min(n + 1, 8u) : min(n - 20 + 1, 8u), valid) << "frame " << n;
+
+        if (n > 0)
+        {
+            bool expect = (n - 1 >= 7 && n - 1 < 20) || n - 1 >= 27;
+            EXPECT_EQ(expect, ParseReport(analysis, n - 1)) << "frame " << n;
+        }
+    }
+}
+
+TEST_F(VdencLplaAnalysisTest, ResolutionChangeRestartsLookahead)
+{
+    LplaTestAnalysis analysis(&m_allocator, &m_basicFeature);
+    for (uint32_t n = 0; n < 40; n++)
+    {
+        if (n == 20)
+        {
+            m_basicFeature.m_frameWidth        = 1280;
+            m_basicFeature.m_frameHeight       = 720;
+            m_basicFeature.m_resolutionChanged = true;
+        }
+
+        bool     laInit = false;
+        uint32_t valid  = EncodeFrame(analysis, n, laInit);
+        EXPECT_EQ(n == 0 || n == 20, laInit) << "frame " << n;
+        EXPECT_EQ(n < 20 ? min(n + 1, 8u) : min(n - 20 + 1, 8u), valid) << "frame " << n;
+    }
+}
+
+TEST_F(VdencLplaAnalysisTest, NewStreamAfterFlush)
+{
+    // The last picture of the first stream flushes its 7 queued records, all retired
+    // to its status report. The next stream starts with LA init and no records.
+    LplaTestAnalysis analysis(&m_allocator, &m_basicFeature);
+    for (uint32_t n = 0; n < 40; n++)
+    {
+        m_picParams.bLastPicInStream = (n == 19);
+
+        bool     laInit = false;
+        uint32_t valid  = EncodeFrame(analysis, n, laInit);
+        EXPECT_EQ(n == 0 || n == 20, laInit) << "frame " << n;
+        EXPECT_EQ(n < 20 ? min(n + 1, 8u) : min(n - 20 + 1, 8u), valid) << "frame " << n;
+        if (n == 19)
+        {
+            EXPECT_TRUE(analysis.IsLaRecordsEmpty());
+            EXPECT_TRUE(ParseReport(analysis, 19));
+        }
+    }
+}
+
+TEST_F(EncodeLookaheadQueueTest, DISABLED_PerfLookaheadLatency)
+{
+    // Lookahead latency of the queue with the bursty GPU and application of BurstyStatusReportsMatchModel
+    printf("%-10s %10s %10s %10s %10s %10s %12s\n", "depth", "results", "dropped", "min", "mean", "max", "mean ms@30");
+    for (uint32_t depth : {8u, 16u, 32u, 60u})
+    {
+        LplaStreamStats stats;
+        RunStream(depth, 3600, BurstyPattern(), stats);
+        ASSERT_GT(stats.results, 0u);
+
+        double mean = (double)stats.latencySum / stats.results;
+        printf("%-10u %10u %10u %10u %10.1f %10u %12.1f\n",
+            depth, stats.results, stats.dropped, stats.latencyMin, mean, stats.latencyMax, mean * 1000.0 / 30);
+    }
+}
+
+TEST_F(VdencLplaAnalysisTest, DISABLED_PerfLookaheadFrame)
+{
+    // Driver work of the lookahead records per lookahead pass frame: Update, the LA
+    // update DMEM, retiring the record, and parsing the status report of 2 frames ago
+    uint32_t loops = HalTestPerfLoops(1000000);
+    for (uint32_t depth : {8u, 16u, 32u, 60u})
+    {
+        LplaTestAnalysis analysis(&m_allocator, &m_basicFeature);
+        uint32_t         frame = 0;
+        m_seqParams.LookaheadDepth = (uint8_t)depth;
+
+        string name = "lpla.FRAME_DEPTH_" + to_string(depth);
+        EXPECT_TRUE(HalTestMeasure(name.c_str(), loops, [&]() {
+            bool laInit = false;
+            EncodeFrame(analysis, frame, laInit);
+            if (frame >= 2)
+            {
+                ParseReport(analysis, frame - 2);
+            }
+            frame++;
+            return !HasFailure();
+        }));
+    }
+}
@@ -0,0 +1,416 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_encode_packer.cpp
+//! \brief    Unit tests of the cached encode header packers.
+//! \details  The cached HEVC slice header and AVC picture header packers must be
+//!           bit-exact with the uncached ones. BitstreamWriter::PutBitsBuffer, which
+//!           the HEVC packer uses to append cached parts, is checked against per-bit
+//!           writes for every bit offset.
+//!
+#include <string.h>
+#include <vector>
+#include "hal_test.h"
+#include "mos_utilities.h"
+#include "encode_hevc_header_packer.h"
+#include "encode_avc_header_packer.h"
+
+using namespace std;
+using namespace encode;
+
+static const uint32_t HAL_TEST_HEVC_SLICES    = 8;
+static const uint32_t HAL_TEST_PACKER_BS_SIZE = 4096;
+
+class EncodeHeaderPackerTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        InitHevc();
+        InitAvc();
+    }
+
+    virtual void TearDown() { }
+
+    void InitHevc()
+    {
+        // 1080p HEVC, 64x64 CTB, B frame split into 8 slices; one dependent slice segment
+        // and a QP change in the second half so the cached path sees both hits and misses
+        CODEC_HEVC_ENCODE_SEQUENCE_PARAMS &seq = m_hevcSeq;
+        seq.log2_min_coding_block_size_minus3  = 0;
+        seq.log2_max_coding_block_size_minus3  = 3;
+        seq.wFrameWidthInMinCbMinus1           = 1920 / 8 - 1;
+        seq.wFrameHeightInMinCbMinus1          = 1080 / 8 - 1;
+        seq.sps_temporal_mvp_enable_flag       = 1;
+        seq.SAO_enabled_flag                   = 1;
+        seq.chroma_format_idc                  = 1;
+
+        CODEC_HEVC_ENCODE_PICTURE_PARAMS &pic     = m_hevcPic;
+        pic.nal_unit_type                         = TRAIL_R;
+        pic.CurrPicOrderCnt                       = 21;
+        pic.CollocatedRefPicIndex                 = 0;
+        pic.dependent_slice_segments_enabled_flag = 1;
+        pic.loop_filter_across_slices_flag        = 1;
+
+        uint32_t ctbCount = (1920 / 64) * ((1080 + 63) / 64);
+        for (uint32_t i = 0; i < HAL_TEST_HEVC_SLICES; i++)
+        {
+            CODEC_HEVC_ENCODE_SLICE_PARAMS &slice = m_hevcSlices[i];
+            slice.slice_segment_address           = i * ctbCount / HAL_TEST_HEVC_SLICES;
+            slice.dependent_slice_segment_flag    = (i == 3);
+            slice.slice_type                      = 0;
+            slice.slice_temporal_mvp_enable_flag  = 1;
+            slice.slice_sao_luma_flag             = 1;
+            slice.slice_sao_chroma_flag           = 1;
+            slice.collocated_from_l0_flag         = 1;
+            slice.num_ref_idx_l0_active_minus1    = 1;
+            slice.num_ref_idx_l1_active_minus1    = 0;
+            slice.MaxNumMergeCand                 = 5;
+            slice.slice_qp_delta                  = (i < HAL_TEST_HEVC_SLICES / 2) ? -3 : 2;
+        }
+
+        CodecEncodeHevcSliceHeaderParams &sh = m_hevcSliceHeader;
+        sh.log2_max_pic_order_cnt_lsb_minus4 = 4;
+        sh.num_negative_pics                 = 2;
+        sh.num_positive_pics                 = 1;
+        sh.delta_poc_minus1[0][0]            = 0;
+        sh.delta_poc_minus1[0][1]            = 3;
+        sh.delta_poc_minus1[1][0]            = 1;
+        sh.used_by_curr_pic_flag[0][0]       = true;
+        sh.used_by_curr_pic_flag[0][1]       = true;
+        sh.used_by_curr_pic_flag[1][0]       = true;
+    }
+
+    void InitAvc()
+    {
+        // High profile AVC with VUI/HRD and a sequence scaling matrix, padded 1080p
+        CODEC_AVC_ENCODE_SEQUENCE_PARAMS &seq = m_avcSeq;
+        seq.Profile                           = CODEC_AVC_HIGH_PROFILE;
+        seq.Level                             = CODEC_AVC_LEVEL_41;
+        seq.NumRefFrames                      = 2;
+        seq.chroma_format_idc                 = 1;
+        seq.log2_max_frame_num_minus4         = 4;
+        seq.log2_max_pic_order_cnt_lsb_minus4 = 6;
+        seq.pic_width_in_mbs_minus1           = 1920 / 16 - 1;
+        seq.pic_height_in_map_units_minus1    = 1088 / 16 - 1;
+        seq.frame_mbs_only_flag               = 1;
+        seq.direct_8x8_inference_flag         = 1;
+        seq.vui_parameters_present_flag       = 1;
+        seq.seq_scaling_matrix_present_flag   = 1;
+        seq.seq_scaling_list_present_flag[0]  = 1;
+        seq.seq_scaling_list_present_flag[6]  = 1;
+
+        CODECHAL_ENCODE_AVC_VUI_PARAMS &vui         = m_avcVui;
+        vui.aspect_ratio_info_present_flag          = 1;
+        vui.aspect_ratio_idc                        = 1;
+        vui.timing_info_present_flag                = 1;
+        vui.num_units_in_tick                       = 1001;
+        vui.time_scale                              = 60000;
+        vui.fixed_frame_rate_flag                   = 1;
+        vui.nal_hrd_parameters_present_flag         = 1;
+        vui.bit_rate_scale                          = 4;
+        vui.cpb_size_scale                          = 6;
+        vui.bit_rate_value_minus1[0]                = 15624;
+        vui.cpb_size_value_minus1[0]                = 31249;
+        vui.initial_cpb_removal_delay_length_minus1 = 23;
+        vui.cpb_removal_delay_length_minus1         = 23;
+        vui.dpb_output_delay_length_minus1          = 23;
+        vui.time_offset_length                      = 24;
+        vui.bitstream_restriction_flag              = 1;
+        vui.motion_vectors_over_pic_boundaries_flag = 1;
+        vui.log2_max_mv_length_horizontal           = 15;
+        vui.log2_max_mv_length_vertical             = 15;
+        vui.max_dec_frame_buffering                 = 2;
+
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            m_avcIqMatrix.ScalingList4x4[0][i] = (uint8_t)(6 + i);
+        }
+        for (uint32_t i = 0; i < 64; i++)
+        {
+            m_avcIqMatrix.ScalingList8x8[0][i] = (uint8_t)(6 + i / 2);
+        }
+
+        CODEC_AVC_ENCODE_PIC_PARAMS &pic           = m_avcPic;
+        pic.entropy_coding_mode_flag               = 1;
+        pic.num_ref_idx_l0_active_minus1           = 1;
+        pic.weighted_bipred_idc                    = 2;
+        pic.pic_init_qp_minus26                    = -4;
+        pic.chroma_qp_index_offset                 = -1;
+        pic.second_chroma_qp_index_offset          = -1;
+        pic.deblocking_filter_control_present_flag = true;
+        pic.transform_8x8_mode_flag                = 1;
+        pic.CodingType                             = I_TYPE;
+
+        for (uint32_t i = 0; i < CODECHAL_ENCODE_AVC_MAX_NAL_TYPE; i++)
+        {
+            m_avcNalUnitPtrs[i] = &m_avcNalUnits[i];
+        }
+    }
+
+    MOS_STATUS PackHevcSliceHeaders(HevcHeaderPacker &hevcPacker)
+    {
+        MOS_ZeroMemory(m_hevcBs, sizeof(m_hevcBs));
+        MOS_ZeroMemory(m_hevcSlcData, sizeof(m_hevcSlcData));
+        m_hevcBsBuffer.pBase      = m_hevcBs;
+        m_hevcBsBuffer.pCurrent   = m_hevcBs;
+        m_hevcBsBuffer.BufferSize = sizeof(m_hevcBs);
+
+        EncoderParams params;
+        params.pSeqParams         = &m_hevcSeq;
+        params.pPicParams         = &m_hevcPic;
+        params.pSliceParams       = m_hevcSlices;
+        params.pSliceHeaderParams = &m_hevcSliceHeader;
+        params.pSlcHeaderData     = m_hevcSlcData;
+        params.pBSBuffer          = &m_hevcBsBuffer;
+        params.dwNumSlices        = HAL_TEST_HEVC_SLICES;
+
+        return hevcPacker.SliceHeaderPacker(&params);
+    }
+
+    //!
+    //! \brief  Pack one AVC picture header
+    //! \details New sequence every 4th frame, PPS QP change every 8th frame.
+    //! \param  [in] avcPacker
+    //!         Cached packer, nullptr for the uncached AvcEncodeHeaderPacker::PackPictureHeader
+    //! \param  [in] frame
+    //!         Frame number
+    //! \return MOS_STATUS
+    //!
+    MOS_STATUS PackAvcPictureHeader(AvcEncodeHeaderPacker *avcPacker, uint32_t frame)
+    {
+        m_avcPic.pic_init_qp_minus26 = (frame & 8) ? -2 : -4;
+        m_avcPic.frame_num           = (uint16_t)frame;
+
+        MOS_ZeroMemory(m_avcBs, sizeof(m_avcBs));
+        m_avcBsBuffer             = {};
+        m_avcBsBuffer.pBase       = m_avcBs;
+        m_avcBsBuffer.BufferSize  = sizeof(m_avcBs);
+        m_avcNewPpsHeader         = false;
+        m_avcNewSeqHeader         = false;
+
+        CODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params = {};
+        params.pBsBuffer          = &m_avcBsBuffer;
+        params.pPicParams         = &m_avcPic;
+        params.pSeqParams         = &m_avcSeq;
+        params.pAvcVuiParams      = &m_avcVui;
+        params.pAvcIQMatrixParams = &m_avcIqMatrix;
+        params.ppNALUnitParams    = m_avcNalUnitPtrs;
+        params.pSeiData           = &m_avcSei;
+        params.dwFrameHeight      = 1088;
+        params.dwOriFrameHeight   = 1080;
+        params.wPictureCodingType = m_avcPic.CodingType;
+        params.bNewSeq            = (frame % 4 == 0);
+        params.pbNewPPSHeader     = &m_avcNewPpsHeader;
+        params.pbNewSeqHeader     = &m_avcNewSeqHeader;
+
+        return avcPacker ? avcPacker->PackPictureHeaderCached(&params) : AvcEncodeHeaderPacker::PackPictureHeader(&params);
+    }
+
+    CODEC_HEVC_ENCODE_SEQUENCE_PARAMS m_hevcSeq                             = {};
+    CODEC_HEVC_ENCODE_PICTURE_PARAMS  m_hevcPic                             = {};
+    CODEC_HEVC_ENCODE_SLICE_PARAMS    m_hevcSlices[HAL_TEST_HEVC_SLICES]    = {};
+    CodecEncodeHevcSliceHeaderParams  m_hevcSliceHeader                     = {};
+    CODEC_ENCODER_SLCDATA             m_hevcSlcData[HAL_TEST_HEVC_SLICES]   = {};
+    BSBuffer                          m_hevcBsBuffer                        = {};
+    uint8_t                           m_hevcBs[HAL_TEST_PACKER_BS_SIZE]     = {};
+
+    CODEC_AVC_ENCODE_SEQUENCE_PARAMS  m_avcSeq                                          = {};
+    CODEC_AVC_ENCODE_PIC_PARAMS       m_avcPic                                          = {};
+    CODECHAL_ENCODE_AVC_VUI_PARAMS    m_avcVui                                          = {};
+    CODEC_AVC_IQ_MATRIX_PARAMS        m_avcIqMatrix                                     = {};
+    CodechalEncodeSeiData             m_avcSei                                          = {};
+    CODECHAL_NAL_UNIT_PARAMS          m_avcNalUnits[CODECHAL_ENCODE_AVC_MAX_NAL_TYPE]    = {};
+    PCODECHAL_NAL_UNIT_PARAMS         m_avcNalUnitPtrs[CODECHAL_ENCODE_AVC_MAX_NAL_TYPE] = {};
+    BSBuffer                          m_avcBsBuffer                                     = {};
+    uint8_t                           m_avcBs[HAL_TEST_PACKER_BS_SIZE]                  = {};
+    bool                              m_avcNewPpsHeader                                 = false;
+    bool                              m_avcNewSeqHeader                                 = false;
+};
+
+TEST_F(EncodeHeaderPackerTest, PutBitsBufferMatchesPutBit)
+{
+    uint8_t src[64];
+    for (uint32_t i = 0; i < sizeof(src); i++)
+    {
+        src[i] = (uint8_t)(i * 167 + 13);
+    }
+
+    for (uint32_t dstOffset = 0; dstOffset < 8; dstOffset++)
+    {
+        for (uint32_t srcOffset = 0; srcOffset < 8; srcOffset++)
+        {
+            for (uint32_t n = 0; n <= 8 * (sizeof(src) - 1); n += (n < 40) ? 1 : 7)
+            {
+                uint8_t         refBuf[80] = {};
+                uint8_t         outBuf[80] = {};
+                BitstreamWriter ref(refBuf, sizeof(refBuf));
+                BitstreamWriter out(outBuf, sizeof(outBuf));
+
+                ref.PutBits(dstOffset + 1, 0x15);
+                out.PutBits(dstOffset + 1, 0x15);
+                for (uint32_t bit = srcOffset; bit < srcOffset + n; bit++)
+                {
+                    ref.PutBit((src[bit >> 3] >> (7 - (bit & 7))) & 1);
+                }
+                out.PutBitsBuffer(n, src, srcOffset);
+                ref.PutTrailingBits();
+                out.PutTrailingBits();
+
+                ASSERT_EQ(ref.GetOffset(), out.GetOffset())
+                    << "dst offset " << dstOffset + 1 << ", src offset " << srcOffset << ", " << n << " bits";
+                ASSERT_EQ(0, memcmp(refBuf, outBuf, sizeof(refBuf)))
+                    << "dst offset " << dstOffset + 1 << ", src offset " << srcOffset << ", " << n << " bits";
+            }
+        }
+    }
+}
+
+TEST_F(EncodeHeaderPackerTest, HevcCachedSliceHeadersMatchUncached)
+{
+    // The cached packer lives across frames like the one of the HEVC basic feature does,
+    // the slice QPs and types change between frames
+    HevcHeaderPacker cachedPacker;
+    for (uint32_t frame = 0; frame < 8; frame++)
+    {
+        for (uint32_t i = 0; i < HAL_TEST_HEVC_SLICES; i++)
+        {
+            m_hevcSlices[i].slice_qp_delta = (char)((i < HAL_TEST_HEVC_SLICES / 2) ? -3 : (int)(frame & 3));
+            m_hevcSlices[i].slice_type     = (frame & 4) ? 1 : 0;
+        }
+        m_hevcPic.CurrPicOrderCnt = 21 + frame;
+
+        HevcHeaderPacker refPacker;
+        refPacker.m_bSSHCacheEnabled = false;
+        ASSERT_EQ(MOS_STATUS_SUCCESS, PackHevcSliceHeaders(refPacker));
+        vector<uint8_t>       refBs(m_hevcBs, m_hevcBs + sizeof(m_hevcBs));
+        CODEC_ENCODER_SLCDATA refSlcData[HAL_TEST_HEVC_SLICES];
+        MOS_SecureMemcpy(refSlcData, sizeof(refSlcData), m_hevcSlcData, sizeof(m_hevcSlcData));
+
+        ASSERT_EQ(MOS_STATUS_SUCCESS, PackHevcSliceHeaders(cachedPacker));
+        EXPECT_EQ(0, memcmp(refBs.data(), m_hevcBs, sizeof(m_hevcBs))) << "frame " << frame;
+        EXPECT_EQ(0, memcmp(refSlcData, m_hevcSlcData, sizeof(refSlcData))) << "frame " << frame;
+    }
+}
+
+TEST_F(EncodeHeaderPackerTest, AvcCachedPictureHeadersMatchUncached)
+{
+    AvcEncodeHeaderPacker cachedPacker;
+    for (uint32_t frame = 0; frame < 32; frame++)
+    {
+        // Both packers update the cropping fields of the sequence params, so each starts from the same copy
+        auto seqBefore = m_avcSeq;
+
+        ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(nullptr, frame));
+        vector<uint8_t>          refBs(m_avcBs, m_avcBs + m_avcBsBuffer.SliceOffset);
+        CODECHAL_NAL_UNIT_PARAMS refNalUnits[CODECHAL_ENCODE_AVC_MAX_NAL_TYPE];
+        MOS_SecureMemcpy(refNalUnits, sizeof(refNalUnits), m_avcNalUnits, sizeof(m_avcNalUnits));
+        auto refSeq    = m_avcSeq;
+        bool refNewPps = m_avcNewPpsHeader;
+        bool refNewSeq = m_avcNewSeqHeader;
+
+        m_avcSeq = seqBefore;
+        ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(&cachedPacker, frame));
+
+        ASSERT_EQ(refBs.size(), m_avcBsBuffer.SliceOffset) << "frame " << frame;
+        EXPECT_EQ(0, memcmp(refBs.data(), m_avcBs, refBs.size())) << "frame " << frame;
+        EXPECT_EQ(0, memcmp(refNalUnits, m_avcNalUnits, sizeof(refNalUnits))) << "frame " << frame;
+        EXPECT_EQ(refSeq.frame_cropping_flag, m_avcSeq.frame_cropping_flag) << "frame " << frame;
+        EXPECT_EQ(refSeq.frame_crop_bottom_offset, m_avcSeq.frame_crop_bottom_offset) << "frame " << frame;
+        EXPECT_EQ(refNewPps, m_avcNewPpsHeader) << "frame " << frame;
+        EXPECT_EQ(refNewSeq, m_avcNewSeqHeader) << "frame " << frame;
+    }
+}
+
+TEST_F(EncodeHeaderPackerTest, AvcSpsCacheIgnoresRateControlChanges)
+{
+    // Exposes the cached SPS NAL unit so a hit can be told from a repack
+    class CachedPacker : public AvcEncodeHeaderPacker
+    {
+    public:
+        vector<uint8_t> &SpsNalUnit() { return m_spsCache.nalUnit; }
+    };
+
+    CachedPacker cachedPacker;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(&cachedPacker, 0));
+    ASSERT_FALSE(cachedPacker.SpsNalUnit().empty());
+
+    // Marks the cached NAL unit, a hit copies the mark into the bitstream
+    cachedPacker.SpsNalUnit().back() ^= 0x01;
+    vector<uint8_t> marked = cachedPacker.SpsNalUnit();
+
+    m_avcSeq.RateControlMethod          = RATECONTROL_VBR;
+    m_avcSeq.TargetBitRate              = 4000000;
+    m_avcSeq.MaxBitRate                 = 8000000;
+    m_avcSeq.VBVBufferSizeInBit         = 8000000;
+    m_avcSeq.InitVBVBufferFullnessInBit = 4000000;
+    m_avcSeq.FramesPer100Sec            = 3000;
+    m_avcSeq.GopPicSize                 = 60;
+    m_avcSeq.TargetUsage                = 7;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(&cachedPacker, 4));
+    const CODECHAL_NAL_UNIT_PARAMS &sps = m_avcNalUnits[1];
+    ASSERT_EQ(CODECHAL_ENCODE_AVC_NAL_UT_SPS, sps.uiNalUnitType);
+    ASSERT_EQ(marked.size(), sps.uiSize);
+    EXPECT_EQ(0, memcmp(marked.data(), m_avcBs + sps.uiOffset, marked.size()));
+
+    // A field the SPS is packed from repacks it
+    m_avcSeq.Level = CODEC_AVC_LEVEL_42;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(nullptr, 8));
+    vector<uint8_t> refSps(m_avcBs + sps.uiOffset, m_avcBs + sps.uiOffset + sps.uiSize);
+    ASSERT_EQ(MOS_STATUS_SUCCESS, PackAvcPictureHeader(&cachedPacker, 8));
+    ASSERT_EQ(refSps.size(), sps.uiSize);
+    EXPECT_EQ(0, memcmp(refSps.data(), m_avcBs + sps.uiOffset, refSps.size()));
+}
+
+TEST_F(EncodeHeaderPackerTest, DISABLED_PerfHevcSliceHeaders)
+{
+    uint32_t loops = HalTestPerfLoops(100000);
+
+    // One HEVC frame of slice headers per iteration
+    EXPECT_TRUE(HalTestMeasure("packer.HEVC_SSH_8_SLICES", loops, [&]() {
+        HevcHeaderPacker hevcPacker;
+        hevcPacker.m_bSSHCacheEnabled = false;
+        return PackHevcSliceHeaders(hevcPacker) == MOS_STATUS_SUCCESS;
+    }));
+
+    EXPECT_TRUE(HalTestMeasure("packer.HEVC_SSH_8_SLICES_CACHED", loops, [&]() {
+        HevcHeaderPacker hevcPacker;
+        return PackHevcSliceHeaders(hevcPacker) == MOS_STATUS_SUCCESS;
+    }));
+}
+
+TEST_F(EncodeHeaderPackerTest, DISABLED_PerfAvcPictureHeader)
+{
+    uint32_t              loops = HalTestPerfLoops(100000);
+    uint32_t              frame = 0;
+    AvcEncodeHeaderPacker avcPacker;
+
+    // One AVC picture header per iteration, SPS every 4th frame
+    EXPECT_TRUE(HalTestMeasure("packer.AVC_PIC_HEADER", loops, [&]() {
+        return PackAvcPictureHeader(nullptr, frame++) == MOS_STATUS_SUCCESS;
+    }));
+
+    frame = 0;
+    EXPECT_TRUE(HalTestMeasure("packer.AVC_PIC_HEADER_CACHED", loops, [&]() {
+        return PackAvcPictureHeader(&avcPacker, frame++) == MOS_STATUS_SUCCESS;
+    }));
+}
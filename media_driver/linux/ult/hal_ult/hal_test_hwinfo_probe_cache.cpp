@@ -0,0 +1,185 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_hwinfo_probe_cache.cpp
+//! \brief    Unit tests of the device probe cache.
+//! \details  The cache only holds platform and system info queried from KMD.
+//!           Sku/Wa tables read user settings, so they must follow a changed
+//!           setting also when the device info comes from the cache.
+//!
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+#include "hal_test.h"
+#include "hwinfo_linux.h"
+#include "linux_media_skuwa.h"
+#include "skuwa_factory.h"
+#include "media_user_setting.h"
+
+using namespace std;
+
+#define HAL_TEST_PROBE_PRODUCT  0x7ff0  //!< Product family not used by any device
+
+static const char *s_compressibleSetting = "Hal Ult Enable Compressible Surface Creation";
+
+//!
+//! \brief  Sku init of a fake device, reads a user setting as MTL does
+//!
+static bool HalTestInitMediaFeature(GfxDeviceInfo *devInfo, MediaFeatureTable *skuTable, LinuxDriverInfo *drvInfo, MediaUserSettingSharedPtr userSettingPtr)
+{
+    bool compressibleSurfaceEnable = false;
+    ReadUserSetting(userSettingPtr,
+        compressibleSurfaceEnable,
+        s_compressibleSetting,
+        MediaUserSetting::Group::Device);
+    MEDIA_WR_SKU(skuTable, FtrCompressibleSurfaceDefault, compressibleSurfaceEnable ? 1 : 0);
+    return true;
+}
+
+static bool HalTestInitMediaWa(GfxDeviceInfo *devInfo, MediaWaTable *waTable, LinuxDriverInfo *drvInfo)
+{
+    return true;
+}
+
+static LinuxDeviceInit s_halTestDeviceInit = {HAL_TEST_PROBE_PRODUCT, HalTestInitMediaFeature, HalTestInitMediaWa};
+
+class HWInfoProbeCacheTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        DeviceInfoFactory<LinuxDeviceInit>::RegisterDevice(HAL_TEST_PROBE_PRODUCT, &s_halTestDeviceInit);
+
+        m_fileName = "/tmp/hal_ult_probe_" + to_string(getpid()) + ".bin";
+        remove(m_fileName.c_str());
+
+        m_drvInfo.euCount       = 96;
+        m_drvInfo.subSliceCount = 6;
+        m_drvInfo.sliceCount    = 1;
+        m_drvInfo.devId         = 0x7d55;
+        m_drvInfo.devRev        = 3;
+        m_drvInfo.hasBsd        = 1;
+        m_drvInfo.hasVebox      = 1;
+        m_drvInfo.hasHuc        = 1;
+
+        m_devInfo.productFamily = HAL_TEST_PROBE_PRODUCT;
+
+        m_platform.eProductFamily = (PRODUCT_FAMILY)HAL_TEST_PROBE_PRODUCT;
+        m_platform.usDeviceID     = m_drvInfo.devId;
+        m_platform.usRevId        = m_drvInfo.devRev;
+        m_systemInfo.EUCount      = m_drvInfo.euCount;
+        m_systemInfo.SliceCount   = m_drvInfo.sliceCount;
+        m_systemInfo.VDBoxInfo.NumberOfVDBoxEnabled = 2;
+    }
+
+    void TearDown() override
+    {
+        remove(m_fileName.c_str());
+    }
+
+    string            m_fileName;
+    LinuxDriverInfo   m_drvInfo    = {};
+    GfxDeviceInfo     m_devInfo    = {};
+    PLATFORM          m_platform   = {};
+    MEDIA_SYSTEM_INFO m_systemInfo = {};
+};
+
+TEST_F(HWInfoProbeCacheTest, StoreAndLoad)
+{
+    ASSERT_TRUE(HWInfo_StoreProbeCache(m_fileName, m_drvInfo, &m_platform, &m_systemInfo));
+
+    PLATFORM          platform   = {};
+    MEDIA_SYSTEM_INFO systemInfo = {};
+    ASSERT_TRUE(HWInfo_LoadProbeCache(m_fileName, m_drvInfo, &platform, &systemInfo));
+    EXPECT_EQ(0, memcmp(&platform, &m_platform, sizeof(platform)));
+    EXPECT_EQ(0, memcmp(&systemInfo, &m_systemInfo, sizeof(systemInfo)));
+}
+
+TEST_F(HWInfoProbeCacheTest, MissOnDriverInfoChange)
+{
+    ASSERT_TRUE(HWInfo_StoreProbeCache(m_fileName, m_drvInfo, &m_platform, &m_systemInfo));
+
+    PLATFORM          platform   = {};
+    MEDIA_SYSTEM_INFO systemInfo = {};
+    LinuxDriverInfo   drvInfo    = m_drvInfo;
+    drvInfo.devRev++;
+    EXPECT_FALSE(HWInfo_LoadProbeCache(m_fileName, drvInfo, &platform, &systemInfo));
+
+    drvInfo = m_drvInfo;
+    drvInfo.hasBsd2 = 1;
+    EXPECT_FALSE(HWInfo_LoadProbeCache(m_fileName, drvInfo, &platform, &systemInfo));
+
+    drvInfo = m_drvInfo;
+    drvInfo.euCount /= 2;
+    EXPECT_FALSE(HWInfo_LoadProbeCache(m_fileName, drvInfo, &platform, &systemInfo));
+}
+
+TEST_F(HWInfoProbeCacheTest, MissOnCorruptedFile)
+{
+    ASSERT_TRUE(HWInfo_StoreProbeCache(m_fileName, m_drvInfo, &m_platform, &m_systemInfo));
+
+    // Flip the last byte of payload
+    FILE *file = fopen(m_fileName.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    ASSERT_EQ(0, fseek(file, -1, SEEK_END));
+    int value = fgetc(file);
+    ASSERT_EQ(0, fseek(file, -1, SEEK_END));
+    fputc(value ^ 0xff, file);
+    fclose(file);
+
+    PLATFORM          platform   = {};
+    MEDIA_SYSTEM_INFO systemInfo = {};
+    EXPECT_FALSE(HWInfo_LoadProbeCache(m_fileName, m_drvInfo, &platform, &systemInfo));
+
+    // Truncated file
+    file = fopen(m_fileName.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    fputc(0, file);
+    fclose(file);
+    EXPECT_FALSE(HWInfo_LoadProbeCache(m_fileName, m_drvInfo, &platform, &systemInfo));
+}
+
+TEST_F(HWInfoProbeCacheTest, SkuFollowsUserSettingOnCacheHit)
+{
+    MediaUserSettingSharedPtr userSetting = std::make_shared<MediaUserSetting::MediaUserSetting>();
+    // Item is read from the path Write goes to, so a write changes it as an external writer would
+    ASSERT_EQ(MOS_STATUS_SUCCESS, DeclareUserSettingKey(userSetting, s_compressibleSetting, MediaUserSetting::Group::Device, 0, false, true, USER_SETTING_REPORT_PATH));
+
+    // First open probes the device and stores the cache
+    MediaFeatureTable skuTable;
+    MediaWaTable      waTable;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, HWInfo_InitSkuWa(nullptr, &m_devInfo, &m_drvInfo, &m_platform, &skuTable, &waTable, userSetting));
+    EXPECT_FALSE(MEDIA_IS_SKU(&skuTable, FtrCompressibleSurfaceDefault));
+    ASSERT_TRUE(HWInfo_StoreProbeCache(m_fileName, m_drvInfo, &m_platform, &m_systemInfo));
+
+    // Setting is changed between two opens
+    ASSERT_EQ(MOS_STATUS_SUCCESS, WriteUserSetting(userSetting, s_compressibleSetting, 1, MediaUserSetting::Group::Device));
+
+    // Second open hits the cache, Sku must follow the new setting
+    PLATFORM          platform   = {};
+    MEDIA_SYSTEM_INFO systemInfo = {};
+    ASSERT_TRUE(HWInfo_LoadProbeCache(m_fileName, m_drvInfo, &platform, &systemInfo));
+    MediaFeatureTable cachedSkuTable;
+    MediaWaTable      cachedWaTable;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, HWInfo_InitSkuWa(nullptr, &m_devInfo, &m_drvInfo, &platform, &cachedSkuTable, &cachedWaTable, userSetting));
+    EXPECT_TRUE(MEDIA_IS_SKU(&cachedSkuTable, FtrCompressibleSurfaceDefault));
+}
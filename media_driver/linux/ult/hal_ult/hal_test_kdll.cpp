@@ -0,0 +1,247 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_kdll.cpp
+//! \brief    Unit tests of the kernel DLL CSC/procamp coefficient cache.
+//! \details  Runs the CSC setup of a 16 layer composition (two 8 layer phases plus
+//!           the render target) on a Kdll_State using the coefficient cache and on
+//!           one whose cache is flushed before every call, and checks both produce
+//!           the same CSC matrices.
+//!
+#include <memory>
+#include "hal_test.h"
+#include "mos_utilities.h"
+#include "hal_kerneldll_next.h"
+
+using namespace std;
+
+//!
+//! \brief  Kernel DLL state of one composition CSC setup
+//!
+struct KdllCscTestState
+{
+    Kdll_State       state;
+    Kdll_SearchState searchState;
+    Kdll_Procamp     procamp;
+};
+
+class KdllCscCacheTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        static const VPHAL_CSPACE subCspace[] = {CSpace_BT709, CSpace_sRGB, CSpace_BT601, CSpace_stRGB};
+
+        MOS_ZeroMemory(m_layers, sizeof(m_layers));
+        for (int phase = 0; phase < 2; phase++)
+        {
+            Kdll_FilterEntry *layer = m_layers[phase];
+            for (int i = 0; i < 8; i++, layer++)
+            {
+                bool mainVideo = (phase == 0 && i == 0);
+                layer->layer   = mainVideo ? Layer_MainVideo : Layer_SubVideo;
+                layer->format  = mainVideo ? Format_NV12 : Format_A8R8G8B8;
+                layer->cspace  = mainVideo ? CSpace_BT601 : subCspace[i % 4];
+                layer->sampler = Sample_Scaling;
+                layer->process = Process_Composite;
+                layer->procamp = mainVideo ? 0 : DL_PROCAMP_DISABLED;
+                layer->matrix  = DL_CSC_DISABLED;
+            }
+            layer->layer   = Layer_RenderTarget;
+            layer->format  = Format_A8R8G8B8;
+            layer->cspace  = CSpace_sRGB;
+            layer->procamp = DL_PROCAMP_DISABLED;
+            layer->matrix  = DL_CSC_DISABLED;
+            m_layerCount[phase] = 9;
+        }
+
+        m_cached.reset(new KdllCscTestState());
+        m_uncached.reset(new KdllCscTestState());
+        InitState(*m_cached);
+        InitState(*m_uncached);
+    }
+
+    virtual void TearDown() { }
+
+    static void InitState(KdllCscTestState &kdll)
+    {
+        kdll.state.pfnMapCSCMatrix = KernelDll_MapCSCMatrix;
+        kdll.procamp.bEnabled      = true;
+        kdll.procamp.fBrightness   = 10.0f;
+        kdll.procamp.fContrast     = 1.2f;
+        kdll.procamp.fHue          = 5.0f;
+        kdll.procamp.fSaturation   = 1.1f;
+        KernelDll_SetupProcampParameters(&kdll.state, &kdll.procamp, DL_PROCAMP_MAX);
+    }
+
+    static void SetProcamp(KdllCscTestState &kdll, float brightness, float hue)
+    {
+        if (kdll.procamp.fBrightness != brightness || kdll.procamp.fHue != hue)
+        {
+            kdll.procamp.fBrightness = brightness;
+            kdll.procamp.fHue        = hue;
+            kdll.procamp.iProcampVersion++;
+        }
+    }
+
+    //!
+    //! \brief  Run CSC setup of one composition phase
+    //! \param  [in] kdll
+    //!         Kernel DLL state
+    //! \param  [in] phase
+    //!         Composition phase, 0 or 1
+    //! \param  [in] flushCache
+    //!         Drop all cached coefficients first, so every matrix is computed
+    //! \return bool
+    //!
+    bool SetupCsc(KdllCscTestState &kdll, int phase, bool flushCache)
+    {
+        if (flushCache)
+        {
+            MOS_ZeroMemory(&kdll.state.CscCoeffCache, sizeof(kdll.state.CscCoeffCache));
+        }
+
+        // SetupCSC updates the filter in place, so start every phase from the original layers
+        MOS_SecureMemcpy(kdll.searchState.Filter, sizeof(kdll.searchState.Filter), m_layers[phase], sizeof(m_layers[phase]));
+        kdll.searchState.iFilterSize = m_layerCount[phase];
+        kdll.searchState.pKdllState  = &kdll.state;
+        return KernelDll_SetupCSC(&kdll.state, &kdll.searchState);
+    }
+
+    static void ExpectSameCsc(const Kdll_SearchState &cached, const Kdll_SearchState &uncached)
+    {
+        const Kdll_CSC_Params &a = cached.CscParams;
+        const Kdll_CSC_Params &b = uncached.CscParams;
+
+        EXPECT_EQ(b.ColorSpace, a.ColorSpace);
+        EXPECT_EQ(b.PatchMatrixNum, a.PatchMatrixNum);
+        for (int m = 0; m < DL_CSC_MAX; m++)
+        {
+            EXPECT_EQ(b.MatrixID[m], a.MatrixID[m]);
+            EXPECT_EQ(b.Matrix[m].bInUse, a.Matrix[m].bInUse);
+            if (!b.Matrix[m].bInUse)
+            {
+                continue;
+            }
+            EXPECT_EQ(b.Matrix[m].SrcSpace, a.Matrix[m].SrcSpace);
+            EXPECT_EQ(b.Matrix[m].DstSpace, a.Matrix[m].DstSpace);
+            EXPECT_EQ(b.Matrix[m].iProcampID, a.Matrix[m].iProcampID);
+            EXPECT_EQ(b.Matrix[m].iProcampVersion, a.Matrix[m].iProcampVersion);
+            for (int i = 0; i < 12; i++)
+            {
+                EXPECT_EQ(b.Matrix[m].Coeff[i], a.Matrix[m].Coeff[i]) << "matrix " << m << " coefficient " << i;
+            }
+        }
+
+        ASSERT_EQ(uncached.iFilterSize, cached.iFilterSize);
+        for (int i = 0; i < cached.iFilterSize; i++)
+        {
+            EXPECT_EQ(uncached.Filter[i].matrix, cached.Filter[i].matrix) << "layer " << i;
+        }
+    }
+
+    Kdll_FilterEntry             m_layers[2][DL_MAX_SEARCH_FILTER_SIZE];  //!< 8 layers + render target per phase
+    int                          m_layerCount[2] = {};
+    unique_ptr<KdllCscTestState> m_cached;
+    unique_ptr<KdllCscTestState> m_uncached;
+};
+
+TEST_F(KdllCscCacheTest, CachedMatchesRecomputed)
+{
+    // Procamp changes every 4th frame, so most frames hit the cache
+    for (uint32_t frame = 0; frame < 64; frame++)
+    {
+        float brightness = 10.0f + (float)(frame / 4);
+        float hue        = (frame & 16) ? -5.0f : 5.0f;
+        SetProcamp(*m_cached, brightness, hue);
+        SetProcamp(*m_uncached, brightness, hue);
+
+        for (int phase = 0; phase < 2; phase++)
+        {
+            ASSERT_TRUE(SetupCsc(*m_cached, phase, false));
+            ASSERT_TRUE(SetupCsc(*m_uncached, phase, true));
+            ExpectSameCsc(m_cached->searchState, m_uncached->searchState);
+        }
+    }
+
+    EXPECT_GT(m_cached->state.CscCoeffCache.uiHits, 0u);
+}
+
+TEST_F(KdllCscCacheTest, ProcampAppliedOnlyToProcampLayer)
+{
+    // The main video and a sub video layer convert BT601 -> sRGB, only the main video applies procamp.
+    // Cached coefficients of one must never be returned for the other.
+    m_layers[0][2].cspace = CSpace_BT601;
+    m_layers[0][2].format = Format_NV12;
+
+    for (uint32_t frame = 0; frame < 8; frame++)
+    {
+        m_layers[0][0].procamp = (frame & 1) ? DL_PROCAMP_DISABLED : 0;
+        ASSERT_TRUE(SetupCsc(*m_cached, 0, false));
+        ASSERT_TRUE(SetupCsc(*m_uncached, 0, true));
+        ExpectSameCsc(m_cached->searchState, m_uncached->searchState);
+    }
+}
+
+TEST_F(KdllCscCacheTest, EvictedEntriesRecomputed)
+{
+    // Cycle through twice as many procamp settings as the cache holds, so entries are replaced
+    // and looked up again after replacement
+    const uint32_t settings = DL_CSC_COEFF_CACHE_SIZE * 2;
+    for (uint32_t frame = 0; frame < settings * 3; frame++)
+    {
+        float brightness = -50.0f + (float)(frame % settings) * 2.5f;
+        SetProcamp(*m_cached, brightness, 5.0f);
+        SetProcamp(*m_uncached, brightness, 5.0f);
+
+        for (int phase = 0; phase < 2; phase++)
+        {
+            ASSERT_TRUE(SetupCsc(*m_cached, phase, false));
+            ASSERT_TRUE(SetupCsc(*m_uncached, phase, true));
+            ExpectSameCsc(m_cached->searchState, m_uncached->searchState);
+        }
+    }
+
+    EXPECT_GT(m_cached->state.CscCoeffCache.uiMisses, settings);
+}
+
+TEST_F(KdllCscCacheTest, DISABLED_PerfSetupCsc16Layers)
+{
+    uint32_t loops = HalTestPerfLoops(100000);
+
+    // Same procamp every frame - coefficients come from the Kdll_State CSC cache
+    EXPECT_TRUE(HalTestMeasure("kdll.SETUP_CSC_16_LAYERS", loops, [&]() {
+        return SetupCsc(*m_cached, 0, false) && SetupCsc(*m_cached, 1, false);
+    }));
+
+    // Same procamp every frame with the cache flushed - every matrix is computed
+    EXPECT_TRUE(HalTestMeasure("kdll.SETUP_CSC_16_LAYERS_UNCACHED", loops, [&]() {
+        return SetupCsc(*m_uncached, 0, true) && SetupCsc(*m_uncached, 1, true);
+    }));
+
+    // Procamp changes every frame (brightness sweep) - cache misses on the procamp layer
+    EXPECT_TRUE(HalTestMeasure("kdll.SETUP_CSC_16_LAYERS_PROCAMP_UPDATE", loops, [&]() {
+        Kdll_Procamp &procamp = m_cached->procamp;
+        SetProcamp(*m_cached, (procamp.fBrightness >= 100.0f) ? -100.0f : procamp.fBrightness + 0.1f, procamp.fHue);
+        return SetupCsc(*m_cached, 0, false) && SetupCsc(*m_cached, 1, false);
+    }));
+}
@@ -0,0 +1,257 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_media_copy_balance.cpp
+//! \brief    Unit tests of the load-aware engine selection of media copy.
+//! \details  The queue depth of each copy engine comes from a test override of
+//!           GetEngineBusyCmdBufferCount, so the selection runs without a GPU
+//!           context. The perf test replays a copy stream next to render work
+//!           on a simple engine model and reports the copy latency.
+//!
+#include <string.h>
+#include "hal_test.h"
+#include "media_copy.h"
+
+//!
+//! \brief  Media copy with a simulated queue depth per engine
+//!
+class MediaCopyBalanceTestState : public MediaCopyBaseState
+{
+public:
+    using MediaCopyBaseState::LoadBalanceEngineSelect;
+    using MediaCopyBaseState::UpdateEngineStats;
+    using MediaCopyBaseState::m_engineStats;
+    using MediaCopyBaseState::m_engineStatsMutex;
+
+    MediaCopyBalanceTestState()
+    {
+        for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+        {
+            m_engineStatsMutex[i] = MosUtilities::MosCreateMutex();
+        }
+    }
+
+    virtual uint32_t GetEngineBusyCmdBufferCount(MCPY_ENGINE mcpyEngine)
+    {
+        m_queryCount[mcpyEngine]++;
+        return m_busyCount[mcpyEngine];
+    }
+
+    uint32_t m_busyCount[MCPY_ENGINE_NUM]  = {};
+    uint32_t m_queryCount[MCPY_ENGINE_NUM] = {};
+};
+
+class MediaCopyBalanceTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        // Every engine has done one copy, so its GPU context exists
+        for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+        {
+            m_copy.UpdateEngineStats((MCPY_ENGINE)i, MOS_STATUS_SUCCESS);
+        }
+    }
+
+    void SetBusy(uint32_t vebox, uint32_t blt, uint32_t render)
+    {
+        m_copy.m_busyCount[MCPY_ENGINE_VEBOX]  = vebox;
+        m_copy.m_busyCount[MCPY_ENGINE_BLT]    = blt;
+        m_copy.m_busyCount[MCPY_ENGINE_RENDER] = render;
+    }
+
+    MediaCopyBalanceTestState m_copy;
+    MCPY_ENGINE_CAPS          m_caps = {1, 1, 1, 0};
+};
+
+TEST_F(MediaCopyBalanceTest, KeepsPreferredEngineOnSmallDifference)
+{
+    SetBusy(1, 1, 2);
+    EXPECT_EQ(MCPY_ENGINE_RENDER, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false));
+    EXPECT_EQ(0u, m_copy.m_engineStats[MCPY_ENGINE_BLT].movedInCount);
+    EXPECT_EQ(0u, m_copy.m_engineStats[MCPY_ENGINE_VEBOX].movedInCount);
+}
+
+TEST_F(MediaCopyBalanceTest, MovesDefaultCopyToLeastLoadedEngine)
+{
+    SetBusy(2, 0, 5);
+    EXPECT_EQ(MCPY_ENGINE_BLT, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false));
+    EXPECT_EQ(1u, m_copy.m_engineStats[MCPY_ENGINE_BLT].movedInCount);
+    EXPECT_EQ(0u, m_copy.m_engineStats[MCPY_ENGINE_VEBOX].movedInCount);
+
+    for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+    {
+        EXPECT_EQ(1u, m_copy.m_queryCount[i]);
+        EXPECT_EQ(1u, m_copy.m_engineStats[i].busySampleCount);
+        EXPECT_EQ(m_copy.m_busyCount[i], m_copy.m_engineStats[i].busyCmdBufSum);
+    }
+}
+
+TEST_F(MediaCopyBalanceTest, ExplicitMethodNeedsTwiceTheQueueDepth)
+{
+    SetBusy(8, 1, 3);
+    EXPECT_EQ(MCPY_ENGINE_RENDER, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, true));
+    EXPECT_EQ(MCPY_ENGINE_BLT, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false));
+
+    SetBusy(8, 1, 4);
+    EXPECT_EQ(MCPY_ENGINE_BLT, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, true));
+}
+
+TEST_F(MediaCopyBalanceTest, SkipsUnsupportedEngines)
+{
+    SetBusy(3, 0, 6);
+    m_caps.engineBlt = 0;
+    EXPECT_EQ(MCPY_ENGINE_VEBOX, m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false));
+    EXPECT_EQ(0u, m_copy.m_queryCount[MCPY_ENGINE_BLT]);
+}
+
+TEST_F(MediaCopyBalanceTest, SkipsEnginesWithoutGpuContext)
+{
+    MediaCopyBalanceTestState copy;
+    copy.UpdateEngineStats(MCPY_ENGINE_RENDER, MOS_STATUS_SUCCESS);
+    copy.UpdateEngineStats(MCPY_ENGINE_BLT, MOS_STATUS_INVALID_PARAMETER);
+    copy.m_busyCount[MCPY_ENGINE_RENDER] = 10;
+
+    // A failed copy does not create the GPU context either
+    EXPECT_EQ(MCPY_ENGINE_RENDER, copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false));
+    EXPECT_EQ(0u, copy.m_queryCount[MCPY_ENGINE_VEBOX]);
+    EXPECT_EQ(0u, copy.m_queryCount[MCPY_ENGINE_BLT]);
+    EXPECT_EQ(1u, copy.m_queryCount[MCPY_ENGINE_RENDER]);
+    EXPECT_EQ(1u, copy.m_engineStats[MCPY_ENGINE_BLT].failCount);
+}
+
+//!
+//! \brief  Copy engine model of the perf test
+//! \details Each engine runs its queued jobs in order, one time unit of work per tick.
+//!          Its queue depth is the number of jobs not finished yet.
+//!
+struct MediaCopyBalanceEngineModel
+{
+    uint32_t jobs[16];
+    uint32_t head;
+    uint32_t count;
+
+    void Submit(uint32_t cost)
+    {
+        jobs[(head + count) % 16] = cost;
+        count++;
+    }
+
+    void Tick()
+    {
+        if (count && --jobs[head] == 0)
+        {
+            head = (head + 1) % 16;
+            count--;
+        }
+    }
+
+    uint32_t Work()
+    {
+        uint32_t work = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            work += jobs[(head + i) % 16];
+        }
+        return work;
+    }
+};
+
+//!
+//! \brief  Replay copies next to render work and get average copy latency
+//! \details Each frame of 30 ticks, VP submits 5 render jobs costing 3 ticks and
+//!          then 6 copies are submitted, so render alone is 90% busy. Copies cost
+//!          2 ticks on render and 3 on vebox or BLT.
+//!
+static double MediaCopyBalanceReplay(MediaCopyBalanceTestState &copy, bool loadBalance, uint32_t frames)
+{
+    const uint32_t              cost[MCPY_ENGINE_NUM] = {3, 3, 2};
+    MediaCopyBalanceEngineModel engine[MCPY_ENGINE_NUM];
+    MCPY_ENGINE_CAPS            caps    = {1, 1, 1, 0};
+    uint64_t                    latency = 0;
+
+    memset(engine, 0, sizeof(engine));
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        for (uint32_t job = 0; job < 5; job++)
+        {
+            engine[MCPY_ENGINE_RENDER].Submit(3);
+        }
+
+        for (uint32_t i = 0; i < 6; i++)
+        {
+            for (uint32_t e = 0; e < MCPY_ENGINE_NUM; e++)
+            {
+                copy.m_busyCount[e] = engine[e].count;
+            }
+            MCPY_ENGINE selected = MCPY_ENGINE_RENDER;
+            if (loadBalance)
+            {
+                selected = copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, caps, false);
+            }
+            // The copy finishes after the work queued before it and its own
+            latency += engine[selected].Work() + cost[selected];
+            engine[selected].Submit(cost[selected]);
+            copy.UpdateEngineStats(selected, MOS_STATUS_SUCCESS);
+        }
+
+        for (uint32_t tick = 0; tick < 30; tick++)
+        {
+            for (uint32_t e = 0; e < MCPY_ENGINE_NUM; e++)
+            {
+                engine[e].Tick();
+            }
+        }
+    }
+
+    return (double)latency / (frames * 6);
+}
+
+TEST_F(MediaCopyBalanceTest, DISABLED_PerfCopyNextToRenderWork)
+{
+    const uint32_t frames = 10000;
+
+    MediaCopyBalanceTestState fixed;
+    fixed.UpdateEngineStats(MCPY_ENGINE_VEBOX, MOS_STATUS_SUCCESS);
+    fixed.UpdateEngineStats(MCPY_ENGINE_BLT, MOS_STATUS_SUCCESS);
+    double fixedLatency = MediaCopyBalanceReplay(fixed, false, frames);
+
+    MediaCopyBalanceTestState balanced;
+    balanced.UpdateEngineStats(MCPY_ENGINE_VEBOX, MOS_STATUS_SUCCESS);
+    balanced.UpdateEngineStats(MCPY_ENGINE_BLT, MOS_STATUS_SUCCESS);
+    double balancedLatency = MediaCopyBalanceReplay(balanced, true, frames);
+
+    printf("%-48s %12.1f ticks/copy\n", "Copy latency, render only", fixedLatency);
+    printf("%-48s %12.1f ticks/copy\n", "Copy latency, load balance", balancedLatency);
+    for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+    {
+        printf("%-48s engine %u: copies %u, moved in %u\n", "Copy distribution, load balance",
+            i, balanced.m_engineStats[i].copyCount, balanced.m_engineStats[i].movedInCount);
+    }
+    EXPECT_LT(balancedLatency, fixedLatency);
+
+    SetBusy(3, 1, 5);
+    uint32_t loops = HalTestPerfLoops(1000000);
+    EXPECT_TRUE(HalTestMeasure("Copy engine selection", loops, [&]() {
+        return m_copy.LoadBalanceEngineSelect(MCPY_ENGINE_RENDER, m_caps, false) == MCPY_ENGINE_BLT;
+    }));
+}
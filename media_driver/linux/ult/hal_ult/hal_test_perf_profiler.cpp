@@ -0,0 +1,128 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_perf_profiler.cpp
+//! \brief    Unit tests of the streaming timeline of MediaPerfProfiler.
+//! \details  The OS interface is a stub whose lock and unlock only count calls,
+//!           so the tests check what InitStreaming leaves behind without a GPU.
+//!
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "hal_test.h"
+#include "media_perf_profiler.h"
+
+using namespace std;
+
+//!
+//! \brief  Expose the streaming state of MediaPerfProfiler
+//!
+class PerfProfilerTestAccess : public MediaPerfProfiler
+{
+public:
+    using MediaPerfProfiler::InitStreaming;
+    using MediaPerfProfiler::m_bufferSize;
+    using MediaPerfProfiler::m_streamContextMap;
+    using MediaPerfProfiler::m_streamFileName;
+};
+
+class MediaPerfProfilerTest : public testing::Test
+{
+protected:
+    static void *Lock(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource, PMOS_LOCK_PARAMS flags)
+    {
+        m_lockCount++;
+        return m_buffer.data();
+    }
+
+    static MOS_STATUS Unlock(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+    {
+        m_unlockCount++;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    void SetUp() override
+    {
+        m_lockCount   = 0;
+        m_unlockCount = 0;
+        m_buffer.assign(4096, 0);
+
+        MOS_ZeroMemory(&m_osInterface, sizeof(m_osInterface));
+        m_osInterface.pOsContext        = (PMOS_CONTEXT)&m_osContext;
+        m_osInterface.pfnLockResource   = Lock;
+        m_osInterface.pfnUnlockResource = Unlock;
+        MOS_ZeroMemory(&m_resource, sizeof(m_resource));
+    }
+
+    static uint32_t        m_lockCount;
+    static uint32_t        m_unlockCount;
+    static vector<uint8_t> m_buffer;
+
+    MOS_INTERFACE m_osInterface = {};
+    MOS_RESOURCE  m_resource    = {};
+    uint64_t      m_osContext   = 0;
+};
+
+uint32_t        MediaPerfProfilerTest::m_lockCount   = 0;
+uint32_t        MediaPerfProfilerTest::m_unlockCount = 0;
+vector<uint8_t> MediaPerfProfilerTest::m_buffer;
+
+TEST_F(MediaPerfProfilerTest, StreamingFileOpenFailureLeavesNoState)
+{
+    PerfProfilerTestAccess profiler;
+    profiler.m_bufferSize     = (uint32_t)m_buffer.size();
+    profiler.m_streamFileName = "/nonexistent-hal-ult-dir/timeline.json";
+
+    EXPECT_EQ(MOS_STATUS_FILE_OPEN_FAILED, profiler.InitStreaming(&m_osInterface, &m_resource));
+
+    // Buffer must not stay mapped, and no stream may be left for the reader
+    EXPECT_EQ(m_lockCount, m_unlockCount);
+    EXPECT_TRUE(profiler.m_streamContextMap.empty());
+}
+
+TEST_F(MediaPerfProfilerTest, StreamingMapsBufferOnce)
+{
+    char fileName[] = "/tmp/hal_ult_timeline_XXXXXX";
+    int  fd         = mkstemp(fileName);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    {
+        PerfProfilerTestAccess profiler;
+        profiler.m_bufferSize     = (uint32_t)m_buffer.size();
+        profiler.m_streamFileName = fileName;
+
+        EXPECT_EQ(MOS_STATUS_SUCCESS, profiler.InitStreaming(&m_osInterface, &m_resource));
+        EXPECT_EQ(1u, m_lockCount);
+        EXPECT_EQ(1u, profiler.m_streamContextMap.size());
+    }
+
+    FILE *file = fopen(fileName, "r");
+    ASSERT_NE(nullptr, file);
+    char head[2] = {};
+    EXPECT_EQ(1u, fread(head, 1, 1, file));
+    EXPECT_EQ('[', head[0]);
+    fclose(file);
+    remove(fileName);
+}
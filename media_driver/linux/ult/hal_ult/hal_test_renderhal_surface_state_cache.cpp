@@ -0,0 +1,218 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_renderhal_surface_state_cache.cpp
+//! \brief    Unit tests of the RenderHal surface state cache.
+//! \details  Surface states are encoded by the Gen12 MHW state heap interface, the
+//!           same encoder RenderHal calls on the hardware. A cache hit must give
+//!           the same bytes and patch location as encoding the state again.
+//!
+#include <string.h>
+#include "hal_test.h"
+#include "renderhal.h"
+#include "mhw_state_heap_g12.h"
+
+#define SURFACE_STATE_TEST_BUFFER_SIZE  RENDERHAL_SURFACE_STATE_CACHE_MAX_SIZE
+
+class RenderHalSurfaceStateCacheTest : public testing::Test
+{
+protected:
+    RenderHalSurfaceStateCacheTest() : m_stateHeap(nullptr, 0)
+    {
+        m_renderHal.pMhwStateHeap = &m_stateHeap;
+        m_renderHal.pHwSizes      = m_stateHeap.GetHwSizesPointer();
+    }
+
+    ~RenderHalSurfaceStateCacheTest()
+    {
+        MOS_FreeMemory(m_renderHal.pSurfaceStateCache);
+    }
+
+    //!
+    //! \brief  Surface state parameters of a plane of an NV12 surface, 2D or AVS
+    //!
+    static MHW_SURFACE_STATE_PARAMS Nv12Plane(uint32_t width, uint32_t height, bool uvPlane, bool adv)
+    {
+        MHW_SURFACE_STATE_PARAMS params;
+        MOS_ZeroMemory(&params, sizeof(params));
+        params.bUseAdvState          = adv;
+        params.SurfaceType3D         = GFX3DSTATE_SURFACETYPE_2D;
+        params.dwFormat              = adv ? MHW_MEDIASTATE_SURFACEFORMAT_PLANAR_420_8 :
+                                       (uvPlane ? MHW_GFX3DSTATE_SURFACEFORMAT_R8G8_UNORM : MHW_GFX3DSTATE_SURFACEFORMAT_R8_UNORM);
+        params.dwWidth               = uvPlane ? width / 2 : width;
+        params.dwHeight              = uvPlane ? height / 2 : height;
+        params.dwDepth               = 1;
+        params.dwPitch               = MOS_ALIGN_CEIL(width, 128);
+        params.bTiledSurface         = true;
+        params.bInterleaveChroma     = adv;
+        params.dwYOffsetForU         = adv ? height : 0;
+        params.dwCacheabilityControl = 2;
+        params.bGMMTileEnabled       = true;
+        return params;
+    }
+
+    //!
+    //! \brief  Surface state parameters of a raw buffer
+    //!
+    static MHW_SURFACE_STATE_PARAMS Buffer(uint32_t size)
+    {
+        MHW_SURFACE_STATE_PARAMS params;
+        MOS_ZeroMemory(&params, sizeof(params));
+        params.SurfaceType3D         = GFX3DSTATE_SURFACETYPE_BUFFER;
+        params.dwFormat              = MHW_GFX3DSTATE_SURFACEFORMAT_RAW;
+        params.dwWidth               = (size - 1) & MOS_MASKBITS32(0, 6);
+        params.dwHeight              = ((size - 1) & MOS_MASKBITS32(7, 20)) >> 7;
+        params.dwCacheabilityControl = 2;
+        params.bGMMTileEnabled       = true;
+        return params;
+    }
+
+    //!
+    //! \brief  Set surface state through the cache and check it against MHW encoding
+    //!
+    void ExpectSameAsEncoded(MHW_SURFACE_STATE_PARAMS params)
+    {
+        uint8_t                  cached[SURFACE_STATE_TEST_BUFFER_SIZE];
+        uint8_t                  encoded[SURFACE_STATE_TEST_BUFFER_SIZE];
+        MHW_SURFACE_STATE_PARAMS direct = params;
+
+        memset(cached, 0xcd, sizeof(cached));
+        memset(encoded, 0xcd, sizeof(encoded));
+        params.pSurfaceState = cached;
+        direct.pSurfaceState = encoded;
+
+        ASSERT_EQ(MOS_STATUS_SUCCESS, RenderHal_SetSurfaceStateEntry(&m_renderHal, &params));
+        ASSERT_EQ(MOS_STATUS_SUCCESS, m_stateHeap.SetSurfaceStateEntry(&direct));
+
+        EXPECT_EQ(0, memcmp(cached, encoded, sizeof(cached)));
+        EXPECT_EQ((uint8_t *)direct.pdwCmd - encoded, (uint8_t *)params.pdwCmd - cached);
+        EXPECT_EQ(direct.dwLocationInCmd, params.dwLocationInCmd);
+    }
+
+    MHW_STATE_HEAP_INTERFACE_G12_X m_stateHeap;
+    RENDERHAL_INTERFACE            m_renderHal = {};
+};
+
+TEST_F(RenderHalSurfaceStateCacheTest, HitSameAsEncoded)
+{
+    const MHW_SURFACE_STATE_PARAMS surfaces[] = {
+        Nv12Plane(1920, 1080, false, false),
+        Nv12Plane(1920, 1080, true, false),
+        Nv12Plane(1920, 1080, false, true),
+        Buffer(4096)};
+
+    for (const MHW_SURFACE_STATE_PARAMS &params : surfaces)
+    {
+        ExpectSameAsEncoded(params);
+    }
+    ASSERT_NE(nullptr, m_renderHal.pSurfaceStateCache);
+    EXPECT_EQ(0u, m_renderHal.pSurfaceStateCache->dwHits);
+    EXPECT_EQ(4u, m_renderHal.pSurfaceStateCache->dwMisses);
+
+    for (const MHW_SURFACE_STATE_PARAMS &params : surfaces)
+    {
+        ExpectSameAsEncoded(params);
+    }
+    EXPECT_EQ(4u, m_renderHal.pSurfaceStateCache->dwHits);
+    EXPECT_EQ(4u, m_renderHal.pSurfaceStateCache->dwMisses);
+}
+
+TEST_F(RenderHalSurfaceStateCacheTest, ParameterChangeMisses)
+{
+    MHW_SURFACE_STATE_PARAMS params = Nv12Plane(1280, 720, false, false);
+    ExpectSameAsEncoded(params);
+
+    params.dwWidth = 1920;
+    ExpectSameAsEncoded(params);
+    params.MmcState = MOS_MEMCOMP_RC;
+    ExpectSameAsEncoded(params);
+    params.dwCacheabilityControl = 4;
+    ExpectSameAsEncoded(params);
+
+    ASSERT_NE(nullptr, m_renderHal.pSurfaceStateCache);
+    EXPECT_EQ(0u, m_renderHal.pSurfaceStateCache->dwHits);
+    EXPECT_EQ(4u, m_renderHal.pSurfaceStateCache->dwMisses);
+
+    // Surface address is patched on submission, so the output pointers are not part of the key.
+    uint8_t other[SURFACE_STATE_TEST_BUFFER_SIZE];
+    params.pSurfaceState   = other;
+    params.pdwCmd          = nullptr;
+    params.dwLocationInCmd = 0;
+    ASSERT_EQ(MOS_STATUS_SUCCESS, RenderHal_SetSurfaceStateEntry(&m_renderHal, &params));
+    EXPECT_EQ(1u, m_renderHal.pSurfaceStateCache->dwHits);
+    EXPECT_EQ((uint32_t *)(other + 8 * sizeof(uint32_t)), params.pdwCmd);
+}
+
+//!
+//! \brief  Surface states of a VP composition frame: two NV12 layers through the
+//!         sampler, one AVS layer, the RGB target and a few kernel buffers.
+//!
+TEST_F(RenderHalSurfaceStateCacheTest, DISABLED_PerfSurfaceStatesPerFrame)
+{
+    uint32_t loops = HalTestPerfLoops(200000);
+    std::vector<MHW_SURFACE_STATE_PARAMS> frame = {
+        Nv12Plane(1920, 1080, false, false),
+        Nv12Plane(1920, 1080, true, false),
+        Nv12Plane(1280, 720, false, false),
+        Nv12Plane(1280, 720, true, false),
+        Nv12Plane(720, 480, false, true),
+        Buffer(4096),
+        Buffer(65536),
+        Buffer(256)};
+    MHW_SURFACE_STATE_PARAMS target = Nv12Plane(1920, 1080, false, false);
+    target.dwFormat                 = MHW_GFX3DSTATE_SURFACEFORMAT_B8G8R8A8_UNORM;
+    target.dwPitch                  = 1920 * 4;
+    frame.push_back(target);
+
+    uint8_t ssh[16][SURFACE_STATE_TEST_BUFFER_SIZE];
+
+    EXPECT_TRUE(HalTestMeasure("renderhal.SURFACE_STATES_9_ENCODED", loops, [&]() {
+        for (uint32_t i = 0; i < frame.size(); i++)
+        {
+            MHW_SURFACE_STATE_PARAMS params = frame[i];
+            params.pSurfaceState            = ssh[i];
+            if (m_stateHeap.SetSurfaceStateEntry(&params) != MOS_STATUS_SUCCESS)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+
+    EXPECT_TRUE(HalTestMeasure("renderhal.SURFACE_STATES_9_CACHED", loops, [&]() {
+        for (uint32_t i = 0; i < frame.size(); i++)
+        {
+            MHW_SURFACE_STATE_PARAMS params = frame[i];
+            params.pSurfaceState            = ssh[i];
+            if (RenderHal_SetSurfaceStateEntry(&m_renderHal, &params) != MOS_STATUS_SUCCESS)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+
+    PRENDERHAL_SURFACE_STATE_CACHE cache = m_renderHal.pSurfaceStateCache;
+    ASSERT_NE(nullptr, cache);
+    printf("renderhal.SURFACE_STATE_CACHE %u hits, %u misses, hit rate %.2f%%\n",
+        cache->dwHits, cache->dwMisses, cache->dwHits * 100.0 / (cache->dwHits + cache->dwMisses));
+}
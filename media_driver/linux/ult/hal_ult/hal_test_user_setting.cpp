@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_user_setting.cpp
+//! \brief    Unit tests of the user setting snapshot.
+//! \details  Registry values are changed behind Configure the way an external
+//!           writer would, followed by RefreshSnapshot. Readers run concurrently
+//!           and must never see a value older than one they already saw.
+//!
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "hal_test.h"
+#include "media_user_setting_configure.h"
+
+using namespace std;
+using namespace MediaUserSetting;
+
+//!
+//! \brief  Expose the registry buffer and snapshot switch of Configure
+//!
+class ConfigureTestAccess : public Internal::Configure
+{
+public:
+    void EnableSnapshot(bool enable)
+    {
+        m_snapshotEnabled = enable;
+    }
+
+    //! \brief  Set registry value on read path of item, as an external writer would
+    void SetRegValue(const string &name, int32_t value)
+    {
+        auto def = GetDefinitions(Group::Device)[MakeHash(name)];
+        ASSERT_NE(nullptr, def);
+
+        UFKEY_NEXT key = {};
+        m_mutexLock.Lock();
+        EXPECT_EQ(MOS_STATUS_SUCCESS, MosUtilities::MosOpenRegKey(m_rootKey, GetReadPath(def, MEDIA_USER_SETTING_INTERNAL), KEY_WRITE, &key, m_regBufferMap));
+        EXPECT_EQ(MOS_STATUS_SUCCESS, MosUtilities::MosSetRegValue(key, name, Value(value), m_regBufferMap));
+        MosUtilities::MosCloseRegKey(key);
+        m_mutexLock.Unlock();
+    }
+};
+
+class MediaUserSettingTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (uint32_t i = 0; i < m_itemNum; i++)
+        {
+            m_names.push_back("Hal Ult Snapshot Item " + to_string(i));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, m_configure.Register(m_names[i], Group::Device, Value(0), false, false, false, "", false));
+        }
+    }
+
+    int32_t ReadItem(uint32_t index)
+    {
+        Value value;
+        m_configure.Read(value, m_names[index], Group::Device, Value(), false, MEDIA_USER_SETTING_INTERNAL);
+        return value.Get<int32_t>();
+    }
+
+    static const uint32_t m_itemNum = 300;  //!< Close to the items registered by the driver
+
+    ConfigureTestAccess m_configure;
+    vector<string>      m_names;
+};
+
+TEST_F(MediaUserSettingTest, SnapshotPicksUpRefreshedValue)
+{
+    m_configure.EnableSnapshot(true);
+    EXPECT_EQ(0, ReadItem(7));
+
+    m_configure.SetRegValue(m_names[7], 42);
+    // Snapshot is current until refreshed
+    EXPECT_EQ(0, ReadItem(7));
+
+    m_configure.RefreshSnapshot();
+    EXPECT_EQ(42, ReadItem(7));
+}
+
+TEST_F(MediaUserSettingTest, ConcurrentReadsNeverGoBack)
+{
+    const uint32_t  readerNum = 4;
+    const int32_t   lastValue = 200;
+    const uint32_t  items[]   = {0, m_itemNum / 2, m_itemNum - 1};
+    atomic<bool>    stop{false};
+    atomic<uint32_t> regressions{0};
+
+    m_configure.EnableSnapshot(true);
+
+    vector<thread> readers;
+    for (uint32_t r = 0; r < readerNum; r++)
+    {
+        readers.emplace_back([&]() {
+            int32_t seen[3] = {};
+            while (!stop)
+            {
+                for (uint32_t i = 0; i < 3; i++)
+                {
+                    int32_t value = ReadItem(items[i]);
+                    if (value < seen[i])
+                    {
+                        regressions++;
+                    }
+                    seen[i] = value;
+                }
+            }
+        });
+    }
+
+    for (int32_t value = 1; value <= lastValue; value++)
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            m_configure.SetRegValue(m_names[items[i]], value);
+        }
+        m_configure.RefreshSnapshot();
+        this_thread::yield();
+    }
+
+    stop = true;
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, regressions.load());
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(lastValue, ReadItem(items[i]));
+    }
+}
+
+TEST_F(MediaUserSettingTest, DISABLED_PerfContextCreateReads)
+{
+    // Context creation reads the user settings of every component once.
+    for (uint32_t snapshot = 0; snapshot < 2; snapshot++)
+    {
+        m_configure.EnableSnapshot(snapshot != 0);
+        EXPECT_TRUE(HalTestMeasure(
+            snapshot ? "User setting reads per context, snapshot" : "User setting reads per context, registry",
+            HalTestPerfLoops(2000),
+            [&]() {
+                int32_t sum = 0;
+                for (uint32_t i = 0; i < m_itemNum; i++)
+                {
+                    sum += ReadItem(i);
+                }
+                return sum == 0;
+            }));
+    }
+}
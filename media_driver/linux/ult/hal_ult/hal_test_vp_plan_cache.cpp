@@ -0,0 +1,434 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_vp_plan_cache.cpp
+//! \brief    Unit tests of the VP packet reuse plan cache.
+//! \details  VpPacketReuseManager decides on real scaling and CSC sw filters of a
+//!           single layer VEBOX-SFC pipe. Packets only record being reused, so the
+//!           benchmark covers the reuse decision and packet pipe bookkeeping per
+//!           frame, not the policy and packet creation a miss costs in the driver.
+//!
+#include "hal_test.h"
+#include "vp_pipeline.h"
+#include "vp_packet_reuse_manager.h"
+#include "vp_vebox_cmd_packet_base.h"
+
+using namespace vp;
+
+namespace
+{
+//!
+//! \brief  Vebox packet which only records being reused
+//!
+class VpPlanCacheTestPacket : public VpVeboxCmdPacketBase
+{
+public:
+    VpPlanCacheTestPacket(PVP_MHWINTERFACE hwInterface, PVpAllocator &allocator) :
+        CmdPacket(nullptr),
+        VpCmdPacket(nullptr, hwInterface, allocator, nullptr, VP_PIPELINE_PACKET_VEBOX),
+        VpVeboxCmdPacketBase(nullptr, hwInterface, allocator, nullptr)
+    {
+    }
+
+    MOS_STATUS PacketInit(VP_SURFACE *inputSurface, VP_SURFACE *outputSurface, VP_SURFACE *previousSurface,
+        VP_SURFACE_SETTING &surfSetting, VP_EXECUTE_CAPS packetCaps) override
+    {
+        m_PacketCaps = packetCaps;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS PacketInitForReuse(VP_SURFACE *inputSurface, VP_SURFACE *outputSurface, VP_SURFACE *previousSurface,
+        VP_SURFACE_SETTING &surfSetting, VP_EXECUTE_CAPS packetCaps) override
+    {
+        m_PacketCaps = packetCaps;
+        m_outputWidth = outputSurface && outputSurface->osSurface ? outputSurface->osSurface->dwWidth : 0;
+        ++m_reuseCount;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS SetSfcCSCParams(PSFC_CSC_PARAMS cscParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetVeboxBeCSCParams(PVEBOX_CSC_PARAMS cscParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetDiParams(PVEBOX_DI_PARAMS diParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetDnParams(PVEBOX_DN_PARAMS pDnParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetHdrParams(PVEBOX_HDR_PARAMS hdrParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetProcampParams(PVEBOX_PROCAMP_PARAMS pProcampParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetSfcRotMirParams(PSFC_ROT_MIR_PARAMS rotMirParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetScalingParams(PSFC_SCALING_PARAMS scalingParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetSteParams(PVEBOX_STE_PARAMS pSteParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetTccParams(PVEBOX_TCC_PARAMS pTccParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS SetCgcParams(PVEBOX_CGC_PARAMS veboxCgcParams) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS UpdateCscParams(FeatureParamCsc &params) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS UpdateDenoiseParams(FeatureParamDenoise &params) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS UpdateTccParams(FeatureParamTcc &params) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS UpdateSteParams(FeatureParamSte &params) override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS UpdateProcampParams(FeatureParamProcamp &params) override { return MOS_STATUS_SUCCESS; }
+
+    uint32_t m_reuseCount  = 0;
+    uint32_t m_outputWidth = 0;
+};
+
+//!
+//! \brief  Packet factory whose vebox packet pool is refilled with test packets
+//!
+class VpPlanCacheTestPacketFactory : public PacketFactory
+{
+public:
+    VpPlanCacheTestPacketFactory(PVP_MHWINTERFACE hwInterface, PVpAllocator &allocator) :
+        PacketFactory(nullptr), m_hwInterface(hwInterface), m_allocator(allocator)
+    {
+    }
+
+    MOS_STATUS ReserveVeboxPacket()
+    {
+        if (m_VeboxPacketPool.empty())
+        {
+            VpCmdPacket *p = MOS_New(VpPlanCacheTestPacket, m_hwInterface, m_allocator);
+            VP_PUBLIC_CHK_NULL_RETURN(p);
+            m_VeboxPacketPool.push_back(p);
+        }
+        return MOS_STATUS_SUCCESS;
+    }
+
+    PVP_MHWINTERFACE m_hwInterface;
+    PVpAllocator    &m_allocator;
+};
+
+//!
+//! \brief  VEBOX-SFC hw filter without feature handlers
+//! \details The sw filter pipe belongs to the stream, so it is not kept in m_swFilterPipe,
+//!          which HwFilter destroys.
+//!
+class VpPlanCacheTestHwFilter : public HwFilter
+{
+public:
+    VpPlanCacheTestHwFilter(VpInterface &vpInterface, SwFilterPipe &swFilterPipe) :
+        HwFilter(vpInterface, EngineTypeVeboxSfc), m_pipe(swFilterPipe)
+    {
+        m_Params.Type          = EngineTypeVeboxSfc;
+        m_vpExecuteCaps.bVebox = true;
+        m_vpExecuteCaps.bSFC   = true;
+    }
+
+    MOS_STATUS SetPacketParams(VpCmdPacket &packet) override
+    {
+        return packet.PacketInit(m_pipe.GetSurface(true, 0), m_pipe.GetSurface(false, 0),
+            m_pipe.GetPastSurface(0), m_pipe.GetSurfacesSetting(), m_vpExecuteCaps);
+    }
+
+private:
+    SwFilterPipe &m_pipe;
+};
+
+class VpPlanCacheTestPlatform : public VpPlatformInterface
+{
+public:
+    VpPlanCacheTestPlatform() : VpPlatformInterface(nullptr)
+    {
+    }
+
+    uint32_t VeboxQueryStaticSurfaceSize() override { return 0; }
+    VpKernelConfig &GetKernelConfig() override { return m_kernelConfig; }
+    MOS_STATUS ConfigVirtualEngine() override { return MOS_STATUS_SUCCESS; }
+    MOS_STATUS ConfigureVpScalability(VP_MHWINTERFACE &vpMhwInterface) override { return MOS_STATUS_SUCCESS; }
+
+    VpKernelConfig m_kernelConfig;
+};
+
+class VpPlanCacheTestFeatureControl : public VpUserFeatureControl
+{
+public:
+    VpPlanCacheTestFeatureControl(MOS_INTERFACE &osInterface, bool planCache) : VpUserFeatureControl(osInterface, nullptr)
+    {
+        m_ctrlVal.enablePacketReusePlanCache = planCache;
+    }
+};
+
+MEDIA_FEATURE_TABLE *VpPlanCacheTestGetSkuTable(PMOS_INTERFACE osInterface)
+{
+    static MEDIA_FEATURE_TABLE skuTable;
+    return &skuTable;
+}
+
+MediaUserSettingSharedPtr VpPlanCacheTestGetUserSettingInstance(PMOS_INTERFACE osInterface)
+{
+    return nullptr;
+}
+
+uint64_t VpPlanCacheTestGetResourceHandle(MOS_STREAM_HANDLE streamState, PMOS_RESOURCE osResource)
+{
+    // Surfaces are not allocated, so VpResourceManager makes no copy of them.
+    return 0;
+}
+
+//!
+//! \brief  Scale plus CSC pipe of one NV12 1080p layer, as VpPipeline builds for VEBOX-SFC
+//!
+class VpPlanCacheTestStream
+{
+public:
+    VpPlanCacheTestStream(VpInterface &vpInterface, uint32_t outputWidth, uint32_t outputHeight) :
+        m_pipe(vpInterface)
+    {
+        InitSurface(m_inputOsSurface, m_input, 1920, 1080, CSpace_BT601);
+        InitSurface(m_outputOsSurface, m_output, outputWidth, outputHeight, CSpace_BT709);
+
+        VP_SURFACE *input  = &m_input;
+        VP_SURFACE *output = &m_output;
+        m_pipe.AddSurface(input, true, 0);
+        m_pipe.AddSurface(output, false, 0);
+
+        VP_EXECUTE_CAPS caps = {};
+        caps.bVebox = true;
+        caps.bSFC   = true;
+        m_scaling = MOS_New(SwFilterScaling, vpInterface);
+        m_csc     = MOS_New(SwFilterCsc, vpInterface);
+        if (m_scaling && m_csc)
+        {
+            m_scaling->Configure(&m_input, &m_output, caps);
+            m_csc->Configure(&m_input, &m_output, caps);
+            m_pipe.AddSwFilterUnordered(m_csc, true, 0);
+            m_pipe.AddSwFilterUnordered(m_scaling, true, 0);
+        }
+    }
+
+    ~VpPlanCacheTestStream()
+    {
+        // Filters and surfaces belong to the stream instead of the feature handlers and allocator.
+        m_pipe.RemoveSwFilter(m_scaling);
+        m_pipe.RemoveSwFilter(m_csc);
+        MOS_Delete(m_scaling);
+        MOS_Delete(m_csc);
+        m_pipe.RemoveSurface(true, 0);
+        m_pipe.RemoveSurface(false, 0);
+    }
+
+    SwFilterPipe *GetPipe()
+    {
+        return &m_pipe;
+    }
+
+private:
+    static void InitSurface(MOS_SURFACE &osSurface, VP_SURFACE &surface, uint32_t width, uint32_t height, VPHAL_CSPACE colorSpace)
+    {
+        MOS_ZeroMemory(&osSurface, sizeof(osSurface));
+        osSurface.Format   = Format_NV12;
+        osSurface.dwWidth  = width;
+        osSurface.dwHeight = height;
+        osSurface.dwPitch  = MOS_ALIGN_CEIL(width, 128);
+        osSurface.TileType = MOS_TILE_Y;
+
+        surface.osSurface    = &osSurface;
+        surface.ColorSpace   = colorSpace;
+        surface.SurfType     = SURF_IN_PRIMARY;
+        surface.SampleType   = SAMPLE_PROGRESSIVE;
+        surface.rcSrc        = {0, 0, (int32_t)width, (int32_t)height};
+        surface.rcDst        = surface.rcSrc;
+        surface.rcMaxSrc     = surface.rcSrc;
+    }
+
+    MOS_SURFACE      m_inputOsSurface  = {};
+    MOS_SURFACE      m_outputOsSurface = {};
+    VP_SURFACE       m_input           = {};
+    VP_SURFACE       m_output          = {};
+    SwFilterPipe     m_pipe;
+    SwFilterScaling *m_scaling = nullptr;
+    SwFilterCsc     *m_csc     = nullptr;
+};
+
+//!
+//! \brief  Packet reuse path of VpPipeline::ExecuteSingleswFilterPipe with plan cache on or off
+//!
+class VpPlanCacheTestContext
+{
+public:
+    VpPlanCacheTestContext(MOS_INTERFACE &osInterface, bool planCache) :
+        m_hwInterface(),
+        m_allocator(nullptr, nullptr),
+        m_allocatorPtr(&m_allocator),
+        m_vpInterface(&m_hwInterface, m_allocator, nullptr),
+        m_featureControl(osInterface, planCache),
+        m_packetFactory(&m_hwInterface, m_allocatorPtr),
+        m_pipeFactory(m_packetFactory),
+        m_reuseMgr(m_pipeFactory, m_featureControl),
+        m_policy(m_vpInterface),
+        m_resMgr(osInterface, m_allocator, m_report, m_platform, nullptr, &m_featureControl),
+        m_large(m_vpInterface, 1280, 720),
+        m_small(m_vpInterface, 640, 360)
+    {
+        m_hwInterface.m_osInterface = &osInterface;
+        m_reuseMgr.RegisterFeatures();
+        // Feature pool of Policy::RegisterFeatures.
+        m_policy.GetFeatureRegistered() = {FeatureTypeCsc, FeatureTypeScaling, FeatureTypeRotMir, FeatureTypeDn,
+            FeatureTypeSte, FeatureTypeTcc, FeatureTypeProcamp, FeatureTypeHdr, FeatureTypeDi, FeatureTypeFc,
+            FeatureTypeLumakey, FeatureTypeBlending, FeatureTypeColorFill, FeatureTypeAlpha, FeatureTypeCgc};
+    }
+
+    //!
+    //! \brief  Run one frame, creating a new packet pipe if not reused
+    //! \return MOS_STATUS
+    //!
+    MOS_STATUS RunFrame(VpPlanCacheTestStream &stream, bool &reused)
+    {
+        SwFilterPipe *swFilterPipe = stream.GetPipe();
+        bool          isTeamsWL    = false;
+        reused                     = false;
+        VP_PUBLIC_CHK_STATUS_RETURN(m_reuseMgr.PreparePacketPipeReuse(swFilterPipe, m_policy, m_resMgr, reused, isTeamsWL));
+        if (reused)
+        {
+            VP_PUBLIC_CHK_NULL_RETURN(m_reuseMgr.GetPacketPipeReused());
+            return MOS_STATUS_SUCCESS;
+        }
+
+        // Policy and packet creation of the driver are not counted here.
+        VpPlanCacheTestHwFilter hwFilter(m_vpInterface, *swFilterPipe);
+        VP_PUBLIC_CHK_STATUS_RETURN(m_packetFactory.ReserveVeboxPacket());
+        PacketPipe *pipe = m_pipeFactory.CreatePacketPipe();
+        VP_PUBLIC_CHK_NULL_RETURN(pipe);
+        if (MOS_FAILED(pipe->AddPacket(hwFilter)))
+        {
+            m_pipeFactory.ReturnPacketPipe(pipe);
+            return MOS_STATUS_UNKNOWN;
+        }
+
+        MOS_STATUS status = m_reuseMgr.UpdatePacketPipeConfig(pipe);
+        // Pipe is kept by packet reuse manager if stored, otherwise returned after execution.
+        m_pipeFactory.ReturnPacketPipe(pipe);
+        return status;
+    }
+
+    //!
+    //! \brief  Run frames alternating between two output sizes, like a scaling ladder
+    //! \return MOS_STATUS
+    //!
+    MOS_STATUS RunAlternating(uint32_t frames, uint32_t &reusedCount)
+    {
+        reusedCount = 0;
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            bool reused = false;
+            VP_PUBLIC_CHK_STATUS_RETURN(RunFrame((i & 1) ? m_small : m_large, reused));
+            reusedCount += reused ? 1 : 0;
+        }
+        return MOS_STATUS_SUCCESS;
+    }
+
+    VpPacketReuseManager &GetReuseManager()
+    {
+        return m_reuseMgr;
+    }
+
+private:
+    VP_MHWINTERFACE               m_hwInterface;
+    VpAllocator                   m_allocator;
+    PVpAllocator                  m_allocatorPtr;
+    VpInterface                   m_vpInterface;
+    VpPlanCacheTestFeatureControl m_featureControl;
+    VpPlanCacheTestPacketFactory  m_packetFactory;
+    PacketPipeFactory             m_pipeFactory;
+    VpPacketReuseManager          m_reuseMgr;
+    Policy                        m_policy;
+    VphalFeatureReport            m_report;
+    VpPlanCacheTestPlatform       m_platform;
+    VpResourceManager             m_resMgr;
+
+public:
+    VpPlanCacheTestStream         m_large;
+    VpPlanCacheTestStream         m_small;
+};
+}  // namespace
+
+class VpPlanCacheTest : public testing::Test
+{
+protected:
+    VpPlanCacheTest()
+    {
+        MOS_ZeroMemory(&m_osInterface, sizeof(m_osInterface));
+        m_osInterface.pfnGetSkuTable            = VpPlanCacheTestGetSkuTable;
+        m_osInterface.pfnGetUserSettingInstance = VpPlanCacheTestGetUserSettingInstance;
+        m_osInterface.pfnGetResourceHandle      = VpPlanCacheTestGetResourceHandle;
+    }
+
+    MOS_INTERFACE m_osInterface;
+};
+
+TEST_F(VpPlanCacheTest, AlternatingOutputsHitPlanCache)
+{
+    VpPlanCacheTestContext context(m_osInterface, true);
+    uint32_t               reusedCount = 0;
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, context.RunAlternating(10, reusedCount));
+    // One pipe built for each output size, then reused from the plan cache.
+    EXPECT_EQ(8u, reusedCount);
+    EXPECT_EQ(2u, context.GetReuseManager().GetPlanCacheMissCount());
+    EXPECT_EQ(8u, context.GetReuseManager().GetPlanCacheHitCount());
+}
+
+TEST_F(VpPlanCacheTest, AlternatingOutputsRebuiltWithoutPlanCache)
+{
+    VpPlanCacheTestContext context(m_osInterface, false);
+    uint32_t               reusedCount = 0;
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, context.RunAlternating(10, reusedCount));
+    EXPECT_EQ(0u, reusedCount);
+    EXPECT_EQ(0u, context.GetReuseManager().GetPlanCacheHitCount());
+}
+
+TEST_F(VpPlanCacheTest, SameOutputReusedWithoutPlanCache)
+{
+    VpPlanCacheTestContext context(m_osInterface, false);
+    uint32_t               reusedCount = 0;
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        bool reused = false;
+        EXPECT_EQ(MOS_STATUS_SUCCESS, context.RunFrame(context.m_large, reused));
+        reusedCount += reused ? 1 : 0;
+    }
+    EXPECT_EQ(9u, reusedCount);
+}
+
+TEST_F(VpPlanCacheTest, DISABLED_PerfAlternatingOutputs)
+{
+    uint32_t loops = HalTestPerfLoops(100000);
+    bool     planCacheValues[] = {false, true};
+
+    for (auto planCache : planCacheValues)
+    {
+        VpPlanCacheTestContext context(m_osInterface, planCache);
+        uint32_t               reusedCount = 0;
+        uint32_t               frames      = 0;
+
+        EXPECT_TRUE(HalTestMeasure(planCache ? "vp.PLAN_CACHE_ON_2_OUTPUTS" : "vp.PLAN_CACHE_OFF_2_OUTPUTS", loops, [&]() {
+            bool reused = false;
+            if (MOS_FAILED(context.RunFrame((frames++ & 1) ? context.m_small : context.m_large, reused)))
+            {
+                return false;
+            }
+            reusedCount += reused ? 1 : 0;
+            return true;
+        }));
+        printf("%-48s %11.1f%% reused (%llu plan cache hits, %llu misses)\n", planCache ? "vp.PLAN_CACHE_ON_2_OUTPUTS" : "vp.PLAN_CACHE_OFF_2_OUTPUTS",
+            100.0 * reusedCount / frames,
+            (unsigned long long)context.GetReuseManager().GetPlanCacheHitCount(),
+            (unsigned long long)context.GetReuseManager().GetPlanCacheMissCount());
+    }
+}
@@ -0,0 +1,145 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     hal_test_vp_scaling_ladder.cpp
+//! \brief    Unit tests of the packet pipes deferred by the VP scaling ladder.
+//! \details  The pipes of a ladder are submitted in one command buffer. Until then
+//!           they must neither be reused by VpPacketReuseManager nor go back to the
+//!           PacketPipeFactory pool, and each output keeps its own execute status.
+//!
+#include "hal_test.h"
+#include "vp_packet_pipe.h"
+
+using namespace vp;
+
+class VpScalingLadderTest : public testing::Test
+{
+protected:
+    VpScalingLadderTest() : m_packetFactory(nullptr), m_pipeFactory(m_packetFactory), m_deferred(m_pipeFactory)
+    {
+    }
+
+    PacketFactory       m_packetFactory;
+    PacketPipeFactory   m_pipeFactory;
+    DeferredPacketPipes m_deferred;
+};
+
+TEST_F(VpScalingLadderTest, OwnedPipeReturnedOnRelease)
+{
+    PacketPipe *pipe = m_pipeFactory.CreatePacketPipe();
+    ASSERT_NE(nullptr, pipe);
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, m_deferred.Add(pipe, true, {1, nullptr}));
+    EXPECT_TRUE(pipe->IsSubmitPending());
+    EXPECT_EQ(1u, m_deferred.Size());
+
+    m_deferred.Release();
+    EXPECT_TRUE(m_deferred.IsEmpty());
+    EXPECT_FALSE(pipe->IsSubmitPending());
+
+    // Pooled by Release, so it is recycled.
+    PacketPipe *next = m_pipeFactory.CreatePacketPipe();
+    EXPECT_EQ(pipe, next);
+    m_pipeFactory.ReturnPacketPipe(next);
+}
+
+TEST_F(VpScalingLadderTest, ReusedPipeStaysWithOwner)
+{
+    PacketPipe *pipe = m_pipeFactory.CreatePacketPipe();
+    ASSERT_NE(nullptr, pipe);
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, m_deferred.Add(pipe, false, {1, nullptr}));
+    m_deferred.Release();
+    EXPECT_FALSE(pipe->IsSubmitPending());
+
+    // Still held by packet reuse manager, so not in the pool.
+    PacketPipe *next = m_pipeFactory.CreatePacketPipe();
+    EXPECT_NE(pipe, next);
+    m_pipeFactory.ReturnPacketPipe(next);
+    m_pipeFactory.ReturnPacketPipe(pipe);
+    EXPECT_EQ(nullptr, pipe);
+}
+
+TEST_F(VpScalingLadderTest, PendingPipeReturnedAfterRelease)
+{
+    PacketPipe *pipe = m_pipeFactory.CreatePacketPipe();
+    PacketPipe *held = pipe;
+    ASSERT_NE(nullptr, pipe);
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, m_deferred.Add(pipe, false, {1, nullptr}));
+
+    // Replaced in packet reuse manager while its packets are still in command task.
+    m_pipeFactory.ReturnPacketPipe(pipe);
+    EXPECT_EQ(nullptr, pipe);
+    EXPECT_TRUE(held->IsSubmitPending());
+
+    PacketPipe *other = m_pipeFactory.CreatePacketPipe();
+    EXPECT_NE(held, other);
+
+    m_deferred.Release();
+    EXPECT_FALSE(held->IsSubmitPending());
+
+    // Now the pool has it.
+    PacketPipe *next = m_pipeFactory.CreatePacketPipe();
+    EXPECT_EQ(held, next);
+    m_pipeFactory.ReturnPacketPipe(next);
+    m_pipeFactory.ReturnPacketPipe(other);
+}
+
+TEST_F(VpScalingLadderTest, PipeDeferredOnce)
+{
+    PacketPipe *pipe = m_pipeFactory.CreatePacketPipe();
+    ASSERT_NE(nullptr, pipe);
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, m_deferred.Add(pipe, false, {1, nullptr}));
+    EXPECT_NE(MOS_STATUS_SUCCESS, m_deferred.Add(pipe, false, {2, nullptr}));
+    EXPECT_NE(MOS_STATUS_SUCCESS, m_deferred.Add(nullptr, true, {3, nullptr}));
+    EXPECT_EQ(1u, m_deferred.Size());
+
+    m_deferred.Release();
+    m_pipeFactory.ReturnPacketPipe(pipe);
+}
+
+TEST_F(VpScalingLadderTest, OutputsKeptInOrder)
+{
+    VPHAL_SURFACE targets[3] = {};
+    PacketPipe   *pipes[3]   = {};
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        pipes[i] = m_pipeFactory.CreatePacketPipe();
+        ASSERT_NE(nullptr, pipes[i]);
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_deferred.Add(pipes[i], i != 1, {10 + i, &targets[i]}));
+    }
+
+    const std::vector<DeferredPacketPipes::Output> &outputs = m_deferred.GetOutputs();
+    ASSERT_EQ(3u, outputs.size());
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(10 + i, outputs[i].frameCounter);
+        EXPECT_EQ(&targets[i], outputs[i].target);
+    }
+
+    m_deferred.Release();
+    EXPECT_TRUE(m_deferred.GetOutputs().empty());
+    m_pipeFactory.ReturnPacketPipe(pipes[1]);
+}
@@ -62,14 +62,16 @@ struct DeviceConfig
     int32_t  aliasing_ppgtt;   // I915_PARAM_HAS_ALIASING_PPGTT
     int32_t  subslice_total;   // I915_PARAM_SUBSLICE_TOTAL
     int32_t  eu_total;         // I915_PARAM_EU_TOTAL
+    int32_t  slice_total;      // LinuxDriverInfo::sliceCount, i915 has no query for it
     uint64_t edram_reg;
 } const DeviceConfigTable[] = {
-#define DEVICECONFIG( aper, devId, rev, flags, fences,ppgtt,subslice, eu, edram_reg ) { aper, devId, rev, flags, fences,ppgtt,subslice, eu, edram_reg},
-    DEVICECONFIG( 4286468096, 0x191e, 0x7, 0x01ff, 32, 3, 3, 24, 0x0 ) // SKL
-    DEVICECONFIG( 4267114496, 0x5a84, 0xb, 0x03df, 32, 3, 3, 18, 0x0 ) // BXT
-    DEVICECONFIG( 4248690688, 0x1606, 0x9, 0x03ff, 32, 3, 2, 12, 0x0 ) // BDW
-    DEVICECONFIG( 4259069952, 0x5a49, 0x3, 0x03ff, 32, 3, 2, 16, 0x0 ) // CNL
-    DEVICECONFIG(          0,    0x0, 0x0,    0x0,  0, 0, 0,  0, 0x0 )
+#define DEVICECONFIG( aper, devId, rev, flags, fences,ppgtt,subslice, eu, slice, edram_reg ) { aper, devId, rev, flags, fences,ppgtt,subslice, eu, slice, edram_reg},
+    DEVICECONFIG( 4286468096, 0x191e, 0x7, 0x01ff, 32, 3, 3, 24, 1, 0x0 ) // SKL
+    DEVICECONFIG( 4267114496, 0x5a84, 0xb, 0x03df, 32, 3, 3, 18, 1, 0x0 ) // BXT
+    DEVICECONFIG( 4248690688, 0x1606, 0x9, 0x03ff, 32, 3, 2, 12, 1, 0x0 ) // BDW
+    DEVICECONFIG( 4259069952, 0x5a49, 0x3, 0x03ff, 32, 3, 2, 16, 1, 0x0 ) // CNL
+    DEVICECONFIG( 4294967296, 0x7d45, 0x4, 0x0fdf, 32, 3, 8,128, 2, 0x0 ) // MTL
+    DEVICECONFIG(          0,    0x0, 0x0,    0x0,  0, 0, 0,  0, 0, 0x0 )
 #undef DEVICECONFIG
 };
 
@@ -81,7 +83,8 @@ typedef enum
     igfxBROXTON    = 1,
     igfxBROADWELL  = 2,
     igfxCANNONLAKE = 3,
-    igfx_MAX       = 4,
+    igfxMETEORLAKE = 4,
+    igfx_MAX       = 5,
 } Platform_t;
 
 extern const char *g_platformName[];
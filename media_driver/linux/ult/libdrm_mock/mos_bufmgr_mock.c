@@ -64,6 +64,8 @@
 
 #include "i915_drm.h"
 #include "mos_vma.h"
+#include "linux_system_info.h"
+#include "devconfig.h"
 
 #ifdef HAVE_VALGRIND
 #include <valgrind.h>
@@ -3774,6 +3776,172 @@ fini:
     return ret;
 }
 
+static int mos_bufmgr_query_engines_count(struct mos_bufmgr *bufmgr,
+                      unsigned int *nengine)
+{
+    if ((bufmgr == nullptr) || (nengine == nullptr))
+    {
+        return -EINVAL;
+    }
+
+    struct drm_i915_query query;
+    struct drm_i915_query_item query_item;
+    struct drm_i915_query_engine_info *engines = nullptr;
+    int ret, len;
+    int fd = ((struct mos_bufmgr_gem*)bufmgr)->fd;
+
+    *nengine = 0;
+    memclear(query_item);
+    query_item.query_id = DRM_I915_QUERY_ENGINE_INFO;
+    query_item.length = 0;
+    memclear(query);
+    query.num_items = 1;
+    query.items_ptr = (uintptr_t)&query_item;
+
+    ret = drmIoctl(fd, DRM_IOCTL_I915_QUERY, &query);
+    if (ret || query_item.length <= 0)
+    {
+        return ret ? ret : -ENODEV;
+    }
+    len = query_item.length;
+
+    engines = (drm_i915_query_engine_info *)calloc(1, len);
+    if (nullptr == engines)
+    {
+        return -ENOMEM;
+    }
+    query_item.data_ptr = (uintptr_t)engines;
+
+    ret = drmIoctl(fd, DRM_IOCTL_I915_QUERY, &query);
+    if (ret == 0)
+    {
+        *nengine = engines->num_engines;
+    }
+
+    free(engines);
+    return ret;
+}
+
+static size_t mos_bufmgr_get_engine_class_size()
+{
+    return sizeof(struct i915_engine_class_instance);
+}
+
+/**
+ * Fills the VDBox and VEBox counts from the mocked engine info query, the same
+ * way as the driver does against a kernel with DRM_I915_QUERY_ENGINE_INFO.
+ */
+static int
+mos_bufmgr_query_sys_engines(struct mos_bufmgr *bufmgr, MEDIA_SYSTEM_INFO* gfx_info)
+{
+    if (nullptr == gfx_info)
+    {
+        return -EINVAL;
+    }
+
+    unsigned int maxNengine = 0;
+    if (mos_bufmgr_query_engines_count(bufmgr, &maxNengine) || (maxNengine == 0))
+    {
+        fprintf(stderr, "%s: Failed to query engines count\n", __FUNCTION__);
+        return -ENODEV;
+    }
+
+    struct i915_engine_class_instance *uengines =
+        (struct i915_engine_class_instance *)calloc(maxNengine, sizeof(struct i915_engine_class_instance));
+    if (nullptr == uengines)
+    {
+        return -ENOMEM;
+    }
+
+    int ret = 0;
+    unsigned int nengine = maxNengine;
+    if (gfx_info->VDBoxInfo.NumberOfVDBoxEnabled == 0)
+    {
+        ret = mos_bufmgr_query_engines(bufmgr, I915_ENGINE_CLASS_VIDEO, 0, &nengine, (void *)uengines);
+        if (ret == 0)
+        {
+            gfx_info->VDBoxInfo.NumberOfVDBoxEnabled = nengine;
+            for (unsigned int i = 0; i < nengine; i++)
+            {
+                gfx_info->VDBoxInfo.Instances.VDBoxEnableMask |= 1 << uengines[i].engine_instance;
+            }
+        }
+    }
+
+    nengine = maxNengine;
+    if (ret == 0 && gfx_info->VEBoxInfo.NumberOfVEBoxEnabled == 0)
+    {
+        ret = mos_bufmgr_query_engines(bufmgr, I915_ENGINE_CLASS_VIDEO_ENHANCE, 0, &nengine, (void *)uengines);
+        if (ret == 0)
+        {
+            gfx_info->VEBoxInfo.NumberOfVEBoxEnabled = nengine;
+        }
+    }
+
+    free(uengines);
+    return ret ? -ENODEV : 0;
+}
+
+static int mos_bufmgr_get_param(int fd, int32_t param, uint32_t *value)
+{
+    drm_i915_getparam_t gp;
+    int tmp = 0;
+
+    memclear(gp);
+    gp.param = param;
+    gp.value = &tmp;
+    if (drmIoctl(fd, DRM_IOCTL_I915_GETPARAM, &gp))
+    {
+        return -1;
+    }
+    *value = tmp;
+    return 0;
+}
+
+static int mos_bufmgr_get_driver_info(struct mos_bufmgr *bufmgr, struct LinuxDriverInfo *drvInfo)
+{
+    if (bufmgr == nullptr || drvInfo == nullptr)
+    {
+        return -EINVAL;
+    }
+    int fd = ((struct mos_bufmgr_gem*)bufmgr)->fd;
+    uint32_t value = 0;
+
+    memset(drvInfo, 0, sizeof(*drvInfo));
+    drvInfo->hasBsd   = (mos_bufmgr_get_param(fd, I915_PARAM_HAS_BSD, &value) == 0) && value;
+    drvInfo->hasBsd2  = (mos_bufmgr_get_param(fd, I915_PARAM_HAS_BSD2, &value) == 0) && value;
+    drvInfo->hasVebox = (mos_bufmgr_get_param(fd, I915_PARAM_HAS_VEBOX, &value) == 0) && value;
+    drvInfo->hasPpgtt = (mos_bufmgr_get_param(fd, I915_PARAM_HAS_ALIASING_PPGTT, &value) == 0) && value;
+    drvInfo->hasHuc   = (mos_bufmgr_get_param(fd, I915_PARAM_HUC_STATUS, &value) == 0) && value;
+    drvInfo->hasProtectedHuc = drvInfo->hasHuc && (value == 1);
+
+    if (mos_bufmgr_get_param(fd, I915_PARAM_CHIPSET_ID, &value) == 0)
+    {
+        drvInfo->devId = value;
+    }
+    if (mos_bufmgr_get_param(fd, I915_PARAM_REVISION, &value) == 0)
+    {
+        drvInfo->devRev = value;
+    }
+    if (mos_bufmgr_get_param(fd, I915_PARAM_EU_TOTAL, &value) == 0)
+    {
+        drvInfo->euCount = value;
+    }
+    if (mos_bufmgr_get_param(fd, I915_PARAM_SUBSLICE_TOTAL, &value) == 0)
+    {
+        drvInfo->subSliceCount = value;
+    }
+
+    // The real bufmgr leaves the slice count to InitMediaSysInfo, whose MTL device info has none.
+    // Report the mocked device's slice count so the system info is not left with zero slices.
+    if (fd > 0 && fd <= (int)(sizeof(DeviceConfigTable) / sizeof(DeviceConfigTable[0])))
+    {
+        drvInfo->sliceCount = DeviceConfigTable[fd - 1].slice_total;
+    }
+
+    return 0;
+}
+
 static int mos_gem_set_context_param_load_balance(struct mos_linux_context *ctx,
                      struct i915_engine_class_instance *ci,
                      unsigned int count)
@@ -3940,6 +4108,10 @@ mos_bufmgr_gem_init(int fd, int batch_size, int *device_type)
     bufmgr_gem->bufmgr.switch_off_n_bits = mos_bufmgr_switch_off_n_bits;
     bufmgr_gem->bufmgr.hweight8 = mos_bufmgr_hweight8;
     bufmgr_gem->bufmgr.query_engines = mos_bufmgr_query_engines;
+    bufmgr_gem->bufmgr.query_engines_count = mos_bufmgr_query_engines_count;
+    bufmgr_gem->bufmgr.get_engine_class_size = mos_bufmgr_get_engine_class_size;
+    bufmgr_gem->bufmgr.query_sys_engines = mos_bufmgr_query_sys_engines;
+    bufmgr_gem->bufmgr.get_driver_info = mos_bufmgr_get_driver_info;
 
     memclear(aperture);
     ret = drmIoctl(bufmgr_gem->fd,
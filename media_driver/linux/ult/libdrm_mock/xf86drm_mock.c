@@ -359,8 +359,79 @@ mosdrmIoctl(int fd, unsigned long request, void *arg)
             ret = 0;
         }
         break;
-        case DRM_IOCTL_I915_GEM_CONTEXT_GETPARAM:
+        case DRM_IOCTL_I915_QUERY:
+        {
+            struct drm_i915_query *query = (struct drm_i915_query *)arg;
+            struct drm_i915_query_item *items = (struct drm_i915_query_item *)(uintptr_t)query->items_ptr;
+            for (uint32_t i = 0; i < query->num_items; i++)
+            {
+                if (items[i].query_id != DRM_I915_QUERY_ENGINE_INFO)
+                {
+                    items[i].length = -EINVAL;
+                    continue;
+                }
+
+                // Render engine, one or two VDBoxes by has_bsd/has_bsd2 and one VEBox by has_vebox
+                struct i915_engine_class_instance engineList[4];
+                uint32_t engineNum = 0;
+                engineList[engineNum++] = {I915_ENGINE_CLASS_RENDER, 0};
+                if (DeviceConfigTable[DevIdx].has_bsd)
+                {
+                    engineList[engineNum++] = {I915_ENGINE_CLASS_VIDEO, 0};
+                }
+                if (DeviceConfigTable[DevIdx].has_bsd2)
+                {
+                    engineList[engineNum++] = {I915_ENGINE_CLASS_VIDEO, 1};
+                }
+                if (DeviceConfigTable[DevIdx].has_vebox)
+                {
+                    engineList[engineNum++] = {I915_ENGINE_CLASS_VIDEO_ENHANCE, 0};
+                }
+
+                int32_t len = sizeof(struct drm_i915_query_engine_info) + engineNum * sizeof(struct drm_i915_engine_info);
+                if (items[i].length == 0)
+                {
+                    items[i].length = len;
+                    continue;
+                }
+                if (items[i].length < len)
+                {
+                    items[i].length = -EINVAL;
+                    continue;
+                }
+
+                struct drm_i915_query_engine_info *info = (struct drm_i915_query_engine_info *)(uintptr_t)items[i].data_ptr;
+                memset(info, 0, len);
+                info->num_engines = engineNum;
+                for (uint32_t j = 0; j < engineNum; j++)
+                {
+                    info->engines[j].engine           = engineList[j];
+                    info->engines[j].logical_instance = engineList[j].engine_instance;
+                    if (engineList[j].engine_class == I915_ENGINE_CLASS_VIDEO && engineList[j].engine_instance == 0)
+                    {
+                        info->engines[j].capabilities = I915_VIDEO_CLASS_CAPABILITY_HEVC | I915_VIDEO_AND_ENHANCE_CLASS_CAPABILITY_SFC;
+                    }
+                    else if (engineList[j].engine_class == I915_ENGINE_CLASS_VIDEO)
+                    {
+                        info->engines[j].capabilities = I915_VIDEO_CLASS_CAPABILITY_HEVC;
+                    }
+                    else if (engineList[j].engine_class == I915_ENGINE_CLASS_VIDEO_ENHANCE)
+                    {
+                        info->engines[j].capabilities = I915_VIDEO_AND_ENHANCE_CLASS_CAPABILITY_SFC;
+                    }
+                }
+            }
+            ret = 0;
+        }
+        break;
         case DRM_IOCTL_I915_GEM_CONTEXT_SETPARAM:
+        {
+            // Engine maps are set up by the softlet GPU contexts, everything else is unsupported
+            struct drm_i915_gem_context_param *param = (struct drm_i915_gem_context_param *)arg;
+            ret = (param->param == I915_CONTEXT_PARAM_ENGINES) ? 0 : -1;
+        }
+        break;
+        case DRM_IOCTL_I915_GEM_CONTEXT_GETPARAM:
         {
             ret = -1;
         }
@@ -0,0 +1,513 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mhw_bench.cpp
+//! \brief    Microbenchmark for softlet MHW command encoding.
+//! \details  Instantiates the MHW interfaces of the softlet platforms on top of a
+//!           mock OS interface and measures the CPU cost of SETCMD + AddCmd for
+//!           representative parameter sets. No GPU or KMD is needed.
+//!           Xe_LPM_plus (MTL) and Xe_HPM (DG2) interfaces are covered when the
+//!           driver is built with the platform, so generation specific command
+//!           costs can be compared side by side.
+//!
+//!           Usage: mhwbench [filter]
+//!           Only cases whose "interface.command" name contains filter are run.
+//!           MHW_BENCH_LOOPS overrides the number of timed iterations per case.
+//!
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mos_utilities.h"
+#if defined(IGFX_MTL_SUPPORTED) || defined(IGFX_DG2_SUPPORTED)
+#include "mhw_render_xe_hpg_impl.h"
+#endif
+#ifdef IGFX_MTL_SUPPORTED
+#include "mhw_mi_xe_lpm_plus_base_next_impl.h"
+#include "mhw_sfc_xe_lpm_plus_base_next_impl.h"
+#include "mhw_vebox_xe_lpm_plus_base_next_impl.h"
+#include "mhw_vdbox_hcp_impl_xe_lpm_plus.h"
+#include "mhw_vdbox_avp_impl_xe_lpm_plus.h"
+#include "mhw_vdbox_vdenc_impl_xe_lpm_plus.h"
+#endif
+#ifdef IGFX_DG2_SUPPORTED
+#include "mhw_mi_xe_xpm_base_impl.h"
+#include "mhw_vebox_xe_hpm_impl.h"
+#include "mhw_vdbox_hcp_impl_xe_hpm.h"
+#include "mhw_vdbox_avp_impl_xe_hpm.h"
+#include "mhw_vdbox_vdenc_impl_xe_hpm.h"
+#endif
+
+using namespace std;
+
+static const uint32_t MHW_BENCH_DEFAULT_LOOPS   = 100000;
+static const uint32_t MHW_BENCH_WARMUP_LOOPS    = 1000;
+static const uint32_t MHW_BENCH_CMD_BUFFER_SIZE = 64 * 1024;
+
+//!
+//! \brief  Mock OS state shared by all MHW interfaces under test
+//!
+struct MhwBenchOs
+{
+    MOS_INTERFACE       osItf         = {};
+    MOS_COMMAND_BUFFER  cmdBuf        = {};
+    vector<uint32_t>    cmdStorage;
+    MOS_RESOURCE        resource      = {};
+    MEDIA_FEATURE_TABLE skuTable;
+    MEDIA_WA_TABLE      waTable;
+    MEDIA_SYSTEM_INFO   gtSystemInfo  = {};
+    uint64_t            bytesWritten  = 0;
+    uint64_t            patchEntries  = 0;
+};
+
+static MhwBenchOs g_benchOs;
+
+static MOS_STATUS MockAddCommand(PMOS_COMMAND_BUFFER cmdBuffer, const void *cmd, uint32_t cmdSize)
+{
+    uint32_t cmdSizeDwAligned = MOS_ALIGN_CEIL(cmdSize, sizeof(uint32_t));
+    if (cmdBuffer->iRemaining < (int32_t)cmdSizeDwAligned)
+    {
+        return MOS_STATUS_NO_SPACE;
+    }
+
+    MosUtilities::MosSecureMemcpy(cmdBuffer->pCmdPtr, cmdBuffer->iRemaining, cmd, cmdSize);
+    cmdBuffer->pCmdPtr    += cmdSizeDwAligned / sizeof(uint32_t);
+    cmdBuffer->iOffset    += cmdSizeDwAligned;
+    cmdBuffer->iRemaining -= cmdSizeDwAligned;
+
+    g_benchOs.bytesWritten += cmdSizeDwAligned;
+    return MOS_STATUS_SUCCESS;
+}
+
+static MediaUserSettingSharedPtr MockGetUserSettingInstance(PMOS_INTERFACE osInterface)
+{
+    return nullptr;
+}
+
+static void MockGetPlatform(PMOS_INTERFACE osInterface, PLATFORM *platform)
+{
+    // Unknown product keeps the render state heap factory from creating a real device
+    MOS_ZeroMemory(platform, sizeof(*platform));
+}
+
+static MEDIA_FEATURE_TABLE *MockGetSkuTable(PMOS_INTERFACE osInterface)
+{
+    return &g_benchOs.skuTable;
+}
+
+static MEDIA_WA_TABLE *MockGetWaTable(PMOS_INTERFACE osInterface)
+{
+    return &g_benchOs.waTable;
+}
+
+static MEDIA_SYSTEM_INFO *MockGetGtSystemInfo(PMOS_INTERFACE osInterface)
+{
+    return &g_benchOs.gtSystemInfo;
+}
+
+static MOS_STATUS MockGetMediaEngineInfo(PMOS_INTERFACE osInterface, MEDIA_ENGINE_INFO &info)
+{
+    MOS_ZeroMemory(&info, sizeof(info));
+    return MOS_STATUS_SUCCESS;
+}
+
+static MOS_GPU_CONTEXT MockGetGpuContext(PMOS_INTERFACE osInterface)
+{
+    return MOS_GPU_CONTEXT_VIDEO;
+}
+
+static MEMORY_OBJECT_CONTROL_STATE MockCachePolicyGetMemoryObject(MOS_HW_RESOURCE_DEF usage, GMM_CLIENT_CONTEXT *gmmClientContext)
+{
+    MEMORY_OBJECT_CONTROL_STATE memObjCtrlState = {};
+    return memObjCtrlState;
+}
+
+static GMM_CLIENT_CONTEXT *MockGetGmmClientContext(PMOS_INTERFACE osInterface)
+{
+    return nullptr;
+}
+
+static MOS_STATUS MockRegisterResource(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource, int32_t write, int32_t writeSetResourceSyncTag)
+{
+    return MOS_STATUS_SUCCESS;
+}
+
+static uint64_t MockGetResourceGfxAddress(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+{
+    return 0x100000000ull;
+}
+
+static int32_t MockGetResourceAllocationIndex(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+{
+    return 0;
+}
+
+static MOS_STATUS MockSetPatchEntry(PMOS_INTERFACE osInterface, PMOS_PATCH_ENTRY_PARAMS params)
+{
+    g_benchOs.patchEntries++;
+    return MOS_STATUS_SUCCESS;
+}
+
+static void InitMockOs()
+{
+    PMOS_INTERFACE osItf = &g_benchOs.osItf;
+
+    osItf->bUsesGfxAddress                = true;
+    osItf->pfnAddCommand                  = MockAddCommand;
+    osItf->pfnGetUserSettingInstance      = MockGetUserSettingInstance;
+    osItf->pfnGetPlatform                 = MockGetPlatform;
+    osItf->pfnGetSkuTable                 = MockGetSkuTable;
+    osItf->pfnGetWaTable                  = MockGetWaTable;
+    osItf->pfnGetGtSystemInfo             = MockGetGtSystemInfo;
+    osItf->pfnGetMediaEngineInfo          = MockGetMediaEngineInfo;
+    osItf->pfnGetGpuContext               = MockGetGpuContext;
+    osItf->pfnCachePolicyGetMemoryObject  = MockCachePolicyGetMemoryObject;
+    osItf->pfnGetGmmClientContext         = MockGetGmmClientContext;
+    osItf->pfnRegisterResource            = MockRegisterResource;
+    osItf->pfnGetResourceGfxAddress       = MockGetResourceGfxAddress;
+    osItf->pfnGetResourceAllocationIndex  = MockGetResourceAllocationIndex;
+    osItf->pfnSetPatchEntry               = MockSetPatchEntry;
+
+    MEDIA_WR_SKU(&g_benchOs.skuTable, FtrPPGTT, 1);
+
+    g_benchOs.gtSystemInfo.EUCount                = 96;
+    g_benchOs.gtSystemInfo.ThreadCount            = 672;
+    g_benchOs.gtSystemInfo.SliceCount             = 1;
+    g_benchOs.gtSystemInfo.SubSliceCount          = 12;
+    g_benchOs.gtSystemInfo.MaxSubSlicesSupported  = 12;
+
+    g_benchOs.cmdStorage.resize(MHW_BENCH_CMD_BUFFER_SIZE / sizeof(uint32_t));
+    g_benchOs.cmdBuf.pCmdBase = g_benchOs.cmdStorage.data();
+}
+
+static void ResetCmdBuffer()
+{
+    g_benchOs.cmdBuf.pCmdPtr    = g_benchOs.cmdBuf.pCmdBase;
+    g_benchOs.cmdBuf.iOffset    = 0;
+    g_benchOs.cmdBuf.iRemaining = MHW_BENCH_CMD_BUFFER_SIZE;
+}
+
+//!
+//! \brief  One command encoding to measure
+//!
+struct MhwBenchCase
+{
+    string                       platform;
+    string                       name;      //!< "interface.command"
+    function<MOS_STATUS()>       addCmd;    //!< Fill params and add one command to g_benchOs.cmdBuf
+};
+
+static MOS_STATUS RunCase(const MhwBenchCase &benchCase, uint32_t loops)
+{
+    // Warm up caches and any lazily created state before counting
+    for (uint32_t i = 0; i < MHW_BENCH_WARMUP_LOOPS; i++)
+    {
+        ResetCmdBuffer();
+        MHW_CHK_STATUS_RETURN(benchCase.addCmd());
+    }
+
+    g_benchOs.bytesWritten = 0;
+    g_benchOs.patchEntries = 0;
+    int32_t allocStart     = MosUtilities::MosGetMemAllocTotalCounter();
+    auto    timeStart      = chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < loops; i++)
+    {
+        if (g_benchOs.cmdBuf.iRemaining < (int32_t)(MHW_BENCH_CMD_BUFFER_SIZE / 2))
+        {
+            ResetCmdBuffer();
+        }
+        MHW_CHK_STATUS_RETURN(benchCase.addCmd());
+    }
+
+    auto    timeEnd  = chrono::steady_clock::now();
+    int32_t allocEnd = MosUtilities::MosGetMemAllocTotalCounter();
+    double  ns       = (double)chrono::duration_cast<chrono::nanoseconds>(timeEnd - timeStart).count();
+
+    printf("%-14s %-40s %10.1f %10.1f %10.3f %10.3f\n",
+        benchCase.platform.c_str(),
+        benchCase.name.c_str(),
+        ns / loops,
+        (double)g_benchOs.bytesWritten / loops,
+        (double)(allocEnd - allocStart) / loops,
+        (double)g_benchOs.patchEntries / loops);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+static void AddMiCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::mi::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "mi.MI_NOOP", [=]() {
+        return itf->MHW_ADDCMD_F(MI_NOOP)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "mi.MI_LOAD_REGISTER_IMM", [=]() {
+        auto &par      = itf->MHW_GETPAR_F(MI_LOAD_REGISTER_IMM)();
+        par            = {};
+        par.dwRegister = 0x1C0000 + 0x2600;
+        par.dwData     = 0x12345678;
+        return itf->MHW_ADDCMD_F(MI_LOAD_REGISTER_IMM)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "mi.MI_STORE_DATA_IMM", [=]() {
+        auto &par       = itf->MHW_GETPAR_F(MI_STORE_DATA_IMM)();
+        par             = {};
+        par.pOsResource = &g_benchOs.resource;
+        par.dwValue     = 0xdeadbeef;
+        return itf->MHW_ADDCMD_F(MI_STORE_DATA_IMM)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "mi.MI_BATCH_BUFFER_END", [=]() {
+        return itf->MHW_ADDCMD_F(MI_BATCH_BUFFER_END)(cmdBuf);
+    }});
+}
+
+static void AddHcpCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::vdbox::hcp::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    // 1920x1080 with 64x64 CTB and 8x8 min CB
+    cases.push_back({platform, "hcp.HCP_PIC_STATE", [=]() {
+        auto &par                       = itf->MHW_GETPAR_F(HCP_PIC_STATE)();
+        par                             = {};
+        par.framewidthinmincbminus1     = 1920 / 8 - 1;
+        par.frameheightinmincbminus1    = 1080 / 8 - 1;
+        par.mincusize                   = 0;
+        par.ctbsizeLcusize              = 3;
+        par.maxtusize                   = 3;
+        par.sampleAdaptiveOffsetEnabled = true;
+        return itf->MHW_ADDCMD_F(HCP_PIC_STATE)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "hcp.HCP_SLICE_STATE", [=]() {
+        auto &par                                         = itf->MHW_GETPAR_F(HCP_SLICE_STATE)();
+        par                                               = {};
+        par.nextslicestartctbxOrNextSliceStartLcuXEncoder = 0;
+        par.nextslicestartctbyOrNextSliceStartLcuYEncoder = 17;
+        par.sliceType                                     = 1;
+        par.lastsliceofpic                                = true;
+        par.sliceTemporalMvpEnableFlag                    = true;
+        return itf->MHW_ADDCMD_F(HCP_SLICE_STATE)(cmdBuf);
+    }});
+}
+
+static void AddVdencCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::vdbox::vdenc::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "vdenc.VDENC_PIPE_MODE_SELECT", [=]() {
+        auto &par                    = itf->MHW_GETPAR_F(VDENC_PIPE_MODE_SELECT)();
+        par                          = {};
+        par.standardSelect           = 1;
+        par.frameStatisticsStreamOut = true;
+        par.tlbPrefetch              = true;
+        par.chromaType               = 1;
+        return itf->MHW_ADDCMD_F(VDENC_PIPE_MODE_SELECT)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "vdenc.VDENC_WALKER_STATE", [=]() {
+        auto &par                    = itf->MHW_GETPAR_F(VDENC_WALKER_STATE)();
+        par                          = {};
+        par.nextTileSliceStartLcuMbX = 30;
+        par.nextTileSliceStartLcuMbY = 17;
+        return itf->MHW_ADDCMD_F(VDENC_WALKER_STATE)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "vdenc.VD_PIPELINE_FLUSH", [=]() {
+        auto &par        = itf->MHW_GETPAR_F(VD_PIPELINE_FLUSH)();
+        par              = {};
+        par.waitDoneHEVC = true;
+        par.flushHEVC    = true;
+        par.flushVDENC   = true;
+        return itf->MHW_ADDCMD_F(VD_PIPELINE_FLUSH)(cmdBuf);
+    }});
+}
+
+static void AddAvpCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::vdbox::avp::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "avp.AVP_PIC_STATE", [=]() {
+        auto &par             = itf->MHW_GETPAR_F(AVP_PIC_STATE)();
+        par                   = {};
+        par.frameWidthMinus1  = 1920 - 1;
+        par.frameHeightMinus1 = 1080 - 1;
+        par.frameType         = 1;
+        par.baseQindex        = 128;
+        return itf->MHW_ADDCMD_F(AVP_PIC_STATE)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "avp.AVP_INLOOP_FILTER_STATE", [=]() {
+        auto &par               = itf->MHW_GETPAR_F(AVP_INLOOP_FILTER_STATE)();
+        par                     = {};
+        par.loopFilterLevel[0]  = 10;
+        par.loopFilterLevel[1]  = 10;
+        par.loopFilterLevel[2]  = 6;
+        par.loopFilterLevel[3]  = 6;
+        par.loopFilterSharpness = 2;
+        return itf->MHW_ADDCMD_F(AVP_INLOOP_FILTER_STATE)(cmdBuf);
+    }});
+}
+
+static void AddVeboxCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::vebox::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "vebox.VEBOX_SURFACE_STATE", [=]() {
+        auto &par               = itf->MHW_GETPAR_F(VEBOX_SURFACE_STATE)();
+        par                     = {};
+        par.Width               = 1920 - 1;
+        par.Height              = 1080 - 1;
+        par.InterleaveChroma    = 1;
+        par.SurfacePitch        = 2048 - 1;
+        par.YOffsetForU         = 1088;
+        par.DerivedSurfacePitch = 2048 - 1;
+        return itf->MHW_ADDCMD_F(VEBOX_SURFACE_STATE)(cmdBuf);
+    }});
+}
+
+static void AddSfcCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::sfc::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "sfc.SFC_LOCK", [=]() {
+        auto &par           = itf->MHW_GETPAR_F(SFC_LOCK)();
+        par                 = {};
+        par.sfcPipeMode     = mhw::sfc::SFC_PIPE_MODE_VEBOX;
+        par.bOutputToMemory = true;
+        return itf->MHW_ADDCMD_F(SFC_LOCK)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "sfc.SFC_IEF_STATE", [=]() {
+        auto &par               = itf->MHW_GETPAR_F(SFC_IEF_STATE)();
+        par                     = {};
+        par.sfcPipeMode         = mhw::sfc::SFC_PIPE_MODE_VEBOX;
+        par.bIEFEnable          = true;
+        par.StrongEdgeWeight    = 7;
+        par.RegularWeight       = 2;
+        par.StrongEdgeThreshold = 8;
+        return itf->MHW_ADDCMD_F(SFC_IEF_STATE)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "sfc.SFC_FRAME_START", [=]() {
+        auto &par       = itf->MHW_GETPAR_F(SFC_FRAME_START)();
+        par             = {};
+        par.sfcPipeMode = mhw::sfc::SFC_PIPE_MODE_VEBOX;
+        return itf->MHW_ADDCMD_F(SFC_FRAME_START)(cmdBuf);
+    }});
+}
+
+static void AddRenderCases(vector<MhwBenchCase> &cases, shared_ptr<mhw::render::Itf> itf, const char *platform)
+{
+    PMOS_COMMAND_BUFFER cmdBuf = &g_benchOs.cmdBuf;
+
+    cases.push_back({platform, "render.PIPELINE_SELECT", [=]() {
+        auto &par     = itf->MHW_GETPAR_F(PIPELINE_SELECT)();
+        par           = {};
+        par.gpGpuPipe = true;
+        return itf->MHW_ADDCMD_F(PIPELINE_SELECT)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "render.STATE_COMPUTE_MODE", [=]() {
+        auto &par = itf->MHW_GETPAR_F(STATE_COMPUTE_MODE)();
+        par       = {};
+        return itf->MHW_ADDCMD_F(STATE_COMPUTE_MODE)(cmdBuf);
+    }});
+
+    cases.push_back({platform, "render.CFE_STATE", [=]() {
+        auto &par                    = itf->MHW_GETPAR_F(CFE_STATE)();
+        par                          = {};
+        par.dwMaximumNumberofThreads = 672;
+        par.NumberOfWalkers          = 1;
+        return itf->MHW_ADDCMD_F(CFE_STATE)(cmdBuf);
+    }});
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = (argc > 1) ? argv[1] : nullptr;
+    uint32_t    loops  = MHW_BENCH_DEFAULT_LOOPS;
+    const char *env    = getenv("MHW_BENCH_LOOPS");
+    if (env && atoi(env) > 0)
+    {
+        loops = (uint32_t)atoi(env);
+    }
+
+    InitMockOs();
+    MosUtilities::MosSetPerfCounterFlag(1);
+
+    PMOS_INTERFACE osItf = &g_benchOs.osItf;
+
+    vector<MhwBenchCase> cases;
+
+#ifdef IGFX_MTL_SUPPORTED
+    // Interfaces are created the same way as MhwInterfacesXe_Lpm_Plus_Next::Initialize does
+    AddMiCases(cases, make_shared<mhw::mi::xe_lpm_plus_base_next::Impl>(osItf), "Xe_LPM_plus");
+    AddHcpCases(cases, make_shared<mhw::vdbox::hcp::xe_lpm_plus_base::v0::Impl>(osItf), "Xe_LPM_plus");
+    AddVdencCases(cases, make_shared<mhw::vdbox::vdenc::xe_lpm_plus_base::v0::Impl>(osItf), "Xe_LPM_plus");
+    AddAvpCases(cases, make_shared<mhw::vdbox::avp::xe_lpm_plus_base::v0::Impl>(osItf), "Xe_LPM_plus");
+    AddVeboxCases(cases, make_shared<mhw::vebox::xe_lpm_plus_next::Impl>(osItf), "Xe_LPM_plus");
+    AddSfcCases(cases, make_shared<mhw::sfc::xe_lpm_plus_next::Impl>(osItf), "Xe_LPM_plus");
+#endif
+
+#ifdef IGFX_DG2_SUPPORTED
+    // Interfaces are the new MHW ones the MhwInterfacesDg2 legacy wrappers create.
+    // DG2 has no softlet SFC interface, so SFC is only covered on Xe_LPM_plus.
+    AddMiCases(cases, make_shared<mhw::mi::xe_xpm_base::Impl>(osItf), "Xe_HPM");
+    AddHcpCases(cases, make_shared<mhw::vdbox::hcp::xe_xpm_base::xe_hpm::Impl>(osItf), "Xe_HPM");
+    AddVdencCases(cases, make_shared<mhw::vdbox::vdenc::xe_hpm::Impl>(osItf), "Xe_HPM");
+    AddAvpCases(cases, make_shared<mhw::vdbox::avp::xe_hpm::Impl>(osItf), "Xe_HPM");
+    AddVeboxCases(cases, make_shared<mhw::vebox::xe_hpm::Impl>(osItf), "Xe_HPM");
+#endif
+
+#if defined(IGFX_MTL_SUPPORTED) || defined(IGFX_DG2_SUPPORTED)
+    AddRenderCases(cases, make_shared<mhw::render::xe_hpg::Impl>(osItf), "Xe_HPG");
+#endif
+
+    printf("MHW command encoding benchmark, %u loops per case\n", loops);
+    printf("%-14s %-40s %10s %10s %10s %10s\n", "platform", "command", "ns/cmd", "bytes/cmd", "allocs/cmd", "patch/cmd");
+
+    int failures = 0;
+
+    for (auto &benchCase : cases)
+    {
+        if (filter && benchCase.name.find(filter) == string::npos)
+        {
+            continue;
+        }
+        if (RunCase(benchCase, loops) != MOS_STATUS_SUCCESS)
+        {
+            printf("%-14s %-40s failed\n", benchCase.platform.c_str(), benchCase.name.c_str());
+            failures++;
+        }
+    }
+
+    MosUtilities::MosSetPerfCounterFlag(0);
+    return failures ? 1 : 0;
+}
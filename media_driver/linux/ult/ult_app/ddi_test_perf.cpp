@@ -0,0 +1,654 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <algorithm>
+#include "ddi_test_perf.h"
+#include "ddi_media_context.h"
+#include "media_libva_caps_next.h"
+
+using namespace std;
+
+extern vector<Platform_t> g_platform;
+
+// Platforms whose media interfaces create the softlet pipelines, the legacy ones run codechal
+static const vector<Platform_t> g_softletPlatforms = {
+#ifdef IGFX_MTL_SUPPORTED
+    igfxMETEORLAKE,
+#endif
+};
+
+static const char *g_perfStageName[PERF_STAGE_COUNT] = {
+    "BeginPicture",
+    "RenderPicture",
+    "EndPicture",
+    "Sync",
+    "DestroyBuffer",
+};
+
+static PerfStream MakePerfStream(const char *name, DecTestData *pDecData)
+{
+    PerfStream stream;
+    stream.name              = name;
+    stream.featureId         = pDecData->GetFeatureID();
+    stream.width             = pDecData->GetWidth();
+    stream.height            = pDecData->GetHeight();
+    stream.frameNum          = pDecData->m_num_frames;
+    stream.isEncode          = false;
+    stream.compBufs          = &pDecData->GetCompBuffers();
+    stream.resources         = &pDecData->GetResources();
+    stream.confAttrib        = &pDecData->GetConfAttrib();
+    stream.updateCompBuffers = [pDecData](int frameId) { pDecData->UpdateCompBuffers(frameId); };
+    return stream;
+}
+
+static PerfStream MakePerfStream(const char *name, EncTestData *pEncData)
+{
+    PerfStream stream;
+    stream.name              = name;
+    stream.featureId         = pEncData->GetFeatureID();
+    stream.width             = pEncData->GetWidth();
+    stream.height            = pEncData->GetHeight();
+    stream.frameNum          = pEncData->m_num_frames;
+    stream.isEncode          = true;
+    stream.compBufs          = &pEncData->GetCompBuffers();
+    stream.resources         = &pEncData->GetResources();
+    stream.confAttrib        = &pEncData->GetConfAttrib();
+    stream.surfAttrib        = &pEncData->GetSurfAttrib();
+    stream.updateCompBuffers = [pEncData](int frameId) { pEncData->UpdateCompBuffers(frameId); };
+    return stream;
+}
+
+static void SetVpRegion(VARectangle &region, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    region.x      = x;
+    region.y      = y;
+    region.width  = width;
+    region.height = height;
+}
+
+static PerfStream MakeVpPerfStream(const char *name, VpPerfData &vpData, uint32_t layerNum)
+{
+    const uint32_t width    = 1920;
+    const uint32_t height   = 1080;
+    const int      frameNum = 8;
+
+    // Surface 0 is the output, surface k + 1 the input of layer k
+    vpData.resources.resize(layerNum + 1);
+    vpData.confAttrib.resize(1);
+    vpData.confAttrib[0].type  = VAConfigAttribRTFormat;
+    vpData.confAttrib[0].value = VA_RT_FORMAT_YUV420;
+
+    vpData.blendState.flags        = VA_BLEND_GLOBAL_ALPHA;
+    vpData.blendState.global_alpha = 0.5f;
+
+    vpData.pipelineParams.resize(layerNum);
+    vpData.srcRegions.resize(layerNum);
+    vpData.dstRegions.resize(layerNum);
+    for (uint32_t k = 0; k < layerNum; k++)
+    {
+        // Layer 0 is upscaled 2x to the full output with BT.601 to BT.709 CSC, further layers
+        // are downscaled and blended into the bottom right quarter.
+        if (k == 0)
+        {
+            SetVpRegion(vpData.srcRegions[k], 0, 0, width / 2, height / 2);
+            SetVpRegion(vpData.dstRegions[k], 0, 0, width, height);
+        }
+        else
+        {
+            SetVpRegion(vpData.srcRegions[k], 0, 0, width, height);
+            SetVpRegion(vpData.dstRegions[k], width / 2, height / 2, width / 2, height / 2);
+        }
+
+        VAProcPipelineParameterBuffer &param = vpData.pipelineParams[k];
+        memset(&param, 0, sizeof(param));
+        param.surface_region          = &vpData.srcRegions[k];
+        param.surface_color_standard  = VAProcColorStandardBT601;
+        param.output_region           = &vpData.dstRegions[k];
+        param.output_background_color = 0xff000000;
+        param.output_color_standard   = VAProcColorStandardBT709;
+        param.blend_state             = (k == 0) ? nullptr : &vpData.blendState;
+    }
+
+    vpData.compBufs.resize(frameNum);
+    for (auto &frameBufs : vpData.compBufs)
+    {
+        frameBufs.resize(layerNum);
+        for (uint32_t k = 0; k < layerNum; k++)
+        {
+            frameBufs[k] = { VAProcPipelineParameterBufferType, (uint32_t)sizeof(VAProcPipelineParameterBuffer), &vpData.pipelineParams[k], 0 };
+        }
+    }
+
+    PerfStream stream;
+    stream.name              = name;
+    stream.featureId         = { VAProfileNone, VAEntrypointVideoProc };
+    stream.width             = width;
+    stream.height            = height;
+    stream.frameNum          = frameNum;
+    stream.isVp              = true;
+    stream.compBufs          = &vpData.compBufs;
+    stream.resources         = &vpData.resources;
+    stream.confAttrib        = &vpData.confAttrib;
+    stream.updateCompBuffers = [&vpData](int frameId) {
+        for (uint32_t k = 0; k < vpData.pipelineParams.size(); k++)
+        {
+            vpData.pipelineParams[k].surface = vpData.resources[k + 1];
+        }
+    };
+    return stream;
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_DecodeAVC)
+{
+    DecTestData *pDecData = m_decDataFactory.GetDecTestData("AVC-Long");
+    ASSERT_NE(nullptr, pDecData);
+    PerfStream stream = MakePerfStream("Decode AVC", pDecData);
+    ExecutePerfTest(stream);
+    delete pDecData;
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_DecodeHEVC)
+{
+    DecTestData *pDecData = m_decDataFactory.GetDecTestData("HEVC-Long");
+    ASSERT_NE(nullptr, pDecData);
+    PerfStream stream = MakePerfStream("Decode HEVC", pDecData);
+    ExecutePerfTest(stream);
+    delete pDecData;
+}
+
+static vector<uint32_t> GetPerfSliceNums()
+{
+    vector<uint32_t> sliceNums;
+    const char      *slicesStr = getenv("DEVULT_PERF_SLICES");
+    for (const char *p = slicesStr ? slicesStr : "1,16,64,256"; *p; )
+    {
+        char    *end = nullptr;
+        uint32_t num = strtoul(p, &end, 10);
+        if (end == p)
+        {
+            break;
+        }
+        if (num > 0)
+        {
+            sliceNums.push_back(num);
+        }
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return sliceNums;
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_DecodeHEVCSlices)
+{
+    for (auto sliceNum : GetPerfSliceNums())
+    {
+        DecTestData *pDecData = m_decDataFactory.GetDecTestData("HEVC-Long");
+        ASSERT_NE(nullptr, pDecData);
+
+        // 32x32 CTBs, the picture is grown to have at least one CTB per slice since
+        // the softlet decoder rejects duplicated slice segment addresses.
+        uint32_t width  = 512;
+        uint32_t height = max(2u, (sliceNum + 15) / 16) * 32;
+        for (auto &frameBufs : pDecData->GetCompBuffers())
+        {
+            VAPictureParameterBufferHEVC *pps = (VAPictureParameterBufferHEVC *)frameBufs[0].pData;
+            pps->pic_width_in_luma_samples    = width;
+            pps->pic_height_in_luma_samples   = height;
+        }
+
+        string     name   = "Decode HEVC " + to_string(sliceNum) + " slices";
+        PerfStream stream = MakePerfStream(name.c_str(), pDecData);
+        stream.width      = width;
+        stream.height     = height;
+        ExecuteSliceScalingTest(stream, sizeof(VASliceParameterBufferHEVC), sliceNum,
+            [sliceNum](uint8_t *slcParam, uint32_t slcIdx) {
+                VASliceParameterBufferHEVC *slc           = (VASliceParameterBufferHEVC *)slcParam;
+                slc->slice_segment_address                = slcIdx;
+                slc->LongSliceFlags.fields.LastSliceOfPic = (slcIdx == sliceNum - 1);
+            });
+        delete pDecData;
+    }
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_DecodeAVCSlices)
+{
+    for (auto sliceNum : GetPerfSliceNums())
+    {
+        DecTestData *pDecData = m_decDataFactory.GetDecTestData("AVC-Long");
+        ASSERT_NE(nullptr, pDecData);
+
+        // The recorded stream is 40x30 MBs, it is grown to have at least one MB row per
+        // slice since the softlet decoder skips slices that do not start after the previous one.
+        uint32_t widthInMb  = 40;
+        uint32_t heightInMb = max(30u, sliceNum);
+        for (auto &frameBufs : pDecData->GetCompBuffers())
+        {
+            VAPictureParameterBufferH264 *pps = (VAPictureParameterBufferH264 *)frameBufs[0].pData;
+            pps->picture_width_in_mbs_minus1  = widthInMb - 1;
+            pps->picture_height_in_mbs_minus1 = heightInMb - 1;
+        }
+
+        string     name   = "Decode AVC " + to_string(sliceNum) + " slices";
+        PerfStream stream = MakePerfStream(name.c_str(), pDecData);
+        stream.width      = widthInMb * 16;
+        stream.height     = heightInMb * 16;
+        ExecuteSliceScalingTest(stream, sizeof(VASliceParameterBufferH264), sliceNum,
+            [sliceNum, widthInMb, heightInMb](uint8_t *slcParam, uint32_t slcIdx) {
+                VASliceParameterBufferH264 *slc = (VASliceParameterBufferH264 *)slcParam;
+                slc->first_mb_in_slice          = slcIdx * (heightInMb / sliceNum) * widthInMb;
+            });
+        delete pDecData;
+    }
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_EncodeAVCVDEnc)
+{
+    EncTestData *pEncData = m_encTestFactory.GetEncTestData("AVC-VDEnc");
+    ASSERT_NE(nullptr, pEncData);
+    PerfStream stream = MakePerfStream("Encode AVC VDEnc", pEncData);
+    ExecutePerfTest(stream);
+    delete pEncData;
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_EncodeHEVCVDEnc)
+{
+    EncTestData *pEncData = m_encTestFactory.GetEncTestData("HEVC-VDEnc");
+    ASSERT_NE(nullptr, pEncData);
+    PerfStream stream = MakePerfStream("Encode HEVC VDEnc", pEncData);
+    ExecutePerfTest(stream);
+    delete pEncData;
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_VpScaleCsc)
+{
+    VpPerfData vpData;
+    PerfStream stream = MakeVpPerfStream("VP scale+CSC", vpData, 1);
+    ExecutePerfTest(stream);
+}
+
+TEST_F(MediaPerfDdiTest, DISABLED_VpComposition)
+{
+    VpPerfData vpData;
+    PerfStream stream = MakeVpPerfStream("VP composition 2 layers", vpData, 2);
+    ExecutePerfTest(stream);
+}
+
+static long GetResidentKb()
+{
+    long  totalPages    = 0;
+    long  residentPages = 0;
+    FILE *statm         = fopen("/proc/self/statm", "r");
+    if (statm == nullptr)
+    {
+        return 0;
+    }
+    if (fscanf(statm, "%ld %ld", &totalPages, &residentPages) != 2)
+    {
+        residentPages = 0;
+    }
+    fclose(statm);
+    return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+TEST_F(MediaPerfDdiTest, CapsConfigsMaterializedOnFirstUse)
+{
+    if (m_platforms.empty())
+    {
+        GTEST_SKIP() << "No selected platform uses the softlet caps table";
+    }
+
+    for (auto platform : m_platforms)
+    {
+        long residentStart = GetResidentKb();
+        auto initStart     = chrono::steady_clock::now();
+        int  ret           = m_driverLoader.InitDriver(platform);
+        auto initEnd       = chrono::steady_clock::now();
+        ASSERT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.InitDriver" << endl;
+        long residentEnd = GetResidentKb();
+
+        VADriverContext    &ctx     = m_driverLoader.m_ctx;
+        PDDI_MEDIA_CONTEXT mediaCtx = (PDDI_MEDIA_CONTEXT)ctx.pDriverData;
+        ASSERT_NE(nullptr, mediaCtx);
+        ASSERT_NE(nullptr, mediaCtx->m_capsNext);
+        MediaCapsTableSpecific *capsTable = mediaCtx->m_capsNext->m_capsTable;
+        ASSERT_NE(nullptr, capsTable);
+
+        // vaInitialize only reserves the config index ranges
+        uint32_t configNum = capsTable->GetConfigNum();
+        EXPECT_LT(0u, configNum);
+        EXPECT_EQ(0u, capsTable->GetMaterializedConfigNum());
+
+        VAConfigID configId = 0;
+        ret = ctx.vtable->vaCreateConfig(&ctx, VAProfileH264Main, VAEntrypointVLD, nullptr, 0, &configId);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateConfig" << endl;
+
+        // Only the configs of AVC VLD are materialized
+        uint32_t materializedNum = capsTable->GetMaterializedConfigNum();
+        EXPECT_LT(0u, materializedNum);
+        EXPECT_GT(configNum, materializedNum);
+
+        // Later queries of the config find it without materializing it again
+        VAProfile              profile    = VAProfileNone;
+        VAEntrypoint           entrypoint = VAEntrypointVLD;
+        int32_t                numAttribs = 0;
+        vector<VAConfigAttrib> attribs(ctx.max_attributes);
+        ret = ctx.vtable->vaQueryConfigAttributes(&ctx, configId, &profile, &entrypoint, attribs.data(), &numAttribs);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.m_ctx.vtable->vaQueryConfigAttributes" << endl;
+        EXPECT_EQ(VAProfileH264Main, profile);
+        EXPECT_EQ(materializedNum, capsTable->GetMaterializedConfigNum());
+
+        printf("[ PERF     ] Caps on %s: vaInitialize %.0f us, resident %+ld KB, %d MOS allocations live\n",
+            g_platformName[platform],
+            chrono::duration_cast<chrono::nanoseconds>(initEnd - initStart).count() / 1000.0,
+            residentEnd - residentStart,
+            m_driverLoader.GetDriverSymbols().MOS_GetMemNinjaCounter());
+        printf("[ PERF     ] Caps on %s: %u of %u configs materialized after one vaCreateConfig, %zu of %zu bytes\n",
+            g_platformName[platform], materializedNum, configNum,
+            materializedNum * sizeof(ConfigLinux), configNum * sizeof(ConfigLinux));
+
+        ret = ctx.vtable->vaDestroyConfig(&ctx, configId);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyConfig" << endl;
+
+        ret = m_driverLoader.CloseDriver(false);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.CloseDriver" << endl;
+    }
+}
+
+void MediaPerfDdiTest::SetUp()
+{
+    for (auto platform : g_softletPlatforms)
+    {
+        if (g_platform.empty() || find(g_platform.begin(), g_platform.end(), platform) != g_platform.end())
+        {
+            m_platforms.push_back(platform);
+        }
+    }
+}
+
+void MediaPerfDdiTest::ExecutePerfTest(PerfStream &stream)
+{
+    // A build or selection without a softlet platform must not pass silently
+    ASSERT_FALSE(m_platforms.empty()) << "No selected platform runs the softlet pipelines, " << stream.name << " cannot run";
+
+    for (auto platform : m_platforms)
+    {
+        // No command validation, only the driver CPU cost is of interest
+        CmdValidator::GetInstance()->Reset();
+        PerfExecute(stream, platform);
+    }
+}
+
+void MediaPerfDdiTest::ExecuteSliceScalingTest(PerfStream &stream, uint32_t slcSize, uint32_t sliceNum,
+    const function<void(uint8_t *, uint32_t)> &setSlice)
+{
+    // Every frame sends the recorded slice sliceNum times in one slice parameter buffer, each copy
+    // moved to its own position in the picture, so the per slice cost of the DDI and the softlet
+    // slice packets dominates as the count grows.
+    vector<vector<CompBufConif>> &compBufs = *stream.compBufs;
+    vector<vector<uint8_t>>       slcParams(compBufs.size());
+    vector<void *>                slcSrc(compBufs.size());
+    for (uint32_t i = 0; i < compBufs.size(); i++)
+    {
+        slcSrc[i] = compBufs[i][1].pData;
+        slcParams[i].resize(slcSize * sliceNum);
+        compBufs[i][1].pData   = &slcParams[i][0];
+        compBufs[i][1].bufSize = slcSize * sliceNum;
+    }
+    auto replicate = [&](int frameId) {
+        for (uint32_t j = 0; j < sliceNum; j++)
+        {
+            memcpy(&slcParams[frameId][j * slcSize], slcSrc[frameId], slcSize);
+            setSlice(&slcParams[frameId][j * slcSize], j);
+        }
+    };
+    for (uint32_t i = 0; i < compBufs.size(); i++)
+    {
+        replicate(i);
+    }
+
+    function<void(int)> updateCompBuffers = stream.updateCompBuffers;
+    stream.sliceNum          = sliceNum;
+    stream.updateCompBuffers = [&updateCompBuffers, &replicate](int frameId) {
+        updateCompBuffers(frameId);
+        replicate(frameId);
+    };
+    ExecutePerfTest(stream);
+
+    for (uint32_t i = 0; i < compBufs.size(); i++)
+    {
+        compBufs[i][1].pData   = slcSrc[i];
+        compBufs[i][1].bufSize = slcSize;
+    }
+}
+
+void MediaPerfDdiTest::BeginStage()
+{
+    const DriverSymbols &drvSyms = m_driverLoader.GetDriverSymbols();
+
+    m_stageAllocStart = drvSyms.MOS_GetMemAllocTotalCounter ? drvSyms.MOS_GetMemAllocTotalCounter() : 0;
+    m_stageLockStart  = drvSyms.MOS_GetMutexLockCounter ? drvSyms.MOS_GetMutexLockCounter() : 0;
+    m_stageStart      = chrono::steady_clock::now();
+}
+
+void MediaPerfDdiTest::EndStage(PerfStage stage)
+{
+    auto stageEnd = chrono::steady_clock::now();
+
+    if (!m_measure)
+    {
+        return;
+    }
+
+    const DriverSymbols &drvSyms = m_driverLoader.GetDriverSymbols();
+
+    m_stats[stage].timeNs += chrono::duration_cast<chrono::nanoseconds>(stageEnd - m_stageStart).count();
+    if (drvSyms.MOS_GetMemAllocTotalCounter)
+    {
+        m_stats[stage].allocNum += drvSyms.MOS_GetMemAllocTotalCounter() - m_stageAllocStart;
+    }
+    if (drvSyms.MOS_GetMutexLockCounter)
+    {
+        m_stats[stage].lockNum += drvSyms.MOS_GetMutexLockCounter() - m_stageLockStart;
+    }
+}
+
+void MediaPerfDdiTest::PerfExecute(PerfStream &stream, Platform_t platform)
+{
+    VAConfigID      config_id;
+    VAContextID     context_id;
+    VASurfaceStatus surface_status;
+
+    const char *loopsStr = getenv("DEVULT_PERF_LOOPS");
+    int         loops    = loopsStr ? atoi(loopsStr) : 20;
+    loops                = loops > 0 ? loops : 20;
+
+    for (auto &stats : m_stats)
+    {
+        stats = {};
+    }
+
+    int ret = m_driverLoader.InitDriver(platform);
+    ASSERT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.InitDriver" << endl;
+
+    const DriverSymbols &drvSyms = m_driverLoader.GetDriverSymbols();
+    if (drvSyms.MOS_SetPerfCounterFlag)
+    {
+        drvSyms.MOS_SetPerfCounterFlag(1);
+    }
+
+    ret = m_driverLoader.m_ctx.vtable->vaCreateConfig(&m_driverLoader.m_ctx,
+        stream.featureId.profile, stream.featureId.entrypoint,
+        &(*stream.confAttrib)[0], stream.confAttrib->size(), &config_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateConfig" << endl;
+
+    vector<VASurfaceID> &resources = *stream.resources;
+    ret = m_driverLoader.m_ctx.vtable->vaCreateSurfaces2(&m_driverLoader.m_ctx, VA_RT_FORMAT_YUV420,
+        stream.width, stream.height, &resources[0], resources.size(),
+        stream.surfAttrib ? &(*stream.surfAttrib)[0] : nullptr, stream.surfAttrib ? stream.surfAttrib->size() : 0);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateSurfaces2" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaCreateContext(&m_driverLoader.m_ctx, config_id, stream.width,
+        stream.height, VA_PROGRESSIVE, &resources[0], resources.size(), &context_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateContext" << endl;
+
+    vector<vector<CompBufConif>> &compBufs = *stream.compBufs;
+
+    // Loop 0 warms up the driver internal pools and caches and isn't measured
+    for (int loop = 0; loop <= loops; loop++)
+    {
+        m_measure = (loop > 0);
+
+        for (int i = 0; i < stream.frameNum; i++)
+        {
+            BeginStage();
+            ret = m_driverLoader.m_ctx.vtable->vaBeginPicture(&m_driverLoader.m_ctx, context_id, resources[0]);
+            EndStage(PERF_STAGE_BEGIN_PICTURE);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaBeginPicture" << endl;
+
+            BeginStage();
+            if (stream.isVp)
+            {
+                stream.updateCompBuffers(i);
+            }
+            for (int j = 0; j < compBufs[i].size(); j++)
+            {
+                uint32_t numElements = (compBufs[i][j].bufType == VASliceParameterBufferType) ? stream.sliceNum : 1;
+                ret = m_driverLoader.m_ctx.vtable->vaCreateBuffer(&m_driverLoader.m_ctx, context_id,
+                    compBufs[i][j].bufType, compBufs[i][j].bufSize / numElements, numElements,
+                    compBufs[i][j].pData, &compBufs[i][j].bufID);
+                EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                    << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateBuffer" << endl;
+                if (stream.isEncode && j == 0)
+                {
+                    // Coded buffer id is referenced by the picture parameters of the frame
+                    stream.updateCompBuffers(i);
+                }
+            }
+            if (!stream.isEncode && !stream.isVp)
+            {
+                stream.updateCompBuffers(i);
+            }
+            for (int j = stream.isEncode ? 1 : 0; j < compBufs[i].size(); j++)
+            {
+                ret = m_driverLoader.m_ctx.vtable->vaRenderPicture(&m_driverLoader.m_ctx,
+                    context_id, &compBufs[i][j].bufID, 1);
+                EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                    << ", Failed function = m_driverLoader.m_ctx.vtable->vaRenderPicture" << endl;
+            }
+            EndStage(PERF_STAGE_RENDER_PICTURE);
+
+            BeginStage();
+            ret = m_driverLoader.m_ctx.vtable->vaEndPicture(&m_driverLoader.m_ctx, context_id);
+            EndStage(PERF_STAGE_END_PICTURE);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaEndPicture" << endl;
+
+            BeginStage();
+            ret = m_driverLoader.m_ctx.vtable->vaSyncSurface(&m_driverLoader.m_ctx, resources[0]);
+            do
+            {
+                m_driverLoader.m_ctx.vtable->vaQuerySurfaceStatus(&m_driverLoader.m_ctx,
+                    resources[0], &surface_status);
+            } while (surface_status != VASurfaceReady);
+            EndStage(PERF_STAGE_SYNC);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaSyncSurface" << endl;
+
+            BeginStage();
+            for (int j = 0; j < compBufs[i].size(); j++)
+            {
+                ret = m_driverLoader.m_ctx.vtable->vaDestroyBuffer(&m_driverLoader.m_ctx, compBufs[i][j].bufID);
+                EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                    << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyBuffer" << endl;
+            }
+            EndStage(PERF_STAGE_DESTROY_BUFFER);
+        }
+    }
+
+    Report(stream, platform, loops * stream.frameNum);
+
+    if (drvSyms.MOS_SetPerfCounterFlag)
+    {
+        drvSyms.MOS_SetPerfCounterFlag(0);
+    }
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroySurfaces(&m_driverLoader.m_ctx, &resources[0], resources.size());
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroySurfaces" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroyContext(&m_driverLoader.m_ctx, context_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyContext" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroyConfig(&m_driverLoader.m_ctx, config_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyConfig" << endl;
+
+    ret = m_driverLoader.CloseDriver(false);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.CloseDriver" << endl;
+}
+
+void MediaPerfDdiTest::Report(const PerfStream &stream, Platform_t platform, uint32_t frameNum) const
+{
+    const DriverSymbols &drvSyms = m_driverLoader.GetDriverSymbols();
+    bool hasCounters = drvSyms.MOS_GetMemAllocTotalCounter && drvSyms.MOS_GetMutexLockCounter;
+
+    printf("[ PERF     ] %s on %s, %u frames\n", stream.name, g_platformName[platform], frameNum);
+    printf("[ PERF     ] %-16s %12s %14s %13s\n", "stage", "ns/frame", "allocs/frame", "locks/frame");
+
+    PerfStageStats total;
+    for (int stage = 0; stage < PERF_STAGE_COUNT; stage++)
+    {
+        total.timeNs   += m_stats[stage].timeNs;
+        total.allocNum += m_stats[stage].allocNum;
+        total.lockNum  += m_stats[stage].lockNum;
+    }
+
+    for (int stage = 0; stage <= PERF_STAGE_COUNT; stage++)
+    {
+        const PerfStageStats &stats = (stage < PERF_STAGE_COUNT) ? m_stats[stage] : total;
+        const char           *name  = (stage < PERF_STAGE_COUNT) ? g_perfStageName[stage] : "Total";
+        if (hasCounters)
+        {
+            printf("[ PERF     ] %-16s %12.0f %14.2f %13.2f\n", name,
+                (double)stats.timeNs / frameNum, (double)stats.allocNum / frameNum, (double)stats.lockNum / frameNum);
+        }
+        else
+        {
+            printf("[ PERF     ] %-16s %12.0f %14s %13s\n", name, (double)stats.timeNs / frameNum, "n/a", "n/a");
+        }
+    }
+}
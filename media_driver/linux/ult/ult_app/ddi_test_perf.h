@@ -0,0 +1,137 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef __DDI_TEST_PERF_H__
+#define __DDI_TEST_PERF_H__
+
+#include <chrono>
+#include <functional>
+#include "ddi_test_decode.h"
+#include "ddi_test_encode.h"
+
+//!
+//! \brief  Per frame stages of the DDI call sequence measured by the benchmark
+//!
+enum PerfStage
+{
+    PERF_STAGE_BEGIN_PICTURE,
+    PERF_STAGE_RENDER_PICTURE,
+    PERF_STAGE_END_PICTURE,
+    PERF_STAGE_SYNC,
+    PERF_STAGE_DESTROY_BUFFER,
+    PERF_STAGE_COUNT
+};
+
+//!
+//! \brief  Accumulated cost of one stage
+//!
+struct PerfStageStats
+{
+    uint64_t timeNs   = 0;
+    int64_t  allocNum = 0;
+    int64_t  lockNum  = 0;
+};
+
+//!
+//! \brief  Recorded DDI parameter stream replayed by the benchmark
+//!
+struct PerfStream
+{
+    const char                             *name       = nullptr;
+    FeatureID                              featureId   = {};
+    uint32_t                               width       = 0;
+    uint32_t                               height      = 0;
+    int                                    frameNum    = 0;
+    bool                                   isEncode    = false;    //!< first buffer of a frame is the coded buffer, not rendered
+    bool                                   isVp        = false;    //!< buffers reference the surfaces, updated before creation
+    uint32_t                               sliceNum    = 1;        //!< elements in each slice parameter buffer
+    std::vector<std::vector<CompBufConif>> *compBufs   = nullptr;
+    std::vector<VASurfaceID>               *resources  = nullptr;
+    std::vector<VAConfigAttrib>            *confAttrib = nullptr;
+    std::vector<VASurfaceAttrib>           *surfAttrib = nullptr;
+    std::function<void(int)>               updateCompBuffers;
+};
+
+//!
+//! \brief  Parameters of one VP output frame, each layer is a pipeline parameter buffer
+//!
+struct VpPerfData
+{
+    std::vector<VAProcPipelineParameterBuffer> pipelineParams;
+    std::vector<VARectangle>                   srcRegions;
+    std::vector<VARectangle>                   dstRegions;
+    VABlendState                               blendState = {};
+    std::vector<std::vector<CompBufConif>>     compBufs;
+    std::vector<VASurfaceID>                   resources;
+    std::vector<VAConfigAttrib>                confAttrib;
+};
+
+//!
+//! \brief  CPU cost benchmark of decode/encode/VP DDI pipelines on the mocked libdrm and null hardware.
+//! \details Runs on the mocked platforms whose media interfaces create the softlet DecodePipeline,
+//!          EncodePipeline and VpPipeline (MTL), filtered by the platforms given on the command line.
+//!          Fails if the driver is built or selected without such a platform.
+//!          Replays recorded DDI parameter streams for DEVULT_PERF_LOOPS (default 20) loops after
+//!          one warm up loop, and reports ns, allocations and mutex locks per frame for each stage.
+//!          Slice scaling tests take the slice counts from DEVULT_PERF_SLICES (default 1,16,64,256).
+//!          VP scale+CSC goes through the packet reuse plan cache when "Enable PacketReuse Plan Cache"
+//!          is set, composition is never cached.
+//!          Disabled by default, run with
+//!          devult --gtest_also_run_disabled_tests --gtest_filter=MediaPerfDdiTest.*
+//!          CapsConfigsMaterializedOnFirstUse always runs: it checks that vaInitialize builds no caps
+//!          config and reports the vaInitialize time and resident memory.
+//!
+class MediaPerfDdiTest : public testing::Test
+{
+protected:
+
+    virtual void SetUp();
+
+    virtual void TearDown() { }
+
+    void ExecutePerfTest(PerfStream &stream);
+
+    void ExecuteSliceScalingTest(PerfStream &stream, uint32_t slcSize, uint32_t sliceNum,
+        const std::function<void(uint8_t *, uint32_t)> &setSlice);
+
+    void PerfExecute(PerfStream &stream, Platform_t platform);
+
+    void BeginStage();
+
+    void EndStage(PerfStage stage);
+
+    void Report(const PerfStream &stream, Platform_t platform, uint32_t frameNum) const;
+
+protected:
+
+    DriverDllLoader     m_driverLoader;
+    DecTestDataFactory  m_decDataFactory;
+    EncTestDataFactory  m_encTestFactory;
+    PerfStageStats      m_stats[PERF_STAGE_COUNT];
+    bool                m_measure = false;  //!< false during warm up loop
+
+    std::vector<Platform_t>               m_platforms;  //!< mocked platforms running the softlet pipelines
+    std::chrono::steady_clock::time_point m_stageStart;
+    int32_t                               m_stageAllocStart = 0;
+    int32_t                               m_stageLockStart  = 0;
+};
+
+#endif // __DDI_TEST_PERF_H__
@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <algorithm>
 #include "driver_loader.h"
 #include "mos_util_debug.h"
 #include "memory_leak_detector.h"
@@ -52,6 +53,8 @@ const char *g_platformName[] = {
     "SKL",
     "BXT",
     "BDW",
+    "CNL",
+    "MTL",
 };
 
 DriverDllLoader::DriverDllLoader()
@@ -79,7 +82,17 @@ DriverDllLoader::DriverDllLoader()
 
     if (g_platform.size() > 0)
     {
-        m_platformArray = g_platform;
+        // Caps, decode and encode tests only have reference data for the platforms above.
+        // CNL and MTL can be selected for the perf tests, which pick their own platforms.
+        vector<Platform_t> selected;
+        for (auto platform : g_platform)
+        {
+            if (find(m_platformArray.begin(), m_platformArray.end(), platform) != m_platformArray.end())
+            {
+                selected.push_back(platform);
+            }
+        }
+        m_platformArray = selected;
     }
 }
 
@@ -162,6 +175,9 @@ VAStatus DriverDllLoader::LoadDriverSymbols()
             m_drvSyms.MOS_GetMemNinjaCounter    = (MOS_GetMemNinjaCounterFunc)dlsym(m_umdhandle, "MOS_GetMemNinjaCounter");
             m_drvSyms.MOS_GetMemNinjaCounterGfx = (MOS_GetMemNinjaCounterFunc)dlsym(m_umdhandle, "MOS_GetMemNinjaCounterGfx");
             m_drvSyms.ppfnUltGetCmdBuf          = (UltGetCmdBufFunc *)dlsym(m_umdhandle, "pfnUltGetCmdBuf");
+            m_drvSyms.MOS_SetPerfCounterFlag      = (MOS_SetPerfCounterFlagFunc)dlsym(m_umdhandle, "MOS_SetPerfCounterFlag");
+            m_drvSyms.MOS_GetMemAllocTotalCounter = (MOS_GetPerfCounterFunc)dlsym(m_umdhandle, "MOS_GetMemAllocTotalCounter");
+            m_drvSyms.MOS_GetMutexLockCounter     = (MOS_GetPerfCounterFunc)dlsym(m_umdhandle, "MOS_GetMutexLockCounter");
             break;
         }
     }
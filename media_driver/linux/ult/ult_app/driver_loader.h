@@ -78,6 +78,10 @@ typedef void (*MOS_SetUltFlagFunc)(uint8_t ultFlag);
 
 typedef int32_t (*MOS_GetMemNinjaCounterFunc)();
 
+typedef void (*MOS_SetPerfCounterFlagFunc)(uint8_t enable);
+
+typedef int32_t (*MOS_GetPerfCounterFunc)();
+
 typedef void (*UltGetCmdBufFunc)(PMOS_COMMAND_BUFFER pCmdBuffer);
 
 struct DriverSymbols
@@ -103,6 +107,11 @@ struct DriverSymbols
     MOS_GetMemNinjaCounterFunc  MOS_GetMemNinjaCounter;
     MOS_GetMemNinjaCounterFunc  MOS_GetMemNinjaCounterGfx;
 
+    // Optional, only used by benchmark
+    MOS_SetPerfCounterFlagFunc  MOS_SetPerfCounterFlag;
+    MOS_GetPerfCounterFunc      MOS_GetMemAllocTotalCounter;
+    MOS_GetPerfCounterFunc      MOS_GetMutexLockCounter;
+
     // Data
     UltGetCmdBufFunc            *ppfnUltGetCmdBuf;
 };
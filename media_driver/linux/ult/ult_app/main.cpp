@@ -59,7 +59,7 @@ static bool ParseCmd(int argc, char *argv[])
             printf("ERROR\n    Bad command line parameter!\n\n");
             printf("USAGE\n    devult [driver_path] [platform_name...]\n\n");
             printf("DESCRIPTION\n    [driver_path]     : Use default driver relative path if not specify driver_path.\n"
-                "    [platform_name...]: Select zero or more items from {SKL, BXT, BDW}.\n\n");
+                "    [platform_name...]: Select zero or more items from {SKL, BXT, BDW, CNL, MTL}.\n\n");
             printf("EXAMPLE\n    devult\n"
                 "    devult ./build/media_driver/iHD_drv_video.so\n"
                 "    devult skl\n"
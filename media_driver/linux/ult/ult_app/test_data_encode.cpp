@@ -177,7 +177,17 @@ void EncTestDataHEVC::InitCompBuffers()
     m_frameArray.resize(ENC_FRAME_NUM);
     m_pBufs = make_shared<HevcEncBufs>();
 
-    for (auto i = 0; i < ENC_FRAME_NUM; i++)
+    if (m_featureId.entrypoint == VAEntrypointEncSliceLP)
+    {
+        // VDEnc codes 64x64 CTBs only and has no backward reference, so the B frame is dropped.
+        m_pBufs->GetSpsBuf()->log2_diff_max_min_luma_coding_block_size = 0x3;
+        m_pBufs->GetPpsBuf()->column_width_minus1[0]                   = 0x4;
+        m_pBufs->GetPpsBuf()->row_height_minus1[0]                     = 0x3;
+        m_pBufs->GetSlcBuf()->num_ctu_in_slice                         = 0x14;
+        m_frameArray.resize(ENC_FRAME_NUM - 1);
+    }
+
+    for (size_t i = 0; i < m_frameArray.size(); i++)
     {
         m_frameArray[i].spsData.assign((char*)m_pBufs->GetSpsBuf()  , (char*)m_pBufs->GetSpsBuf() + m_pBufs->GetSpsSize());
         m_frameArray[i].ppsData.assign((char*)m_pBufs->GetPpsBuf()  , (char*)m_pBufs->GetPpsBuf() + m_pBufs->GetPpsSize());
@@ -295,7 +305,13 @@ void EncTestDataAVC::InitCompBuffers()
     m_frameArray.resize(3);
     m_pBufs = make_shared<AvcEncBufs>();
 
-    for (auto i = 0; i < ENC_FRAME_NUM; i++)
+    if (m_featureId.entrypoint == VAEntrypointEncSliceLP)
+    {
+        // VDEnc has no backward reference, so the B frame is dropped.
+        m_frameArray.resize(ENC_FRAME_NUM - 1);
+    }
+
+    for (size_t i = 0; i < m_frameArray.size(); i++)
     {
         m_frameArray[i].spsData.assign((char*)m_pBufs->GetSpsBuf()  , (char*)m_pBufs->GetSpsBuf() + m_pBufs->GetSpsSize());
         m_frameArray[i].ppsData.assign((char*)m_pBufs->GetPpsBuf()  , (char*)m_pBufs->GetPpsBuf() + m_pBufs->GetPpsSize());
@@ -32,6 +32,8 @@
 
 const FeatureID TEST_Intel_Encode_HEVC  = { VAProfileHEVCMain    , VAEntrypointEncSlice  , };
 const FeatureID TEST_Intel_Encode_AVC   = { VAProfileH264Main    , VAEntrypointEncSlice  , };
+const FeatureID TEST_Intel_Encode_HEVC_LP = { VAProfileHEVCMain  , VAEntrypointEncSliceLP, };
+const FeatureID TEST_Intel_Encode_AVC_LP  = { VAProfileH264Main  , VAEntrypointEncSliceLP, };
 const FeatureID TEST_Intel_Encode_MPEG2 = { VAProfileMPEG2Main   , VAEntrypointEncSlice  , };
 const FeatureID TEST_Intel_Encode_JPEG  = { VAProfileJPEGBaseline, VAEntrypointEncPicture, };
 
@@ -201,6 +203,14 @@ public:
         {
             return new EncTestDataAVC(TEST_Intel_Encode_AVC);
         }
+        if (description == "HEVC-VDEnc")
+        {
+            return new EncTestDataHEVC(TEST_Intel_Encode_HEVC_LP);
+        }
+        if (description == "AVC-VDEnc")
+        {
+            return new EncTestDataAVC(TEST_Intel_Encode_AVC_LP);
+        }
 
         return nullptr;
     }
@@ -687,3 +687,13 @@ if(MEDIA_RUN_TEST_SUITE AND ENABLE_KERNELS AND ENABLE_NONFREE_KERNELS AND "${CMA
     add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/linux/ult)
     include(${MEDIA_EXT}/media_softlet/ult/ult_top_cmake.cmake OPTIONAL)
 endif()
+
+option(MEDIA_BUILD_MHW_BENCH "Build MHW command encoding microbenchmark" OFF)
+if(MEDIA_BUILD_MHW_BENCH)
+    add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/linux/ult/mhw_bench)
+endif()
+
+option(MEDIA_BUILD_HAL_ULT "Build HAL unit tests linked against the static driver library" OFF)
+if(MEDIA_BUILD_HAL_ULT)
+    add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/linux/ult/hal_ult)
+endif()
@@ -231,6 +231,7 @@ MOS_STATUS Av1VdencPipelineXe_Lpm_Plus_Base::ResetParams()
 
     feature->m_frameNum++;
 
+    ENCODE_CHK_STATUS_RETURN(ReportStagedUploads());
     ENCODE_CHK_STATUS_RETURN(m_statusReport->Reset());
 
     return MOS_STATUS_SUCCESS;
@@ -259,6 +259,7 @@ MOS_STATUS HevcVdencPipelineXe_Lpm_Plus_Base::ActivateVdencVideoPackets()
                 // Flush the last frames
                 while (!laAnalysisFeature->IsLaRecordsEmpty())
                 {
+                    ENCODE_CHK_STATUS_RETURN(laAnalysisFeature->FlushLaRecord());
                     ENCODE_CHK_STATUS_RETURN(ActivatePacket(HucLaUpdate, immediateSubmit, curPass, 0));
                 }
             }
@@ -398,6 +399,7 @@ MOS_STATUS HevcVdencPipelineXe_Lpm_Plus_Base::ResetParams()
         prefeature->m_frameNum++;
     }
 
+    ENCODE_CHK_STATUS_RETURN(ReportStagedUploads());
     ENCODE_CHK_STATUS_RETURN(m_statusReport->Reset());
 
     return MOS_STATUS_SUCCESS;
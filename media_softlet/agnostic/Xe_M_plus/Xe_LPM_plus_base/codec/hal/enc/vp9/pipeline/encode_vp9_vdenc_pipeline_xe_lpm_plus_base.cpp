@@ -319,6 +319,7 @@ MOS_STATUS Vp9VdencPipelineXe_Lpm_Plus_Base::ResetParams()
     // store m_currRecycledBufIdx in basic feature class for other features classes access it
     basicFeature->m_currRecycledBufIdx = m_currRecycledBufIdx;
 
+    ENCODE_CHK_STATUS_RETURN(ReportStagedUploads());
     ENCODE_CHK_STATUS_RETURN(m_statusReport->Reset());
 
     return MOS_STATUS_SUCCESS;
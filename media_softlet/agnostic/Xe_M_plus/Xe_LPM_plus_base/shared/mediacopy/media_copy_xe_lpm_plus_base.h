@@ -90,6 +90,20 @@ protected:
     //!
     virtual MOS_STATUS MediaBltCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst);
 
+    //!
+    //! \brief    use blt engie to do surface copy list.
+    //! \details  implementation media blt copy list, copies are submitted in one command buffer.
+    //! \param    src
+    //!           [in] Array of source surfaces
+    //! \param    dst
+    //!           [in] Array of destination surfaces
+    //! \param    copyNum
+    //!           [in] Number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS MediaBltCopyList(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t copyNum);
+
     //!
     //! \brief    use Render engie to do surface copy.
     //! \details  implementation media Render copy.
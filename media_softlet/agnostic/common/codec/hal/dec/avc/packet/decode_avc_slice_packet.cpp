@@ -61,6 +61,22 @@ MOS_STATUS AvcDecodeSlcPkt::Prepare()
     m_avcSliceParams  = m_avcBasicFeature->m_avcSliceParams;
     m_firstValidSlice = true;
 
+    m_mbaffMultiplier = 1;
+    if (m_avcPicParams->seq_fields.mb_adaptive_frame_field_flag &&
+        !m_avcPicParams->pic_fields.field_pic_flag)
+    {
+        m_mbaffMultiplier++;
+    }
+    m_frameFieldHeightInMb = 0;
+    CodecHal_GetFrameFieldHeightInMb(
+        m_avcPicParams->CurrPic,
+        m_avcPicParams->pic_height_in_mbs_minus1 + 1,
+        m_frameFieldHeightInMb);
+    m_widthInMb = m_avcPicParams->pic_width_in_mbs_minus1 + 1;
+
+    // Reference frame mapping may change between frames
+    m_lastNumRef[0] = m_lastNumRef[1] = 0;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -141,17 +157,8 @@ MOS_STATUS AvcDecodeSlcPkt::SetAndAddAvcSliceState(MOS_COMMAND_BUFFER &cmdBuffer
     //No need to clear par here due to par set in AddCmd_AVC_PHANTOM_SLICE and SET_AVC_SLICE_STATE and continue set and add to cmdbuffer here.
     //par has already cleared in AddCmd_AVC_PHANTOM_SLICE and SET_AVC_SLICE_STATE.
     auto     picParams       = m_avcPicParams;
-    uint32_t mbaffMultiplier = 1;
-    if (picParams->seq_fields.mb_adaptive_frame_field_flag &&
-        !picParams->pic_fields.field_pic_flag)
-    {
-        mbaffMultiplier++;
-    }
-    uint32_t frameFieldHeightInMb = 0;
-    CodecHal_GetFrameFieldHeightInMb(
-        picParams->CurrPic,
-        picParams->pic_height_in_mbs_minus1 + 1,
-        frameFieldHeightInMb);
+    uint32_t mbaffMultiplier = m_mbaffMultiplier;
+    uint32_t widthInMb       = m_widthInMb;
     auto sliceParams = m_avcSliceParams + slcIdx;
     par.sliceType     = m_avcBasicFeature->AvcBsdSliceType[sliceParams->slice_type];
     par.sliceQuantizationParameter = 26 + picParams->pic_init_qp_minus26 + sliceParams->slice_qp_delta;
@@ -159,14 +166,13 @@ MOS_STATUS AvcDecodeSlcPkt::SetAndAddAvcSliceState(MOS_COMMAND_BUFFER &cmdBuffer
     par.roundintra = 5;
     par.roundinter = 2;
 
-    uint32_t widthInMb = picParams->pic_width_in_mbs_minus1 + 1;
     par.sliceStartMbNum         = sliceParams->first_mb_in_slice * mbaffMultiplier;
     par.sliceVerticalPosition   = (sliceParams->first_mb_in_slice / widthInMb) * mbaffMultiplier;
     par.sliceHorizontalPosition = sliceParams->first_mb_in_slice % widthInMb;
 
     if (par.isLastSlice)
     {
-        par.nextSliceVerticalPosition   = frameFieldHeightInMb;
+        par.nextSliceVerticalPosition   = m_frameFieldHeightInMb;
         par.nextSliceHorizontalPosition = 0;
     }
     else
@@ -329,11 +335,6 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_REF_IDX_STATE, AvcDecodeSlcPkt)
     {
         params.numRefForList[params.uiList] = slc->num_ref_idx_l1_active_minus1 + 1;
     }
-    MOS_SecureMemcpy(
-        &params.refPicList,
-        sizeof(params.refPicList),
-        &slc->RefPicList,
-        sizeof(slc->RefPicList));
     params.pAvcPicIdx            = &m_avcBasicFeature->m_refFrames.m_avcPicIdx[0];
     params.avcRefList            = (void **)m_avcBasicFeature->m_refFrames.m_refList;
     params.intelEntrypointInUse = m_avcPipeline->m_intelEntrypointInUse;
@@ -341,15 +342,26 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_REF_IDX_STATE, AvcDecodeSlcPkt)
      // Need to add an empty MFX_AVC_REF_IDX_STATE_CMD for dummy reference on I-Frame
     if (!params.dummyReference)
     {
+        uint32_t             list       = params.uiList;
+        uint32_t             numRef     = MOS_MIN(params.numRefForList[list], 32);
+        const CODEC_PICTURE *refPicList = slc->RefPicList[list];
+        AvcRefListWrite     *cmdAvcRefListWrite = (AvcRefListWrite *)&(params.referenceListEntry);
+
+        // Slices of one frame mostly share the same reference list, reuse entries packed for previous slice
+        if (!params.oneOnOneMapping && numRef != 0 && numRef == m_lastNumRef[list] &&
+            memcmp(refPicList, m_lastRefPicList[list], numRef * sizeof(CODEC_PICTURE)) == 0)
+        {
+            *cmdAvcRefListWrite = m_lastRefListWrite[list];
+            return MOS_STATUS_SUCCESS;
+        }
 
         CODEC_REF_LIST **avcRefList         = (CODEC_REF_LIST **)params.avcRefList;
-        AvcRefListWrite *cmdAvcRefListWrite = (AvcRefListWrite *)&(params.referenceListEntry);
 
         uint8_t picIDOneOnOneMapping = 0;
 
-        for (uint32_t i = 0; i < params.numRefForList[params.uiList]; i++)
+        for (uint32_t i = 0; i < numRef; i++)
         {
-            uint8_t idx = params.refPicList[params.uiList][i].FrameIdx;
+            uint8_t idx = refPicList[i].FrameIdx;
 
             if (!params.intelEntrypointInUse)
             {
@@ -363,7 +375,7 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_REF_IDX_STATE, AvcDecodeSlcPkt)
                 idx = params.pAvcPicIdx[idx].ucPicIdx;
             }
 
-            uint8_t picID = params.picIdRemappingInUse ? params.refPicList[params.uiList][i].FrameIdx : avcRefList[idx]->ucFrameId;
+            uint8_t picID = params.picIdRemappingInUse ? refPicList[i].FrameIdx : avcRefList[idx]->ucFrameId;
 
             // When one on one ref idx mapping is enabled, program picID count from 0, 2 ...
             if (params.oneOnOneMapping)
@@ -373,15 +385,15 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_REF_IDX_STATE, AvcDecodeSlcPkt)
             }
             cmdAvcRefListWrite->Ref[i].frameStoreID = picID;
             cmdAvcRefListWrite->Ref[i].bottomField =
-                CodecHal_PictureIsBottomField(params.refPicList[params.uiList][i]);
+                CodecHal_PictureIsBottomField(refPicList[i]);
             cmdAvcRefListWrite->Ref[i].fieldPicFlag =
-                CodecHal_PictureIsField(params.refPicList[params.uiList][i]);
+                CodecHal_PictureIsField(refPicList[i]);
             cmdAvcRefListWrite->Ref[i].longTermFlag =
                 CodecHal_PictureIsLongTermRef(avcRefList[idx]->RefPic);
             cmdAvcRefListWrite->Ref[i].nonExisting = 0;
         }
 
-        for (auto i = params.numRefForList[params.uiList]; i < 32; i++)
+        for (auto i = numRef; i < 32; i++)
         {
             cmdAvcRefListWrite->Ref[i].value = 0x80;
         }
@@ -395,14 +407,39 @@ MOS_STATUS AvcDecodeSlcPkt::AddCmd_AVC_SLICE_REF_IDX(MOS_COMMAND_BUFFER &cmdBuff
     PCODEC_AVC_SLICE_PARAMS slc = m_avcSliceParams + slcIdx;
     m_listID = 0;
     SETPAR_AND_ADDCMD(MFX_AVC_REF_IDX_STATE, m_mfxItf, &cmdBuffer);
+    DECODE_CHK_STATUS(UpdateLastRefList(m_avcSliceParams + m_curSliceNum));
     if (m_avcBasicFeature->IsAvcBSlice(slc->slice_type))
     {
         m_listID = 1;
         SETPAR_AND_ADDCMD(MFX_AVC_REF_IDX_STATE, m_mfxItf, &cmdBuffer);
+        DECODE_CHK_STATUS(UpdateLastRefList(m_avcSliceParams + m_curSliceNum));
     }
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS AvcDecodeSlcPkt::UpdateLastRefList(PCODEC_AVC_SLICE_PARAMS slc)
+{
+    DECODE_FUNC_CALL();
+
+    auto &params = m_mfxItf->MHW_GETPAR_F(MFX_AVC_REF_IDX_STATE)();
+    if (params.dummyReference || params.oneOnOneMapping)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint32_t list   = params.uiList;
+    uint32_t numRef = MOS_MIN(params.numRefForList[list], 32);
+    DECODE_CHK_STATUS(MOS_SecureMemcpy(
+        m_lastRefPicList[list],
+        sizeof(m_lastRefPicList[list]),
+        slc->RefPicList[list],
+        numRef * sizeof(CODEC_PICTURE)));
+    m_lastRefListWrite[list] = *(AvcRefListWrite *)&(params.referenceListEntry);
+    m_lastNumRef[list]       = numRef;
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS AvcDecodeSlcPkt::AddCmd_AVC_SLICE_Addr(MOS_COMMAND_BUFFER &cmdBuffer, uint32_t slcIdx)
 {
     DECODE_FUNC_CALL();
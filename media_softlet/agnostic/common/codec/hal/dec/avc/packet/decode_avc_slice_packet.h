@@ -117,6 +117,15 @@ protected:
     MOS_STATUS AddCmd_AVC_BSD_OBJECT(MOS_COMMAND_BUFFER &cmdBuffer, uint32_t slcIdx);
     MOS_STATUS AddCmd_AVC_SLICE_Addr(MOS_COMMAND_BUFFER &cmdBuffer, uint32_t slcIdx);
     MOS_STATUS SetAndAddAvcSliceState(MOS_COMMAND_BUFFER &cmdBuffer, uint32_t slcIdx);
+
+    //!
+    //! \brief  Save reference list of the slice just programmed for reuse by next slice
+    //! \param  [in] slc
+    //!         Slice parameters of the slice just programmed
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS UpdateLastRefList(PCODEC_AVC_SLICE_PARAMS slc);
     MHW_SETPAR_DECL_HDR(MFD_AVC_BSD_OBJECT);
     MHW_SETPAR_DECL_HDR(MFX_AVC_WEIGHTOFFSET_STATE);
     MHW_SETPAR_DECL_HDR(MFX_AVC_REF_IDX_STATE);
@@ -151,6 +160,16 @@ protected:
     bool                    m_decodeInUse                               = false;
     PCODEC_AVC_SLICE_PARAMS m_pAvcSliceParams                           = nullptr;
 
+    // Frame level values shared by all slices, prepared once per frame
+    uint32_t m_widthInMb            = 0;  //!< Frame width in macroblocks
+    uint32_t m_mbaffMultiplier      = 1;  //!< 2 for MBAFF frame, else 1
+    uint32_t m_frameFieldHeightInMb = 0;  //!< Frame or field height in macroblocks
+
+    // Reference list entries of previous slice, reused when next slice sends identical list
+    CODEC_PICTURE   m_lastRefPicList[2][32] = {};     //!< Reference list of previous slice
+    uint32_t        m_lastNumRef[2]         = {};     //!< Number of references of previous slice, 0 if invalid
+    AvcRefListWrite m_lastRefListWrite[2]   = {};     //!< Packed reference list entries of previous slice
+
 MEDIA_CLASS_DEFINE_END(decode__AvcDecodeSlcPkt)
 };
 
@@ -67,6 +67,122 @@ namespace decode
         m_hevcRextSliceParams = m_hevcBasicFeature->m_hevcRextSliceParams;
         m_hevcSccPicParams    = m_hevcBasicFeature->m_hevcSccPicParams;
 
+        DECODE_CHK_STATUS(PrepareSliceBatch());
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS HevcDecodeSlcPkt::PrepareSliceBatch()
+    {
+        DECODE_FUNC_CALL();
+
+        if (m_hevcBasicFeature->m_shortFormatInUse)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        uint32_t ctbSize    = 1 << (m_hevcPicParams->log2_diff_max_min_luma_coding_block_size + m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3);
+        uint32_t widthInPix = (1 << (m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3)) * (m_hevcPicParams->PicWidthInMinCbsY);
+        m_widthInCtb        = MOS_ROUNDUP_DIVIDE(widthInPix, ctbSize);
+        DECODE_CHK_COND(m_widthInCtb == 0, "Invalid frame width!");
+
+        // Frame level values, indexed by frame index of reference
+        HevcReferenceFrames &refFrames      = m_hevcBasicFeature->m_refFrames;
+        CODEC_REF_LIST     **refList        = (CODEC_REF_LIST **)refFrames.m_refList;
+        CODEC_PICTURE        currPic        = m_hevcPicParams->CurrPic;
+        int32_t              pocCurrPic     = m_hevcPicParams->CurrPicOrderCntVal;
+        uint32_t             followCurrMask = 0;
+        bool                 currRefValid   = (currPic.FrameIdx < CODECHAL_NUM_UNCOMPRESSED_SURFACE_HEVC) && (refList[currPic.FrameIdx] != nullptr);
+
+        for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+        {
+            int32_t poc = m_hevcPicParams->PicOrderCntValList[i];
+            if (poc > pocCurrPic)
+            {
+                followCurrMask |= (1 << i);
+            }
+            m_refTbValue[i]  = (int8_t)CodecHal_Clip3(-128, 127, pocCurrPic - poc);
+            m_refLongTerm[i] = currRefValid ? CodecHal_PictureIsLongTermRef(refList[currPic.FrameIdx]->RefList[i]) : false;
+        }
+
+        uint32_t numSlices = m_hevcBasicFeature->m_numSlices;
+        if (m_sliceBatch.ctbX.size() < numSlices)
+        {
+            m_sliceBatch.ctbX.resize(numSlices);
+            m_sliceBatch.ctbY.resize(numSlices);
+            m_sliceBatch.isLowDelay.resize(numSlices);
+            m_sliceBatch.collocatedRefIdx.resize(numSlices);
+            m_sliceBatch.collocatedFromL0.resize(numSlices);
+        }
+
+        // The first inter slice collocated reference is reused by following intra slices,
+        // it is a HW requirement as collocated reference fetching may not be complete yet
+        int8_t  firstInterCollocatedRefIdx = 0;
+        uint8_t firstInterCollocatedFromL0 = 0;
+        bool    firstInterSliceFound       = false;
+
+        for (uint32_t sliceIdx = 0; sliceIdx < numSlices; sliceIdx++)
+        {
+            CODEC_HEVC_SLICE_PARAMS &slc   = m_hevcSliceParams[sliceIdx];
+            uint32_t                 type  = slc.LongSliceFlags.fields.slice_type;
+            bool                     tmvp  = slc.LongSliceFlags.fields.slice_temporal_mvp_enabled_flag;
+            uint8_t                  fromL0 = slc.LongSliceFlags.fields.collocated_from_l0_flag;
+
+            m_sliceBatch.ctbX[sliceIdx] = (uint16_t)(slc.slice_segment_address % m_widthInCtb);
+            m_sliceBatch.ctbY[sliceIdx] = (uint16_t)(slc.slice_segment_address / m_widthInCtb);
+
+            uint8_t isLowDelay = (type == SLICE_TYPE_I_SLICE) ? 0 : 1;
+            for (uint32_t list = 0; isLowDelay && list < ((type == SLICE_TYPE_B_SLICE) ? 2u : 1u); list++)
+            {
+                uint32_t numRef = (list == 0) ? slc.num_ref_idx_l0_active_minus1 + 1 : slc.num_ref_idx_l1_active_minus1 + 1;
+                for (uint32_t i = 0; i < numRef; i++)
+                {
+                    uint8_t refFrameID = slc.RefPicList[list][i].FrameIdx;
+                    if (refFrameID < CODEC_MAX_NUM_REF_FRAME_HEVC && (followCurrMask & (1 << refFrameID)))
+                    {
+                        isLowDelay = 0;
+                        break;
+                    }
+                }
+            }
+            m_sliceBatch.isLowDelay[sliceIdx] = isLowDelay;
+
+            int8_t collocatedRefIdx = 0;
+            if (tmvp && type != SLICE_TYPE_I_SLICE)
+            {
+                uint8_t collocatedFrameIdx = 0;
+                if (type == SLICE_TYPE_P_SLICE)
+                {
+                    collocatedFrameIdx = slc.RefPicList[0][slc.collocated_ref_idx].FrameIdx;
+                }
+                else if (type == SLICE_TYPE_B_SLICE)
+                {
+                    collocatedFrameIdx = slc.RefPicList[!fromL0][slc.collocated_ref_idx].FrameIdx;
+                }
+                collocatedRefIdx = (collocatedFrameIdx < CODEC_MAX_NUM_REF_FRAME_HEVC) ? refFrames.m_refIdxMapping[collocatedFrameIdx] : -1;
+            }
+
+            if (!firstInterSliceFound && type != SLICE_TYPE_I_SLICE && tmvp)
+            {
+                firstInterCollocatedRefIdx = collocatedRefIdx;
+                firstInterCollocatedFromL0 = fromL0;
+                firstInterSliceFound       = true;
+            }
+            if (firstInterSliceFound && (type == SLICE_TYPE_I_SLICE || !tmvp))
+            {
+                collocatedRefIdx = firstInterCollocatedRefIdx;
+                fromL0           = firstInterCollocatedFromL0;
+            }
+            m_sliceBatch.collocatedRefIdx[sliceIdx] = collocatedRefIdx;
+            m_sliceBatch.collocatedFromL0[sliceIdx] = fromL0;
+
+            // Slice state above is derived from the reference lists as sent by application
+            if (!m_hcpItf->IsHevcISlice(type))
+            {
+                DECODE_CHK_STATUS(refFrames.FixSliceRefList(*m_hevcPicParams, slc));
+            }
+        }
+
         return MOS_STATUS_SUCCESS;
     }
 
@@ -152,18 +268,15 @@ namespace decode
 
         DECODE_CHK_NULL(m_hevcPicParams);
 
+        DECODE_CHK_COND(sliceIdx >= m_sliceBatch.ctbX.size(), "slice index exceeds prepared slices!");
+
         uint32_t dwSliceIndex   = sliceIdx;
         bool     bLastSlice     = m_hevcBasicFeature->IsLastSlice(sliceIdx);
-        int8_t * pRefIdxMapping = m_hevcBasicFeature->m_refFrames.m_refIdxMapping;
 
         auto &params                 = m_hcpItf->MHW_GETPAR_F(HCP_SLICE_STATE)();
         params.lastSliceInTile       = sliceTileInfo->lastSliceOfTile;
         params.lastSliceInTileColumn = sliceTileInfo->lastSliceOfTile && (sliceTileInfo->sliceTileY == m_hevcPicParams->num_tile_rows_minus1);
 
-        uint32_t ctbSize    = 1 << (m_hevcPicParams->log2_diff_max_min_luma_coding_block_size + m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3);
-        uint32_t widthInPix = (1 << (m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3)) * (m_hevcPicParams->PicWidthInMinCbsY);
-        uint32_t widthInCtb = MOS_ROUNDUP_DIVIDE(widthInPix, ctbSize);
-
         // It is a hardware requirement that the first HCP_SLICE_STATE of the workload starts at LCU X,Y = 0,0.
         // If first slice doesn't starts from (0,0), that means this is error bitstream.
         if (dwSliceIndex == 0)
@@ -173,8 +286,8 @@ namespace decode
         }
         else
         {
-            params.slicestartctbxOrSliceStartLcuXEncoder = sliceParams->slice_segment_address % widthInCtb;
-            params.slicestartctbyOrSliceStartLcuYEncoder = sliceParams->slice_segment_address / widthInCtb;
+            params.slicestartctbxOrSliceStartLcuXEncoder = m_sliceBatch.ctbX[sliceIdx];
+            params.slicestartctbyOrSliceStartLcuYEncoder = m_sliceBatch.ctbY[sliceIdx];
         }
 
         if (bLastSlice)
@@ -184,8 +297,8 @@ namespace decode
         }
         else
         {
-            params.nextslicestartctbxOrNextSliceStartLcuXEncoder = (sliceParams + 1)->slice_segment_address % widthInCtb;
-            params.nextslicestartctbyOrNextSliceStartLcuYEncoder = (sliceParams + 1)->slice_segment_address / widthInCtb;
+            params.nextslicestartctbxOrNextSliceStartLcuXEncoder = m_sliceBatch.ctbX[sliceIdx + 1];
+            params.nextslicestartctbyOrNextSliceStartLcuYEncoder = m_sliceBatch.ctbY[sliceIdx + 1];
         }
 
         params.sliceType                  = sliceParams->LongSliceFlags.fields.slice_type;
@@ -203,106 +316,15 @@ namespace decode
         params.saoLumaFlag                   = sliceParams->LongSliceFlags.fields.slice_sao_luma_flag;
         params.mvdL1ZeroFlag                 = sliceParams->LongSliceFlags.fields.mvd_l1_zero_flag;
 
-        uint8_t isLowDelay = 1;
-
-        if (sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_I_SLICE)
-        {
-            isLowDelay = 0;
-        }
-        else
-        {
-            for (uint8_t i = 0; i < sliceParams->num_ref_idx_l0_active_minus1 + 1; i++)
-            {
-                uint8_t refFrameID = sliceParams->RefPicList[0][i].FrameIdx;
-                if (m_hevcPicParams->PicOrderCntValList[refFrameID] > m_hevcPicParams->CurrPicOrderCntVal)
-                {
-                    isLowDelay = 0;
-                    break;
-                }
-            }
-
-            if (sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_B_SLICE)
-            {
-                for (uint8_t i = 0; i < sliceParams->num_ref_idx_l1_active_minus1 + 1; i++)
-                {
-                    uint8_t refFrameID = sliceParams->RefPicList[1][i].FrameIdx;
-                    if (m_hevcPicParams->PicOrderCntValList[refFrameID] > m_hevcPicParams->CurrPicOrderCntVal)
-                    {
-                        isLowDelay = 0;
-                        break;
-                    }
-                }
-            }
-        }
-
-        params.isLowDelay            = isLowDelay & 0x1;
-        params.collocatedFromL0Flag  = sliceParams->LongSliceFlags.fields.collocated_from_l0_flag;
+        params.isLowDelay            = m_sliceBatch.isLowDelay[sliceIdx] & 0x1;
         params.chromalog2Weightdenom = sliceParams->luma_log2_weight_denom + sliceParams->delta_chroma_log2_weight_denom;
         params.lumaLog2WeightDenom   = sliceParams->luma_log2_weight_denom;
         params.cabacInitFlag         = sliceParams->LongSliceFlags.fields.cabac_init_flag;
         params.maxmergeidx           = 5 - sliceParams->five_minus_max_num_merge_cand - 1;
 
-        uint8_t collocatedRefIndex = 0, collocatedFrameIdx = 0, collocatedFromL0Flag = 0;
-
-        if (sliceParams->LongSliceFlags.fields.slice_temporal_mvp_enabled_flag == 1)
-        {
-            // Get Collocated Picture POC
-            collocatedRefIndex   = sliceParams->collocated_ref_idx;
-            collocatedFrameIdx   = 0;
-            collocatedFromL0Flag = sliceParams->LongSliceFlags.fields.collocated_from_l0_flag;
-            if (sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_P_SLICE)
-            {
-                collocatedFrameIdx = sliceParams->RefPicList[0][collocatedRefIndex].FrameIdx;
-            }
-            else if (sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_B_SLICE)
-            {
-                collocatedFrameIdx = sliceParams->RefPicList[!collocatedFromL0Flag][collocatedRefIndex].FrameIdx;
-            }
-
-            if (sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_I_SLICE)
-            {
-                params.collocatedrefidx = 0;
-            }
-            else
-            {
-                MHW_CHK_COND(*(pRefIdxMapping + collocatedFrameIdx) < 0, "Invalid parameter");
-                params.collocatedrefidx = *(pRefIdxMapping + collocatedFrameIdx);
-            }
-        }
-        else
-        {
-            params.collocatedrefidx = 0;
-        }
-
-        static uint8_t ucFirstInterSliceCollocatedFrameIdx   = 0;
-        static uint8_t ucFirstInterSliceCollocatedFromL0Flag = 0;
-        static bool    bFinishFirstInterSlice                = false;
-
-        // Need to save the first interSlice collocatedRefIdx value to use on subsequent intra slices
-        // this is a HW requrement as collcoated ref fetching from memory may not be complete yet
-        if (dwSliceIndex == 0)
-        {
-            ucFirstInterSliceCollocatedFrameIdx   = 0;
-            ucFirstInterSliceCollocatedFromL0Flag = 0;
-            bFinishFirstInterSlice                = false;
-        }
-
-        if ((!bFinishFirstInterSlice) &&
-            (sliceParams->LongSliceFlags.fields.slice_type != SLICE_TYPE_I_SLICE) &&
-            (sliceParams->LongSliceFlags.fields.slice_temporal_mvp_enabled_flag == 1))
-        {
-            ucFirstInterSliceCollocatedFrameIdx   = params.collocatedrefidx;
-            ucFirstInterSliceCollocatedFromL0Flag = params.collocatedFromL0Flag;
-            bFinishFirstInterSlice                = true;
-        }
-
-        if (bFinishFirstInterSlice &&
-            ((sliceParams->LongSliceFlags.fields.slice_type == SLICE_TYPE_I_SLICE) ||
-                (sliceParams->LongSliceFlags.fields.slice_temporal_mvp_enabled_flag == 0)))
-        {
-            params.collocatedrefidx     = ucFirstInterSliceCollocatedFrameIdx;
-            params.collocatedFromL0Flag = ucFirstInterSliceCollocatedFromL0Flag;
-        }
+        MHW_CHK_COND(m_sliceBatch.collocatedRefIdx[sliceIdx] < 0, "Invalid parameter");
+        params.collocatedrefidx     = m_sliceBatch.collocatedRefIdx[sliceIdx];
+        params.collocatedFromL0Flag = m_sliceBatch.collocatedFromL0[sliceIdx];
 
         params.sliceheaderlength = sliceParams->ByteOffsetToSliceData;
 
@@ -321,8 +343,8 @@ namespace decode
         }
         else
         {
-            params.slicestartctbxOrSliceStartLcuXEncoder = sliceParams->slice_segment_address % widthInCtb;
-            params.slicestartctbyOrSliceStartLcuYEncoder = sliceParams->slice_segment_address / widthInCtb;
+            params.slicestartctbxOrSliceStartLcuXEncoder = m_sliceBatch.ctbX[sliceIdx];
+            params.slicestartctbyOrSliceStartLcuYEncoder = m_sliceBatch.ctbY[sliceIdx];
         }
 
         auto hevcExtSliceParams = m_hevcRextSliceParams + sliceIdx;
@@ -342,8 +364,8 @@ namespace decode
 
         if ((dwSliceIndex == 0) || !params.dependentSliceFlag)
         {
-            params.originalSliceStartCtbX = sliceParams->slice_segment_address % widthInCtb;
-            params.originalSliceStartCtbY = sliceParams->slice_segment_address / widthInCtb;
+            params.originalSliceStartCtbX = m_sliceBatch.ctbX[sliceIdx];
+            params.originalSliceStartCtbY = m_sliceBatch.ctbY[sliceIdx];
         }
         else
         {
@@ -374,18 +396,12 @@ namespace decode
         auto &params        = m_hcpItf->MHW_GETPAR_F(HCP_REF_IDX_STATE)();
         params.bDecodeInUse = true;
 
-        CODEC_HEVC_SLICE_PARAMS *sliceParams                           = m_hevcSliceParams + sliceIdx;
-        int8_t                  *pRefIdxMapping                        = 0;
-        int                      pocCurrPic                            = 0;
-        int32_t                  pocList[CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
-        uint16_t                 refFieldPicFlag                       = 0;
-        uint16_t                 refBottomFieldFlag                    = 0;
-        CODEC_PICTURE            refPicList[2][CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+        CODEC_HEVC_SLICE_PARAMS *sliceParams = m_hevcSliceParams + sliceIdx;
 
         if (!m_hcpItf->IsHevcISlice(sliceParams->LongSliceFlags.fields.slice_type))
         {
+            // Slice reference lists are fixed up and frame level values are prepared in PrepareSliceBatch
             HevcReferenceFrames &refFrames = m_hevcBasicFeature->m_refFrames;
-            DECODE_CHK_STATUS(refFrames.FixSliceRefList(*m_hevcPicParams, *sliceParams));
 
             CODEC_PICTURE currPic  = m_hevcPicParams->CurrPic;
             if (params.ucList != 1)
@@ -393,19 +409,10 @@ namespace decode
                 params.ucNumRefForList = sliceParams->num_ref_idx_l0_active_minus1 + 1;
             }
 
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(&refPicList, sizeof(refPicList), &sliceParams->RefPicList, sizeof(sliceParams->RefPicList)));
-
-            void **hevcRefList = (void **)refFrames.m_refList;
-            pocCurrPic         = m_hevcPicParams->CurrPicOrderCntVal;
-
-            for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
-            {
-                pocList[i] = m_hevcPicParams->PicOrderCntValList[i];
-            }
-
-            pRefIdxMapping     = refFrames.m_refIdxMapping;
-            refFieldPicFlag    = m_hevcPicParams->RefFieldPicFlag;
-            refBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
+            const CODEC_PICTURE *refPicList         = sliceParams->RefPicList[params.ucList];
+            int8_t              *pRefIdxMapping     = refFrames.m_refIdxMapping;
+            uint16_t             refFieldPicFlag    = m_hevcPicParams->RefFieldPicFlag;
+            uint16_t             refBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
 
             // Need to add an empty HCP_REF_IDX_STATE_CMD for dummy reference on I-Frame
             // ucNumRefForList could be 0 for encode
@@ -415,16 +422,14 @@ namespace decode
 
             for (uint8_t i = 0; i < params.ucNumRefForList; i++)
             {
-                uint8_t refFrameIDx = refPicList[params.ucList][i].FrameIdx;
+                uint8_t refFrameIDx = refPicList[i].FrameIdx;
                 if (refFrameIDx < CODEC_MAX_NUM_REF_FRAME_HEVC)
                 {
                     MHW_ASSERT(*(pRefIdxMapping + refFrameIDx) >= 0);
 
                     params.listEntryLxReferencePictureFrameIdRefaddr07[i] = *(pRefIdxMapping + refFrameIDx);
-                    int32_t pocDiff                                       = pocCurrPic - pocList[refFrameIDx];
-                    params.referencePictureTbValue[i]                     = CodecHal_Clip3(-128, 127, pocDiff);
-                    CODEC_REF_LIST **refList                              = (CODEC_REF_LIST **)hevcRefList;
-                    params.longtermreference[i]                           = CodecHal_PictureIsLongTermRef(refList[currPic.FrameIdx]->RefList[refFrameIDx]);
+                    params.referencePictureTbValue[i]                     = m_refTbValue[refFrameIDx];
+                    params.longtermreference[i]                           = m_refLongTerm[refFrameIDx];
                     params.fieldPicFlag[i]                                = (refFieldPicFlag >> refFrameIDx) & 0x01;
                     params.bottomFieldFlag[i]                             = ((refBottomFieldFlag >> refFrameIDx) & 0x01) ? 0 : 1;
                 }
@@ -97,6 +97,16 @@ protected:
     //!
     virtual MOS_STATUS CalculateSliceStateCommandSize();
 
+    //!
+    //! \brief  Prepare slice level state of all slices in one pass
+    //! \details Frame invariants are computed once per frame, per slice values of
+    //!          HCP_SLICE_STATE are stored in slice indexed columns and slice
+    //!          reference lists are fixed up, so slice commands only gather values.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS PrepareSliceBatch();
+
     virtual MOS_STATUS AddCmd_HCP_PALETTE_INITIALIZER_STATE(MOS_COMMAND_BUFFER &cmdBuffer, uint32_t sliceIdx);
     virtual MOS_STATUS SET_HCP_SLICE_STATE(uint32_t sliceIdx, uint32_t subTileIdx);
     virtual MOS_STATUS SET_HCP_REF_IDX_STATE(uint32_t sliceIdx);
@@ -117,6 +127,23 @@ protected:
     PCODEC_HEVC_EXT_SLICE_PARAMS m_hevcRextSliceParams = nullptr;  //!< Extended slice params for Rext
     PCODEC_HEVC_SCC_PIC_PARAMS   m_hevcSccPicParams    = nullptr;  //!< Pic params for SCC
 
+    //!
+    //! \brief  Slice level state prepared once per frame, one column per field
+    //!
+    struct SliceBatch
+    {
+        std::vector<uint16_t> ctbX;              //!< Slice segment start CTB column
+        std::vector<uint16_t> ctbY;              //!< Slice segment start CTB row
+        std::vector<uint8_t>  isLowDelay;        //!< No reference follows current picture in output order
+        std::vector<int8_t>   collocatedRefIdx;  //!< Collocated reference index, negative if invalid
+        std::vector<uint8_t>  collocatedFromL0;  //!< Collocated from list 0 flag
+    };
+
+    SliceBatch m_sliceBatch;                                          //!< Per slice state of current frame
+    uint32_t   m_widthInCtb                                     = 0;  //!< Frame width in CTB
+    int8_t     m_refTbValue[CODEC_MAX_NUM_REF_FRAME_HEVC]       = {}; //!< Clipped POC distance per frame index
+    bool       m_refLongTerm[CODEC_MAX_NUM_REF_FRAME_HEVC]      = {}; //!< Long term flag per frame index
+
     uint32_t              m_sliceStatesSize    = 0;  //!< Slice state command size
     uint32_t              m_slicePatchListSize = 0;  //!< Slice patch list size
     static const uint32_t m_HevcSccPaletteSize = 96; //!< For HEVC SCC palette size on Gen12+
@@ -189,8 +189,11 @@ MOS_STATUS HucCopyPkt::CalculateCommandSize(uint32_t &commandBufferSize, uint32_
             m_basicFeature->m_mode, (uint32_t *)&hucCommandsSize, (uint32_t *)&hucPatchListSize, &stateCmdSizeParams));
     }
 
-    commandBufferSize      = hucCommandsSize;
-    requestedPatchListSize = m_osInterface->bUsesPatchList ? hucPatchListSize : 0;
+    // Each copy adds its own HuC pipe and stream object commands.
+    uint32_t copyNum = MOS_MAX(1, (uint32_t)m_copyParamsList.size());
+
+    commandBufferSize      = hucCommandsSize * copyNum;
+    requestedPatchListSize = m_osInterface->bUsesPatchList ? hucPatchListSize * copyNum : 0;
 
     // 4K align since allocation is in chunks of 4K bytes.
     commandBufferSize = MOS_ALIGN_CEIL(commandBufferSize, 0x1000);
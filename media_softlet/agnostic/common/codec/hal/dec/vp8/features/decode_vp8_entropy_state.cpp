@@ -39,6 +39,18 @@ namespace decode
         int32_t        num         = (int32_t)(shift + CHAR_BIT - bitsLeft);
         int32_t        loopEnd     = 0;
 
+        if (num < 0 && bytesLeft >= sizeof(uint32_t) && shift >= 0)
+        {
+            // Refill all needed bytes with one big endian word read, same result as byte loop below.
+            uint32_t bytes = (uint32_t)shift / CHAR_BIT + 1;
+            uint32_t word  = ((uint32_t)m_buffer[0] << 24) | ((uint32_t)m_buffer[1] << 16) |
+                             ((uint32_t)m_buffer[2] << 8) | (uint32_t)m_buffer[3];
+            m_value |= (word >> (m_bdValueSize - bytes * CHAR_BIT)) << (shift % CHAR_BIT);
+            m_count += bytes * CHAR_BIT;
+            m_buffer += bytes;
+            return;
+        }
+
         if (num >= 0)
         {
             m_count += m_lotsOfBits;
@@ -474,10 +486,97 @@ namespace decode
         } while (++i < 2);
     }
 
+    void Vp8EntropyState::CacheFirstPartition(PCODEC_VP8_PIC_PARAMS vp8PicParams)
+    {
+        if (vp8PicParams->uiFirstPartitionSize >= m_bitstreamBufferSize)
+        {
+            return;
+        }
+
+        // Uncompressed data chunk, first partition, partition size table and look ahead bytes of entropy decoder.
+        uint32_t cacheSize = (uint32_t)(m_dataBuffer - m_bitstreamBuffer) + vp8PicParams->uiFirstPartitionSize +
+                             3 * ((1 << VP8_EIGHT_PARTITION) - 1) + sizeof(uint32_t);
+        if (cacheSize >= m_bitstreamBufferSize)
+        {
+            // Whole bitstream is needed, parse it in place.
+            return;
+        }
+
+        m_firstPartitionCache.resize(cacheSize);
+        MOS_SecureMemcpy(m_firstPartitionCache.data(), cacheSize, m_bitstreamBuffer, cacheSize);
+
+        m_dataBuffer      = m_firstPartitionCache.data() + (m_dataBuffer - m_bitstreamBuffer);
+        m_dataBufferEnd   = m_firstPartitionCache.data() + cacheSize;
+        m_bitstreamBuffer = m_firstPartitionCache.data();
+    }
+
+    void Vp8EntropyState::DecodeCoefProbUpdates()
+    {
+        const uint8_t *updateProbs = &CoefUpdateProbs[0][0][0][0];
+        uint8_t       *coefProbs   = &m_frameHead->FrameContext.CoefProbs[0][0][0][0];
+        const uint32_t probNum     = sizeof(CoefUpdateProbs);
+
+        // Keep decoder state in locals, stores to coefProbs would otherwise force reloads of members.
+        uint32_t value = m_value;
+        uint32_t range = m_range;
+        int32_t  count = m_count;
+
+        for (uint32_t i = 0; i < probNum; i++)
+        {
+            uint32_t split    = 1 + (((range - 1) * updateProbs[i]) >> 8);
+            uint32_t bigSplit = split << (m_bdValueSize - 8);
+
+            if (value < bigSplit)
+            {
+                // Update flag is 0 for most of the nodes.
+                int32_t shift = Norm[split];
+                range         = split << shift;
+                value <<= shift;
+                count -= shift;
+
+                if (count < 0)
+                {
+                    m_value = value;
+                    m_count = count;
+                    DecodeFill();
+                    value = m_value;
+                    count = m_count;
+                }
+            }
+            else
+            {
+                range -= split;
+                value -= bigSplit;
+
+                int32_t shift = Norm[range];
+                m_range       = range << shift;
+                m_value       = value << shift;
+                m_count       = count - shift;
+
+                if (m_count < 0)
+                {
+                    DecodeFill();
+                }
+
+                coefProbs[i] = (uint8_t)DecodeValue(8);
+
+                value = m_value;
+                range = m_range;
+                count = m_count;
+            }
+        }
+
+        m_value = value;
+        m_range = range;
+        m_count = count;
+    }
+
     MOS_STATUS Vp8EntropyState::ParseFrameHead(PCODEC_VP8_PIC_PARAMS vp8PicParams)
     {
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
+        CacheFirstPartition(vp8PicParams);
+
         ParseFrameHeadInit();
 
         StartEntropyDecode();
@@ -546,18 +645,7 @@ namespace decode
             m_frameHead->iRefreshLastFrame = false;
         }
 
-        for (int32_t i = 0; i < VP8_BLOCK_TYPES; i++)
-            for (int32_t j = 0; j < VP8_COEF_BANDS; j++)
-                for (int32_t k = 0; k < VP8_PREV_COEF_CONTEXTS; k++)
-                    for (int32_t l = 0; l < VP8_ENTROPY_NODES; l++)
-                    {
-                        uint8_t *const p = m_frameHead->FrameContext.CoefProbs[i][j][k] + l;
-
-                        if (DecodeBool(CoefUpdateProbs[i][j][k][l]))
-                        {
-                            *p = (uint8_t)DecodeValue(8);
-                        }
-                    }
+        DecodeCoefProbUpdates();
 
         m_frameHead->iMbNoCoeffSkip = (int32_t)DecodeBool(m_probHalf);
         m_frameHead->iProbSkipFalse = 0;
@@ -26,6 +26,7 @@
 #ifndef __DECODE_VP8_ENTROPY_STATE_H__
 #define __DECODE_VP8_ENTROPY_STATE_H__
 
+#include <vector>
 #include "codec_def_decode_vp8.h" 
 #include "mhw_vdbox.h"
 #include "decode_allocator.h"
@@ -359,16 +360,40 @@ protected:
     //!
     void ReadMvContexts(MV_CONTEXT *mvContext);
 
+    //!
+    //! \brief    Copy uncompressed data chunk and first partition to CPU cached buffer
+    //! \details  Frame head parsing only touches the first partition and the partition
+    //!           size table, copy them once from bitstream buffer which may be uncached
+    //!           instead of reading it byte by byte during entropy decode.
+    //! \param    [in] vp8PicParams
+    //!           Pointer to VP8 Pic Params
+    //! \return   void
+    //!
+    void CacheFirstPartition(PCODEC_VP8_PIC_PARAMS vp8PicParams);
+
+    //!
+    //! \brief    Update coefficient probabilities in Frame Head
+    //! \details  Parse coefficient probability update flags and values for all
+    //!           block types, coef bands, contexts and entropy nodes. Same DecodeBool
+    //!           sequence as before, with the decoder state kept in locals.
+    //! \return   void
+    //!
+    void DecodeCoefProbUpdates();
+
     PCODECHAL_DECODE_VP8_FRAME_HEAD m_frameHead           = nullptr;  //!< Pointer to VP8 Frame Head
     uint8_t *                       m_bitstreamBuffer     = nullptr;  //!< Pointer to Bitstream Buffer
     uint32_t                        m_bitstreamBufferSize = 0;        //!< Size of Bitstream Buffer
     uint8_t *                       m_dataBuffer          = nullptr;  //!< Pointer to Data Buffer
     uint8_t *                       m_dataBufferEnd       = nullptr;  //<! Pointer to Data Buffer End
+    std::vector<uint8_t>            m_firstPartitionCache;            //!< CPU cached copy of first partition
 
 private:
     //!
     //! \brief    Update Entropy Decode State Info
-    //! \details  Calculate left bitstream size to update pointer info
+    //! \details  Calculate left bitstream size to update pointer info. With at least
+    //!           four bytes left, the bytes the byte loop would read are read as one
+    //!           big endian word instead. It is still a one bool per call decoder,
+    //!           only the refill is done per word.
     //! \return   void
     //!
     void DecodeFill();
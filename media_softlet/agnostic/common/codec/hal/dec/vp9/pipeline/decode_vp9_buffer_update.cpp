@@ -42,7 +42,18 @@ DecodeVp9BufferUpdate::DecodeVp9BufferUpdate(Vp9Pipeline *pipeline, MediaTask *t
 
 DecodeVp9BufferUpdate::~DecodeVp9BufferUpdate()
 {
+    DECODE_NORMALMESSAGE("VP9 prob buffer updates %d, prob buffer busy %d, staging buffer busy %d.",
+        m_probBufUpdateCount, m_probBufBusyCount, m_stagingBusyCount);
+
     m_allocator->Destroy(m_segmentInitBuffer);
+    if (m_probStagingBufferArray)
+    {
+        m_allocator->Destroy(m_probStagingBufferArray);
+    }
+    if (m_probSaveBuffer)
+    {
+        m_allocator->Destroy(m_probSaveBuffer);
+    }
 }
 
 MOS_STATUS DecodeVp9BufferUpdate::Init(CodechalSetting &settings)
@@ -87,6 +98,7 @@ MOS_STATUS DecodeVp9BufferUpdate::Prepare(DecodePipelineParams &params)
     if (m_pipeline->IsFirstProcessPipe(params))
     {
         DECODE_CHK_STATUS(Begin());
+        m_copyPktActivated = false;
 
         if (m_basicFeature->m_resetSegIdBuffer)
         {
@@ -103,6 +115,7 @@ MOS_STATUS DecodeVp9BufferUpdate::Prepare(DecodePipelineParams &params)
             m_sgementbufferResetPkt->PushCopyParams(copyParams);
 
             DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+            m_copyPktActivated = true;
         }
 
         if (m_basicFeature->m_osInterface->osCpInterface->IsHMEnabled())
@@ -111,109 +124,219 @@ MOS_STATUS DecodeVp9BufferUpdate::Prepare(DecodePipelineParams &params)
         }
         else
         {
-            if (m_basicFeature->m_fullProbBufferUpdate)
-            {
-                DECODE_CHK_STATUS(ProbBufFullUpdatewithDrv());
-            }
-            else
-            {
-                DECODE_CHK_STATUS(ProbBufferPartialUpdatewithDrv());
-            }
+            DECODE_CHK_STATUS(ProbBufUpdateWithStaging());
         }
     }
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS DecodeVp9BufferUpdate ::ProbBufFullUpdatewithDrv()
+void DecodeVp9BufferUpdate::GetCtxBufDiffRegions(bool setToKey, ProbBufCopy *copies)
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-
-    DECODE_FUNC_CALL();
-
-    ResourceAutoLock resLock(m_allocator, &(m_basicFeature->m_resVp9ProbBuffer[m_basicFeature->m_frameCtxIdx]->OsResource));
-    auto             data = (uint8_t *)resLock.LockResourceForWrite();
-    DECODE_CHK_NULL(data);
-
-    DECODE_CHK_STATUS(ContextBufferInit(
-        data, (m_basicFeature->m_probUpdateFlags.bResetKeyDefault ? true : false)));
-    DECODE_CHK_STATUS(MOS_SecureMemcpy(
-        (data + CODEC_VP9_SEG_PROB_OFFSET),
-        7,
-        m_basicFeature->m_probUpdateFlags.SegTreeProbs,
-        7));
-    DECODE_CHK_STATUS(MOS_SecureMemcpy(
-        (data + CODEC_VP9_SEG_PROB_OFFSET + 7),
-        3,
-        m_basicFeature->m_probUpdateFlags.SegPredProbs,
-        3));
-
-    return eStatus;
+    // Section layout follows CtxBufDiffInit.
+    const uint32_t partitionOffset =
+        CODEC_VP9_INTER_MODE_CONTEXTS * (CODEC_VP9_INTER_MODES - 1) +
+        (CODEC_VP9_SWITCHABLE_FILTERS + 1) * (CODEC_VP9_SWITCHABLE_FILTERS - 1) +
+        CODEC_VP9_INTRA_INTER_CONTEXTS +
+        CODEC_VP9_COMP_INTER_CONTEXTS +
+        CODEC_VP9_REF_CONTEXTS * 2 +
+        CODEC_VP9_REF_CONTEXTS +
+        CODEC_VP9_BLOCK_SIZE_GROUPS * (CODEC_VP9_INTRA_MODES - 1);
+    const uint32_t partitionSize = CODECHAL_VP9_PARTITION_CONTEXTS * (CODEC_VP9_PARTITION_TYPES - 1);
+    const uint32_t nmvSize =
+        (CODEC_VP9_MV_JOINTS - 1) +
+        2 * (1 + (CODEC_VP9_MV_CLASSES - 1) + (CODECHAL_VP9_CLASS0_SIZE - 1) + CODECHAL_VP9_MV_OFFSET_BITS) +
+        2 * (CODECHAL_VP9_CLASS0_SIZE * (CODEC_VP9_MV_FP_SIZE - 1) + (CODEC_VP9_MV_FP_SIZE - 1)) +
+        2 * 2;
+    const uint32_t uvModeOffset = partitionOffset + partitionSize + nmvSize + 47;
+    const uint32_t uvModeSize   = CODEC_VP9_INTRA_MODES * (CODEC_VP9_INTRA_MODES - 1);
+
+    // Key frame reset skips all but the partition and uv mode probs.
+    copies[0].type   = probCopyStagingToProb;
+    copies[0].offset = CODEC_VP9_INTER_PROB_OFFSET + (setToKey ? partitionOffset : 0);
+    copies[0].size   = setToKey ? partitionSize : (partitionOffset + partitionSize + nmvSize);
+    copies[1].type   = probCopyStagingToProb;
+    copies[1].offset = CODEC_VP9_INTER_PROB_OFFSET + uvModeOffset;
+    copies[1].size   = uvModeSize;
 }
 
-MOS_STATUS DecodeVp9BufferUpdate ::ProbBufferPartialUpdatewithDrv()
+MOS_STATUS DecodeVp9BufferUpdate::BuildProbBufUpdate(
+    const CODECHAL_DECODE_VP9_PROB_UPDATE &flags,
+    bool                                   fullUpdate,
+    uint8_t                               *staging,
+    ProbBufCopy                           *copies,
+    uint32_t                              &copyNum)
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+    DECODE_CHK_NULL(staging);
+    DECODE_CHK_NULL(copies);
 
-    DECODE_FUNC_CALL();
+    copyNum = 0;
+
+    // Region layout in staging buffer is same as prob buffer.
+    const uint32_t segProbSize = 7 + 3;
+    const uint32_t tailOffset  = CODEC_VP9_SEG_PROB_OFFSET + segProbSize;
+    const uint32_t tailSize    = 28;
+
+    bool resetFull = fullUpdate || (flags.bProbReset && flags.bResetFull);
+    bool resetDiff = !fullUpdate && flags.bProbReset && !flags.bResetFull;
+    bool segCopy   = fullUpdate || flags.bSegProbCopy;
+    bool keyReset  = flags.bResetKeyDefault ? true : false;
 
-    if (m_basicFeature->m_probUpdateFlags.bSegProbCopy ||
-        m_basicFeature->m_probUpdateFlags.bProbSave ||
-        m_basicFeature->m_probUpdateFlags.bProbReset ||
-        m_basicFeature->m_probUpdateFlags.bProbRestore)
+    // Inter probs are saved before reset, seg probs do not overlap them.
+    if (!fullUpdate && flags.bProbSave)
     {
-        ResourceAutoLock resLock(m_allocator, &(m_basicFeature->m_resVp9ProbBuffer[m_basicFeature->m_frameCtxIdx]->OsResource));
-        auto             data = (uint8_t *)resLock.LockResourceForWrite();
+        copies[copyNum++] = {probCopyProbToSave, CODEC_VP9_INTER_PROB_OFFSET, CODECHAL_VP9_INTER_PROB_SIZE};
+    }
 
-        DECODE_CHK_NULL(data);
+    if (resetFull)
+    {
+        DECODE_CHK_STATUS(ContextBufferInit(staging, keyReset));
+    }
+    else if (resetDiff)
+    {
+        DECODE_CHK_STATUS(CtxBufDiffInit(staging, keyReset));
+    }
 
-        if (m_basicFeature->m_probUpdateFlags.bSegProbCopy)
-        {
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(
-                (data + CODEC_VP9_SEG_PROB_OFFSET),
-                7,
-                m_basicFeature->m_probUpdateFlags.SegTreeProbs,
-                7));
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(
-                (data + CODEC_VP9_SEG_PROB_OFFSET + 7),
-                3,
-                m_basicFeature->m_probUpdateFlags.SegPredProbs,
-                3));
-        }
+    if (segCopy)
+    {
+        DECODE_CHK_STATUS(MOS_SecureMemcpy(
+            (staging + CODEC_VP9_SEG_PROB_OFFSET),
+            7,
+            flags.SegTreeProbs,
+            7));
+        DECODE_CHK_STATUS(MOS_SecureMemcpy(
+            (staging + CODEC_VP9_SEG_PROB_OFFSET + 7),
+            3,
+            flags.SegPredProbs,
+            3));
+    }
 
-        if (m_basicFeature->m_probUpdateFlags.bProbSave)
+    if (resetFull && segCopy)
+    {
+        copies[copyNum++] = {probCopyStagingToProb, 0, tailOffset + tailSize};
+    }
+    else if (resetFull)
+    {
+        // Keep seg tree/pred probs in prob buffer.
+        copies[copyNum++] = {probCopyStagingToProb, 0, CODEC_VP9_SEG_PROB_OFFSET};
+        copies[copyNum++] = {probCopyStagingToProb, tailOffset, tailSize};
+    }
+    else
+    {
+        if (segCopy)
         {
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(
-                m_basicFeature->m_interProbSaved,
-                CODECHAL_VP9_INTER_PROB_SIZE,
-                data + CODEC_VP9_INTER_PROB_OFFSET,
-                CODECHAL_VP9_INTER_PROB_SIZE));
+            copies[copyNum++] = {probCopyStagingToProb, CODEC_VP9_SEG_PROB_OFFSET, segProbSize};
         }
-
-        if (m_basicFeature->m_probUpdateFlags.bProbReset)
+        if (resetDiff)
         {
-            if (m_basicFeature->m_probUpdateFlags.bResetFull)
-            {
-                DECODE_CHK_STATUS(ContextBufferInit(
-                    data, (m_basicFeature->m_probUpdateFlags.bResetKeyDefault ? true : false)));
-            }
-            else
-            {
-                DECODE_CHK_STATUS(CtxBufDiffInit(
-                    data, (m_basicFeature->m_probUpdateFlags.bResetKeyDefault ? true : false)));
-            }
+            GetCtxBufDiffRegions(keyReset, &copies[copyNum]);
+            copyNum += 2;
         }
+    }
 
-        if (m_basicFeature->m_probUpdateFlags.bProbRestore)
-        {
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(
-                data + CODEC_VP9_INTER_PROB_OFFSET,
-                CODECHAL_VP9_INTER_PROB_SIZE,
-                m_basicFeature->m_interProbSaved,
-                CODECHAL_VP9_INTER_PROB_SIZE));
+    if (!fullUpdate && flags.bProbRestore)
+    {
+        copies[copyNum++] = {probCopySaveToProb, CODEC_VP9_INTER_PROB_OFFSET, CODECHAL_VP9_INTER_PROB_SIZE};
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeVp9BufferUpdate::PushProbBufCopy(PMOS_BUFFER src, PMOS_BUFFER dest, const ProbBufCopy &copy)
+{
+    DECODE_FUNC_CALL();
+    DECODE_CHK_NULL(src);
+    DECODE_CHK_NULL(dest);
+
+    HucCopyPktItf::HucCopyParams copyParams;
+    copyParams.srcBuffer  = &src->OsResource;
+    copyParams.srcOffset  = copy.offset;
+    copyParams.destBuffer = &dest->OsResource;
+    copyParams.destOffset = copy.offset;
+    copyParams.copyLength = copy.size;
+    DECODE_CHK_STATUS(m_sgementbufferResetPkt->PushCopyParams(copyParams));
+
+    if (!m_copyPktActivated)
+    {
+        DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+        m_copyPktActivated = true;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeVp9BufferUpdate::ProbBufUpdateWithStaging()
+{
+    DECODE_FUNC_CALL();
+
+    auto &flags      = m_basicFeature->m_probUpdateFlags;
+    bool  fullUpdate = m_basicFeature->m_fullProbBufferUpdate;
+
+    if (!fullUpdate && !flags.bSegProbCopy && !flags.bProbSave && !flags.bProbReset && !flags.bProbRestore)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    if (m_probStagingBufferArray == nullptr)
+    {
+        m_probStagingBufferArray = m_allocator->AllocateBufferArray(
+            MOS_ALIGN_CEIL(CODEC_VP9_PROB_MAX_NUM_ELEM, CODECHAL_PAGE_SIZE), "Vp9ProbStagingBuffer",
+            m_numProbStagingBuffer, resourceInternalReadWriteCache, lockableVideoMem);
+        DECODE_CHK_NULL(m_probStagingBufferArray);
+    }
+
+    if (m_probSaveBuffer == nullptr && (flags.bProbSave || flags.bProbRestore))
+    {
+        m_probSaveBuffer = m_allocator->AllocateBuffer(
+            MOS_ALIGN_CEIL(CODEC_VP9_PROB_MAX_NUM_ELEM, CODECHAL_PAGE_SIZE), "Vp9ProbSaveBuffer",
+            resourceInternalReadWriteCache, lockableVideoMem, true, 0);
+        DECODE_CHK_NULL(m_probSaveBuffer);
+    }
+
+    PMOS_BUFFER probBuffer = m_basicFeature->m_resVp9ProbBuffer[m_basicFeature->m_frameCtxIdx];
+    DECODE_CHK_NULL(probBuffer);
+
+    // Prob buffer may still be in use by previous frame, a CPU lock would wait for it here.
+    m_probBufUpdateCount++;
+    if (MosInterface::IsResourceBusy(m_basicFeature->m_osInterface->osStreamState, &probBuffer->OsResource))
+    {
+        m_probBufBusyCount++;
+    }
+
+    // Staging buffer rotates per frame, it is idle unless decode depth exceeds the array size.
+    PMOS_BUFFER stagingBuffer = m_probStagingBufferArray->Fetch();
+    DECODE_CHK_NULL(stagingBuffer);
+    if (MosInterface::IsResourceBusy(m_basicFeature->m_osInterface->osStreamState, &stagingBuffer->OsResource))
+    {
+        m_stagingBusyCount++;
+    }
+
+    ProbBufCopy copies[m_maxProbBufCopies];
+    uint32_t    copyNum = 0;
+    {
+        ResourceAutoLock resLock(m_allocator, &stagingBuffer->OsResource);
+        auto             data = (uint8_t *)resLock.LockResourceForWrite();
+        DECODE_CHK_NULL(data);
+
+        DECODE_CHK_STATUS(BuildProbBufUpdate(flags, fullUpdate, data, copies, copyNum));
+    }
+
+    for (uint32_t i = 0; i < copyNum; i++)
+    {
+        switch (copies[i].type)
+        {
+        case probCopyProbToSave:
+            DECODE_CHK_STATUS(PushProbBufCopy(probBuffer, m_probSaveBuffer, copies[i]));
+            break;
+        case probCopySaveToProb:
+            DECODE_CHK_STATUS(PushProbBufCopy(m_probSaveBuffer, probBuffer, copies[i]));
+            break;
+        default:
+            DECODE_CHK_STATUS(PushProbBufCopy(stagingBuffer, probBuffer, copies[i]));
+            break;
         }
     }
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS DecodeVp9BufferUpdate::ContextBufferInit(
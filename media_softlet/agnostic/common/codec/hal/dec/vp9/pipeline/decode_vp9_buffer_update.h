@@ -102,10 +102,91 @@ protected:
     //!
     MOS_STATUS AllocateSegmentInitBuffer(uint32_t allocSize);
 
-    MOS_STATUS ProbBufFullUpdatewithDrv();
-    MOS_STATUS ProbBufferPartialUpdatewithDrv();
-    MOS_STATUS ContextBufferInit(uint8_t *ctxBuffer, bool setToKey);
-    MOS_STATUS CtxBufDiffInit(uint8_t *ctxBuffer, bool setToKey);
+    //!
+    //! \brief  Source and destination of a prob buffer update copy
+    //!
+    enum ProbBufCopyType
+    {
+        probCopyStagingToProb = 0,  //!< Driver written probs from staging buffer to prob buffer
+        probCopyProbToSave,         //!< Inter probs from prob buffer to save buffer
+        probCopySaveToProb,         //!< Inter probs from save buffer back to prob buffer
+    };
+
+    //!
+    //! \brief  Prob buffer update copy
+    //! \details Staging, save and prob buffers share the prob buffer layout, so the offset is the
+    //!          same in source and destination.
+    //!
+    struct ProbBufCopy
+    {
+        ProbBufCopyType type;
+        uint32_t        offset;
+        uint32_t        size;
+    };
+
+    static constexpr uint32_t m_maxProbBufCopies = 5;  //!< Seg probs, save, 2 partial reset regions, restore
+
+    //!
+    //! \brief  Build the prob buffer update of a frame
+    //! \details Writes the driver generated probs into staging and lists the copies which update
+    //!          the prob buffer in command buffer order. The result matches updating the prob
+    //!          buffer in place with a CPU lock, in the order seg prob copy, save, reset, restore.
+    //! \param  [in] flags
+    //!         Prob update flags of the frame
+    //! \param  [in] fullUpdate
+    //!         Full prob buffer update with seg probs
+    //! \param  [out] staging
+    //!         Staging memory in prob buffer layout, CODEC_VP9_PROB_MAX_NUM_ELEM bytes
+    //! \param  [out] copies
+    //!         Copies to execute, m_maxProbBufCopies entries
+    //! \param  [out] copyNum
+    //!         Number of copies, 0 if the prob buffer is not updated
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    static MOS_STATUS BuildProbBufUpdate(
+        const CODECHAL_DECODE_VP9_PROB_UPDATE &flags,
+        bool                                   fullUpdate,
+        uint8_t                               *staging,
+        ProbBufCopy                           *copies,
+        uint32_t                              &copyNum);
+
+    //!
+    //! \brief  Update prob buffer through staging buffer and HuC copy
+    //! \details CPU writes the updated probs into a rotating staging buffer, and HuC copies them
+    //!          into the prob buffer in the current frame. Inter probs are saved to and restored
+    //!          from a save buffer by HuC copy too, so the prob buffer, which may still be in use
+    //!          by the previous frame, is never locked by CPU.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ProbBufUpdateWithStaging();
+
+    //!
+    //! \brief  Add a HuC copy of the prob buffer update
+    //! \param  [in] src
+    //!         Source buffer
+    //! \param  [in] dest
+    //!         Destination buffer
+    //! \param  [in] copy
+    //!         Region to copy
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PushProbBufCopy(PMOS_BUFFER src, PMOS_BUFFER dest, const ProbBufCopy &copy);
+
+    static MOS_STATUS ContextBufferInit(uint8_t *ctxBuffer, bool setToKey);
+    static MOS_STATUS CtxBufDiffInit(uint8_t *ctxBuffer, bool setToKey);
+
+    //!
+    //! \brief  Get the regions of the inter prob section written by CtxBufDiffInit
+    //! \details Bytes outside the regions keep the probs in prob buffer.
+    //! \param  [in] setToKey
+    //!         Reset to key frame defaults
+    //! \param  [out] copies
+    //!         Two regions, type probCopyStagingToProb
+    //!
+    static void GetCtxBufDiffRegions(bool setToKey, ProbBufCopy *copies);
 
 protected:
     Vp9BasicFeature  *m_basicFeature   = nullptr; //!< Vp9 basic feature
@@ -114,6 +195,14 @@ protected:
     HucCopyPktItf     *m_sgementbufferResetPkt = nullptr;  //!< Segment id reset packet
     PMOS_BUFFER        m_segmentInitBuffer     = nullptr; //!< Segment id init buffer
 
+    static constexpr uint32_t m_numProbStagingBuffer = 8;  //!< Number of prob staging buffers
+    BufferArray       *m_probStagingBufferArray = nullptr; //!< Prob staging buffers for CPU upload
+    PMOS_BUFFER        m_probSaveBuffer         = nullptr; //!< Saved inter probs, in prob buffer layout
+    bool               m_copyPktActivated       = false;   //!< Copy packet activated for current frame
+    uint32_t           m_probBufUpdateCount     = 0;       //!< Frames updating the prob buffer
+    uint32_t           m_probBufBusyCount       = 0;       //!< Updates while prob buffer in use by GPU, which a CPU lock would wait for
+    uint32_t           m_stagingBusyCount       = 0;       //!< Staging buffer locks which waited for GPU
+
 MEDIA_CLASS_DEFINE_END(decode__DecodeVp9BufferUpdate)
 };
 
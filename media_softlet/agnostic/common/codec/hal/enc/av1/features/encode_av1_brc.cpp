@@ -141,6 +141,10 @@ namespace encode
                 CODECHAL_PAGE_SIZE));
         }
 
+        // Constant data is built in system memory, only what changed since the
+        // recycled constant data buffer was last written is uploaded to it
+        ENCODE_CHK_STATUS_RETURN(m_constDataStaging.Init(m_allocator, sizeof(VdencAv1HucBrcConstantData), CODECHAL_CACHELINE_SIZE));
+
         return MOS_STATUS_SUCCESS;
     }
 
@@ -732,14 +736,17 @@ namespace encode
     {
         if (params.function == BRC_UPDATE)
         {
+            ENCODE_CHK_NULL_RETURN(m_basicFeature);
             const PMOS_RESOURCE brcConstDataBuffer = params.regionParams[5].presRegion;
 
-            auto hucConstData = (VdencAv1HucBrcConstantData *)m_allocator->LockResourceForWrite(brcConstDataBuffer);
+            auto hucConstData = (VdencAv1HucBrcConstantData *)m_constDataStaging.BeginFrame();
             ENCODE_CHK_NULL_RETURN(hucConstData);
 
             SetConstForUpdate(hucConstData);
 
-            m_allocator->UnLock(brcConstDataBuffer);
+            ENCODE_CHK_STATUS_RETURN(m_constDataStaging.Upload(brcConstDataBuffer));
+            m_basicFeature->m_stagedUploadBytes += m_constDataStaging.GetUploadedBytes();
+            ENCODE_VERBOSEMESSAGE("AV1 BRC constant data: %u bytes uploaded.", m_constDataStaging.GetUploadedBytes());
         }
 
         return MOS_STATUS_SUCCESS;
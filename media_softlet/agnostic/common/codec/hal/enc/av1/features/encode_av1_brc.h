@@ -30,6 +30,7 @@
 #include "encode_allocator.h"
 #include "encode_pipeline.h"
 #include "encode_recycle_resource.h"
+#include "encode_staged_buffer.h"
 #include "encode_av1_basic_feature.h"
 
 namespace encode
@@ -218,6 +219,7 @@ enum AV1_BRC_FRAME_TYPE
         MHW_BATCH_BUFFER   m_pakInsertOutputBatchBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {};  //!< PAK insert output batch buffer
         MOS_RESOURCE       m_vdencBrcDbgBuffer                                               = {};  //!< VDEnc brc debug buffer
         MOS_RESOURCE       m_resBrcDataBuffer                                                = {};  //!< Resource of bitrate control data buffer, only as an output of PAKintegrate Kernel
+        mutable EncodeStagedBuffer m_constDataStaging;                                                      //!< Staged brc constant data
 
         MHW_VDBOX_NODE_IND m_vdboxIndex = MHW_VDBOX_NODE_1;
 
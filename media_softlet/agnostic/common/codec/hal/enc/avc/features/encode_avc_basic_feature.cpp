@@ -608,7 +608,7 @@ MOS_STATUS AvcBasicFeature::PackPictureHeader()
     packPicHeaderParams.pbNewPPSHeader     = &m_newPpsHeader;
     packPicHeaderParams.pbNewSeqHeader     = &m_newSeqHeader;
 
-    ENCODE_CHK_STATUS_RETURN(AvcEncodeHeaderPacker::PackPictureHeader(&packPicHeaderParams));
+    ENCODE_CHK_STATUS_RETURN(m_headerPacker.PackPictureHeaderCached(&packPicHeaderParams));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -28,6 +28,7 @@
 
 #include "encode_basic_feature.h"
 #include "encode_avc_reference_frames.h"
+#include "encode_avc_header_packer.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_mfx_itf.h"
 #include "mhw_vdbox_huc_itf.h"
@@ -292,6 +293,8 @@ protected:
     uint32_t              m_seiDataOffset  = false;    //!< Encode SEI data offset.
     uint8_t *             m_seiParamBuffer = nullptr;  //!< Encode SEI data buffer.
 
+    AvcEncodeHeaderPacker m_headerPacker;  //!< Picture header packer, keeps the last packed SPS/PPS
+
 MEDIA_CLASS_DEFINE_END(encode__AvcBasicFeature)
 };
 
@@ -318,6 +318,20 @@ MOS_STATUS AvcEncodeHeaderPacker::PackVuiParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HE
     return eStatus;
 }
 
+void AvcEncodeHeaderPacker::ApplyFrameCropping(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    PCODEC_AVC_ENCODE_SEQUENCE_PARAMS seqParams = params->pSeqParams;
+
+    if ((!seqParams->frame_cropping_flag) &&
+        (params->dwFrameHeight != params->dwOriFrameHeight))
+    {
+        seqParams->frame_cropping_flag = 1;
+        seqParams->frame_crop_bottom_offset =
+            (int16_t)((params->dwFrameHeight - params->dwOriFrameHeight) >>
+                      (2 - seqParams->frame_mbs_only_flag));  // 4:2:0
+    }
+}
+
 MOS_STATUS AvcEncodeHeaderPacker::PackSeqParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
 {
     PCODEC_AVC_ENCODE_SEQUENCE_PARAMS seqParams;
@@ -413,14 +427,7 @@ MOS_STATUS AvcEncodeHeaderPacker::PackSeqParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HE
 
     PutBit(bsbuffer, seqParams->direct_8x8_inference_flag);
 
-    if ((!seqParams->frame_cropping_flag) &&
-        (params->dwFrameHeight != params->dwOriFrameHeight))
-    {
-        seqParams->frame_cropping_flag = 1;
-        seqParams->frame_crop_bottom_offset =
-            (int16_t)((params->dwFrameHeight - params->dwOriFrameHeight) >>
-                      (2 - seqParams->frame_mbs_only_flag));  // 4:2:0
-    }
+    ApplyFrameCropping(params);
 
     PutBit(bsbuffer, seqParams->frame_cropping_flag);
 
@@ -521,7 +528,208 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPicParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HE
     return eStatus;
 }
 
+MOS_STATUS AvcEncodeHeaderPacker::PackSeqNalUnit(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    SetNalUnit(&params->pBsBuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_SPS);
+    ENCODE_CHK_STATUS_RETURN(PackSeqParams(params));
+    SetTrailingBits(params->pBsBuffer);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackPicNalUnit(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    SetNalUnit(&params->pBsBuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_PPS);
+    ENCODE_CHK_STATUS_RETURN(PackPicParams(params));
+    SetTrailingBits(params->pBsBuffer);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+template <class Key>
+MOS_STATUS AvcEncodeHeaderPacker::PackNalUnitCached(
+    PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params,
+    const Key                                  &key,
+    ParamSetCache<Key>                         &cache,
+    MOS_STATUS (*pack)(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS),
+    bool                                       *newHeader)
+{
+    ENCODE_CHK_NULL_RETURN(newHeader);
+
+    BSBuffer *bsbuffer = params->pBsBuffer;
+
+    if (cache.valid && memcmp(&cache.key, &key, sizeof(Key)) == 0)
+    {
+        // NAL units are byte aligned, so the cached bytes can be copied as is
+        ENCODE_CHK_STATUS_RETURN(MOS_SecureMemcpy(bsbuffer->pCurrent, cache.nalUnit.size(), cache.nalUnit.data(), cache.nalUnit.size()));
+        bsbuffer->pCurrent += cache.nalUnit.size();
+        *(bsbuffer->pCurrent) = 0;  // Clear the next byte as the bit writers do
+        *newHeader |= cache.newHeader;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint8_t *nalStart    = bsbuffer->pCurrent;
+    bool     frameHeader = *newHeader;
+
+    // Pack with a cleared flag to record whether this NAL unit sets it
+    cache.valid       = false;
+    *newHeader        = false;
+    MOS_STATUS status = pack(params);
+    bool packedHeader = *newHeader;
+    *newHeader        = frameHeader || packedHeader;
+    ENCODE_CHK_STATUS_RETURN(status);
+    ENCODE_ASSERT(bsbuffer->BitOffset == 0);
+
+    cache.nalUnit.assign(nalStart, bsbuffer->pCurrent);
+    cache.newHeader = packedHeader;
+    cache.valid     = true;
+    MOS_SecureMemcpy(&cache.key, sizeof(Key), &key, sizeof(Key));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackSeqNalUnitCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    PCODEC_AVC_ENCODE_SEQUENCE_PARAMS seqParams = params->pSeqParams;
+
+    // Cropping is applied before the key is taken so the key holds the packed values
+    ApplyFrameCropping(params);
+
+    // Sequence params also carry rate control, only the fields SPS is packed from make the key
+    SpsKey key;
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.Profile              = seqParams->Profile;
+    key.Level                = seqParams->Level;
+    key.constraint_set_flags = (uint8_t)(seqParams->constraint_set0_flag |
+                                         (seqParams->constraint_set1_flag << 1) |
+                                         (seqParams->constraint_set2_flag << 2) |
+                                         (seqParams->constraint_set3_flag << 3));
+    key.seq_parameter_set_id = seqParams->seq_parameter_set_id;
+
+    if (seqParams->Profile == CODEC_AVC_HIGH_PROFILE ||
+        seqParams->Profile == CODEC_AVC_HIGH10_PROFILE ||
+        seqParams->Profile == CODEC_AVC_HIGH422_PROFILE ||
+        seqParams->Profile == CODEC_AVC_HIGH444_PROFILE ||
+        seqParams->Profile == CODEC_AVC_CAVLC444_INTRA_PROFILE ||
+        seqParams->Profile == CODEC_AVC_SCALABLE_BASE_PROFILE ||
+        seqParams->Profile == CODEC_AVC_SCALABLE_HIGH_PROFILE)
+    {
+        key.chroma_format_idc                    = seqParams->chroma_format_idc;
+        key.separate_colour_plane_flag           = (seqParams->chroma_format_idc == 3) ? seqParams->separate_colour_plane_flag : 0;
+        key.bit_depth_luma_minus8                = seqParams->bit_depth_luma_minus8;
+        key.bit_depth_chroma_minus8              = seqParams->bit_depth_chroma_minus8;
+        key.qpprime_y_zero_transform_bypass_flag = seqParams->qpprime_y_zero_transform_bypass_flag;
+        key.seq_scaling_matrix_present_flag      = seqParams->seq_scaling_matrix_present_flag;
+        if (seqParams->seq_scaling_matrix_present_flag)
+        {
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                key.seq_scaling_list_present_flag[i] = seqParams->seq_scaling_list_present_flag[i];
+            }
+            if (params->pAvcIQMatrixParams)
+            {
+                MOS_SecureMemcpy(&key.iqMatrix, sizeof(key.iqMatrix), params->pAvcIQMatrixParams, sizeof(*params->pAvcIQMatrixParams));
+            }
+        }
+    }
+
+    key.log2_max_frame_num_minus4 = seqParams->log2_max_frame_num_minus4;
+    key.pic_order_cnt_type        = seqParams->pic_order_cnt_type;
+    if (seqParams->pic_order_cnt_type == 0)
+    {
+        key.log2_max_pic_order_cnt_lsb_minus4 = seqParams->log2_max_pic_order_cnt_lsb_minus4;
+    }
+    else if (seqParams->pic_order_cnt_type == 1)
+    {
+        key.delta_pic_order_always_zero_flag      = seqParams->delta_pic_order_always_zero_flag;
+        key.offset_for_non_ref_pic                = seqParams->offset_for_non_ref_pic;
+        key.offset_for_top_to_bottom_field        = seqParams->offset_for_top_to_bottom_field;
+        key.num_ref_frames_in_pic_order_cnt_cycle = seqParams->num_ref_frames_in_pic_order_cnt_cycle;
+        for (uint32_t i = 0; i < seqParams->num_ref_frames_in_pic_order_cnt_cycle; i++)
+        {
+            key.offset_for_ref_frame[i] = seqParams->offset_for_ref_frame[i];
+        }
+    }
+
+    key.NumRefFrames                         = seqParams->NumRefFrames;
+    key.gaps_in_frame_num_value_allowed_flag = seqParams->gaps_in_frame_num_value_allowed_flag;
+    key.pic_width_in_mbs_minus1              = seqParams->pic_width_in_mbs_minus1;
+    key.pic_height_in_map_units_minus1       = seqParams->pic_height_in_map_units_minus1;
+    key.frame_mbs_only_flag                  = seqParams->frame_mbs_only_flag;
+    key.mb_adaptive_frame_field_flag         = seqParams->frame_mbs_only_flag ? 0 : seqParams->mb_adaptive_frame_field_flag;
+    key.direct_8x8_inference_flag            = seqParams->direct_8x8_inference_flag;
+    key.frame_cropping_flag                  = seqParams->frame_cropping_flag;
+    if (seqParams->frame_cropping_flag)
+    {
+        key.frame_crop_left_offset   = seqParams->frame_crop_left_offset;
+        key.frame_crop_right_offset  = seqParams->frame_crop_right_offset;
+        key.frame_crop_top_offset    = seqParams->frame_crop_top_offset;
+        key.frame_crop_bottom_offset = seqParams->frame_crop_bottom_offset;
+    }
+
+    key.vui_parameters_present_flag = seqParams->vui_parameters_present_flag;
+    if (seqParams->vui_parameters_present_flag && params->pAvcVuiParams)
+    {
+        MOS_SecureMemcpy(&key.vuiParams, sizeof(key.vuiParams), params->pAvcVuiParams, sizeof(*params->pAvcVuiParams));
+    }
+
+    return PackNalUnitCached(params, key, m_spsCache, PackSeqNalUnit, params->pbNewSeqHeader);
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackPicNalUnitCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    ENCODE_CHK_NULL_RETURN(params->pPicParams);
+
+    PCODEC_AVC_ENCODE_PIC_PARAMS picParams = params->pPicParams;
+
+    // Picture params change every frame, so only the fields PPS is packed from make the key
+    PpsKey key;
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.Profile                                = params->pSeqParams->Profile;
+    key.pic_parameter_set_id                   = picParams->pic_parameter_set_id;
+    key.seq_parameter_set_id                   = picParams->seq_parameter_set_id;
+    key.entropy_coding_mode_flag               = picParams->entropy_coding_mode_flag;
+    key.pic_order_present_flag                 = picParams->pic_order_present_flag;
+    key.num_slice_groups_minus1                = picParams->num_slice_groups_minus1;
+    key.num_ref_idx_l0_active_minus1           = picParams->num_ref_idx_l0_active_minus1;
+    key.num_ref_idx_l1_active_minus1           = picParams->num_ref_idx_l1_active_minus1;
+    key.weighted_pred_flag                     = picParams->weighted_pred_flag;
+    key.weighted_bipred_idc                    = picParams->weighted_bipred_idc;
+    key.pic_init_qp_minus26                    = picParams->pic_init_qp_minus26;
+    key.pic_init_qs_minus26                    = picParams->pic_init_qs_minus26;
+    key.chroma_qp_index_offset                 = picParams->chroma_qp_index_offset;
+    key.second_chroma_qp_index_offset          = picParams->second_chroma_qp_index_offset;
+    key.deblocking_filter_control_present_flag = picParams->deblocking_filter_control_present_flag;
+    key.constrained_intra_pred_flag            = picParams->constrained_intra_pred_flag;
+    key.redundant_pic_cnt_present_flag         = picParams->redundant_pic_cnt_present_flag;
+    key.transform_8x8_mode_flag                = picParams->transform_8x8_mode_flag;
+    key.pic_scaling_matrix_present_flag        = picParams->pic_scaling_matrix_present_flag;
+    if (picParams->pic_scaling_matrix_present_flag)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            key.pic_scaling_list_present_flag[i] = picParams->pic_scaling_list_present_flag[i];
+        }
+        if (params->pAvcIQMatrixParams)
+        {
+            MOS_SecureMemcpy(&key.iqMatrix, sizeof(key.iqMatrix), params->pAvcIQMatrixParams, sizeof(*params->pAvcIQMatrixParams));
+        }
+    }
+
+    return PackNalUnitCached(params, key, m_ppsCache, PackPicNalUnit, params->pbNewPPSHeader);
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeaderCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    return PackPictureHeader(params, this);
+}
+
 MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+{
+    return PackPictureHeader(params, nullptr);
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, AvcEncodeHeaderPacker *packer)
 {
     ENCODE_FUNC_CALL();
 
@@ -568,9 +776,7 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PI
         params->ppNALUnitParams[indexNALUnit]->uiNalUnitType             = CODECHAL_ENCODE_AVC_NAL_UT_SPS;
         params->ppNALUnitParams[indexNALUnit]->bInsertEmulationBytes     = true;
         params->ppNALUnitParams[indexNALUnit]->uiSkipEmulationCheckCount = 4;
-        SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_SPS);
-        ENCODE_CHK_STATUS_RETURN(PackSeqParams(params));
-        SetTrailingBits(bsbuffer);
+        ENCODE_CHK_STATUS_RETURN(packer ? packer->PackSeqNalUnitCached(params) : PackSeqNalUnit(params));
         params->ppNALUnitParams[indexNALUnit]->uiSize =
             (uint32_t)(bsbuffer->pCurrent -
                        bsbuffer->pBase -
@@ -583,9 +789,7 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PI
     params->ppNALUnitParams[indexNALUnit]->uiNalUnitType             = CODECHAL_ENCODE_AVC_NAL_UT_PPS;
     params->ppNALUnitParams[indexNALUnit]->bInsertEmulationBytes     = true;
     params->ppNALUnitParams[indexNALUnit]->uiSkipEmulationCheckCount = 4;
-    SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_PPS);
-    ENCODE_CHK_STATUS_RETURN(PackPicParams(params));
-    SetTrailingBits(bsbuffer);
+    ENCODE_CHK_STATUS_RETURN(packer ? packer->PackPicNalUnitCached(params) : PackPicNalUnit(params));
     params->ppNALUnitParams[indexNALUnit]->uiSize =
         (uint32_t)(bsbuffer->pCurrent -
                    bsbuffer->pBase -
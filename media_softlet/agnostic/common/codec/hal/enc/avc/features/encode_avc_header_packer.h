@@ -27,6 +27,7 @@
 #define __ENCODE_AVC_HEADER_PACKER_H__
 
 #include "codec_def_encode_avc.h"
+#include <vector>
 
 namespace encode
 {
@@ -54,10 +55,192 @@ public:
     //!
     static MOS_STATUS PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
 
+    //!
+    //! \brief    Pack picture header, reusing the SPS/PPS NAL units of earlier calls
+    //! \details  SPS and PPS are only packed again when the parameters they are built from
+    //!           change. The output is bit-exact with PackPictureHeader.
+    //! \param    [in] params
+    //!           picture header pack params
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS PackPictureHeaderCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
     static MOS_STATUS PackSliceHeader(PCODECHAL_ENCODE_AVC_PACK_SLC_HEADER_PARAMS params);
 
 protected:
 
+    //!
+    //! \brief  Parameters a SPS NAL unit is packed from
+    //!
+    struct SpsKey
+    {
+        int32_t                        offset_for_non_ref_pic;
+        int32_t                        offset_for_top_to_bottom_field;
+        int32_t                        offset_for_ref_frame[256];       //!< Zero past num_ref_frames_in_pic_order_cnt_cycle
+        uint16_t                       seq_scaling_list_present_flag[8];
+        uint16_t                       pic_width_in_mbs_minus1;
+        uint16_t                       pic_height_in_map_units_minus1;
+        uint16_t                       frame_crop_left_offset;
+        uint16_t                       frame_crop_right_offset;
+        uint16_t                       frame_crop_top_offset;
+        uint16_t                       frame_crop_bottom_offset;
+        uint8_t                        Profile;
+        uint8_t                        Level;
+        uint8_t                        constraint_set_flags;            //!< constraint_set0_flag to constraint_set3_flag in bits 0 to 3
+        uint8_t                        seq_parameter_set_id;
+        uint8_t                        chroma_format_idc;
+        uint8_t                        separate_colour_plane_flag;
+        uint8_t                        bit_depth_luma_minus8;
+        uint8_t                        bit_depth_chroma_minus8;
+        uint8_t                        qpprime_y_zero_transform_bypass_flag;
+        uint8_t                        seq_scaling_matrix_present_flag;
+        uint8_t                        log2_max_frame_num_minus4;
+        uint8_t                        pic_order_cnt_type;
+        uint8_t                        log2_max_pic_order_cnt_lsb_minus4;
+        uint8_t                        delta_pic_order_always_zero_flag;
+        uint8_t                        num_ref_frames_in_pic_order_cnt_cycle;
+        uint8_t                        NumRefFrames;
+        uint8_t                        gaps_in_frame_num_value_allowed_flag;
+        uint8_t                        frame_mbs_only_flag;
+        uint8_t                        mb_adaptive_frame_field_flag;
+        uint8_t                        direct_8x8_inference_flag;
+        uint8_t                        frame_cropping_flag;
+        uint8_t                        vui_parameters_present_flag;
+        CODECHAL_ENCODE_AVC_VUI_PARAMS vuiParams;   //!< Zero when VUI is not present
+        CODEC_AVC_IQ_MATRIX_PARAMS     iqMatrix;    //!< Zero when seq scaling matrix is not present
+    };
+
+    //!
+    //! \brief  Parameters a PPS NAL unit is packed from
+    //!
+    struct PpsKey
+    {
+        uint16_t                   pic_scaling_list_present_flag[8];
+        uint8_t                    Profile;
+        uint8_t                    pic_parameter_set_id;
+        uint8_t                    seq_parameter_set_id;
+        uint8_t                    entropy_coding_mode_flag;
+        uint8_t                    pic_order_present_flag;
+        uint8_t                    num_slice_groups_minus1;
+        uint8_t                    num_ref_idx_l0_active_minus1;
+        uint8_t                    num_ref_idx_l1_active_minus1;
+        uint8_t                    weighted_pred_flag;
+        uint8_t                    weighted_bipred_idc;
+        char                       pic_init_qp_minus26;
+        char                       pic_init_qs_minus26;
+        char                       chroma_qp_index_offset;
+        char                       second_chroma_qp_index_offset;
+        uint8_t                    deblocking_filter_control_present_flag;
+        uint8_t                    constrained_intra_pred_flag;
+        uint8_t                    redundant_pic_cnt_present_flag;
+        uint8_t                    transform_8x8_mode_flag;
+        uint8_t                    pic_scaling_matrix_present_flag;
+        CODEC_AVC_IQ_MATRIX_PARAMS iqMatrix;   //!< Zero when pic scaling matrix is not present
+    };
+
+    //!
+    //! \brief  Packed parameter set NAL unit and the key it was packed from
+    //!
+    template <class Key>
+    struct ParamSetCache
+    {
+        bool                 valid     = false;
+        Key                  key       = {};
+        std::vector<uint8_t> nalUnit;            //!< Packed NAL unit, start code included
+        bool                 newHeader = false;  //!< Header flag the uncached packer reported
+    };
+
+    //!
+    //! \brief    Pack picture header with optional SPS/PPS caching
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //! \param    [in] packer
+    //!           Packer holding the SPS/PPS caches, nullptr to pack every NAL unit
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    static MOS_STATUS PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, AvcEncodeHeaderPacker *packer);
+
+    //!
+    //! \brief    Pack SPS NAL unit, start code and trailing bits included
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    static MOS_STATUS PackSeqNalUnit(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
+    //!
+    //! \brief    Pack PPS NAL unit, start code and trailing bits included
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    static MOS_STATUS PackPicNalUnit(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
+    //!
+    //! \brief    Pack SPS NAL unit, copying it from the cache when the key is unchanged
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    MOS_STATUS PackSeqNalUnitCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
+    //!
+    //! \brief    Pack PPS NAL unit, copying it from the cache when the key is unchanged
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    MOS_STATUS PackPicNalUnitCached(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
+    //!
+    //! \brief    Copy a cached NAL unit on a key match, else pack it and refresh the cache
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //! \param    [in] key
+    //!           Key of the NAL unit to pack
+    //! \param    [in, out] cache
+    //!           Cache of the NAL unit type
+    //! \param    [in] pack
+    //!           Uncached packing function of the NAL unit type
+    //! \param    [in, out] newHeader
+    //!           Header flag the packing function sets
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    template <class Key>
+    static MOS_STATUS PackNalUnitCached(
+        PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params,
+        const Key                                  &key,
+        ParamSetCache<Key>                         &cache,
+        MOS_STATUS (*pack)(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS),
+        bool                                       *newHeader);
+
+    //!
+    //! \brief    Signal the cropping of a padded frame height in the sequence parameters
+    //!
+    //! \param    [in] params
+    //!           Pointer to codechal encode Avc pack picture header parameter
+    //!
+    static void ApplyFrameCropping(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+
     //!
     //! \brief    Pack AUD parameters
     //!
@@ -125,6 +308,9 @@ protected:
 
     static void GetPicNum(PCODECHAL_ENCODE_AVC_PACK_SLC_HEADER_PARAMS params, uint8_t list);
 
+    ParamSetCache<SpsKey> m_spsCache;  //!< Last packed SPS NAL unit
+    ParamSetCache<PpsKey> m_ppsCache;  //!< Last packed PPS NAL unit
+
 MEDIA_CLASS_DEFINE_END(encode__AvcEncodeHeaderPacker)
 };
 
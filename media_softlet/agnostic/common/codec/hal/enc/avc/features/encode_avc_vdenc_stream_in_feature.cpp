@@ -130,23 +130,61 @@ MOS_STATUS AvcVdencStreamInFeature::Clear()
         return MOS_STATUS_UNINITIALIZED;
     }
 
-    uint8_t *pData = (uint8_t*)Lock();
-    ENCODE_CHK_NULL_RETURN(pData);
-
-    MOS_ZeroMemory(pData, m_heightInMb * m_widthInMb * AvcVdencStreamInState::byteSize);
-    return Unlock();
+    ENCODE_CHK_STATUS_RETURN(m_streamInBuilder.Init(
+        m_allocator,
+        m_heightInMb * m_widthInMb * AvcVdencStreamInState::byteSize,
+        m_widthInMb * AvcVdencStreamInState::byteSize));
+    ENCODE_CHK_NULL_RETURN(m_streamInBuilder.BeginFrame());
+
+    // Written by Flush() once all setups of the frame are done
+    m_uploadPending = true;
+    return MOS_STATUS_SUCCESS;
 }
 
 AvcVdencStreamInState* AvcVdencStreamInFeature::Lock()
 {
     ENCODE_FUNC_CALL();
-    return m_enabled ? (AvcVdencStreamInState*)m_allocator->LockResourceForWrite(m_streamInBuffer) : nullptr;
+    return m_enabled ? (AvcVdencStreamInState*)m_streamInBuilder.GetData() : nullptr;
 }
 
 MOS_STATUS AvcVdencStreamInFeature::Unlock()
 {
     ENCODE_FUNC_CALL();
-    return m_enabled ? m_allocator->UnLock(m_streamInBuffer) : MOS_STATUS_UNINITIALIZED;
+
+    if (!m_enabled)
+    {
+        return MOS_STATUS_UNINITIALIZED;
+    }
+
+    // Several setups may update the data of one frame, it is written once by Flush()
+    m_uploadPending = true;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS AvcVdencStreamInFeature::Flush()
+{
+    ENCODE_FUNC_CALL();
+
+    if (!m_enabled || !m_uploadPending)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    ENCODE_CHK_NULL_RETURN(m_basicFeature);
+    ENCODE_CHK_NULL_RETURN(m_basicFeature->m_picParam);
+
+    m_uploadPending = false;
+    ENCODE_CHK_STATUS_RETURN(m_streamInBuilder.Upload(m_streamInBuffer));
+    m_basicFeature->m_stagedUploadBytes += m_streamInBuilder.GetUploadedBytes();
+    ENCODE_VERBOSEMESSAGE("AVC stream-in: %u bytes uploaded.", m_streamInBuilder.GetUploadedBytes());
+
+    // BRC non-native ROI has HuC write the buffer (see HUC_VIRTUAL_ADDR_STATE)
+    if (m_basicFeature->m_picParam->NumROI && !m_basicFeature->m_picParam->bNativeROI)
+    {
+        m_streamInBuilder.Invalidate(m_streamInBuffer);
+    }
+
+    return MOS_STATUS_SUCCESS;
 }
 
 #if USE_CODECHAL_DEBUG_TOOL
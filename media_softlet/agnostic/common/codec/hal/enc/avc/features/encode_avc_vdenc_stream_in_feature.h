@@ -28,6 +28,7 @@
 
 #include "codechal_debug.h"
 #include "encode_allocator.h"
+#include "encode_staged_buffer.h"
 #include "encode_avc_basic_feature.h"
 #include "mhw_vdbox_vdenc_itf.h"
 
@@ -145,19 +146,30 @@ public:
     virtual MOS_STATUS Update(void* setting) override;
 
     //!
-    //! \brief  Get VDEnc Stream-in buffer base locked addrress
+    //! \brief  Get VDEnc Stream-in data of the current frame
+    //! \details The data is kept in system memory, changes reach the stream-in
+    //!          buffer on Flush()
     //! \return AvcVdencStreamInState*
-    //!         pointer to stream in buffer locked address
+    //!         pointer to stream in data
     //!
     virtual AvcVdencStreamInState* Lock();
 
     //!
-    //! \brief  Unlock VDEnc Stream-in buffer base locked addrress
+    //! \brief  Finish update of stream-in data got by Lock()
     //! \return MOS_STATUS
     //!         MOS_STATUS_SUCCESS if success, else fail reason
     //!
     virtual MOS_STATUS Unlock();
 
+    //!
+    //! \brief  Write the rows changed since the stream-in buffer was last written
+    //! \details Called once per frame after all setups, so ROI and ForceSkip
+    //!          updates of the same frame are uploaded together
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Flush();
+
     //!
     //! \brief  Enable VDEnc Stream-in feature
     //!         Should be called only if VDEnc Stream-in will be used
@@ -193,6 +205,9 @@ protected:
     EncodeAllocator     *m_allocator      = nullptr;  //!< Encode allocator
     PMOS_RESOURCE        m_streamInBuffer = nullptr;  //!< Stream in buffer
 
+    EncodeStagedBuffer m_streamInBuilder;         //!< Builds stream in data and uploads the changed rows
+    bool               m_uploadPending = false;   //!< Stream in data changed but not uploaded yet
+
     bool     m_updated     = false;  //!< Indicate stream in buffer updated
     bool     m_enabled     = false;  //!< Indicate stream in enabled for current frame or not
     uint32_t m_widthInMb   = 0;
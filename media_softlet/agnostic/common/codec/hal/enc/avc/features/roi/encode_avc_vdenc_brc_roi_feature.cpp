@@ -84,13 +84,10 @@ namespace encode
             for (int32_t i = m_picParam->NumROI - 1; i >= 0; i--)
             {
                 ENCODE_CHK_STATUS_MESSAGE_RETURN(GetDeltaQPIndex(m_maxNumNativeRoi, m_picParam->ROI[i].PriorityLevelOrDQp, dqpIdx), "dQP index not found");
-                for (curY = m_picParam->ROI[i].Top; curY < m_picParam->ROI[i].Bottom; curY++)
-                {
-                    for (curX = m_picParam->ROI[i].Left; curX < m_picParam->ROI[i].Right; curX++)
-                    {
-                        (pData + (m_basicFeature->m_picWidthInMb * curY + curX))->DW0.RegionOfInterestSelection = dqpIdx + 1;  // Shift ROI by 1
-                    }
-                }
+
+                AvcVdencStreamInState entry;
+                entry.DW0.RegionOfInterestSelection = dqpIdx + 1;  // Shift ROI by 1
+                FillRoiRegion(pData, m_picParam->ROI[i], entry);
             }
             m_vdencStreamInFeature->Unlock();
         }
@@ -142,20 +139,16 @@ namespace encode
         uint16_t rowOffset[8] = {0, 3, 5, 2, 7, 4, 1, 6};
         uint16_t boostIdx     = rowOffset[m_basicFeature->m_frameNum & 7];
 
+        AvcVdencStreamInState entry;
+        entry.DW0.RegionOfInterestSelection = 1;
+
         for (uint16_t y = 0; y < m_basicFeature->m_picHeightInMb; y++)
         {
             if ((y & 7) == boostIdx)
             {
-                for (uint16_t x = 0; x < m_basicFeature->m_picWidthInMb; x++)
-                {
-                    pData->DW0.RegionOfInterestSelection = 1;
-                    pData++;
-                }
-            }
-            else
-            {
-                pData += m_basicFeature->m_picWidthInMb;
+                EncodeStagedBuffer::FillEntries(pData, &entry, sizeof(entry), m_basicFeature->m_picWidthInMb);
             }
+            pData += m_basicFeature->m_picWidthInMb;
         }
 
         m_vdencStreamInFeature->Unlock();
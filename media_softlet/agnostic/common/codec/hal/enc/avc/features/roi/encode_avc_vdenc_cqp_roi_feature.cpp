@@ -84,14 +84,9 @@ MOS_STATUS AvcVdencCqpRoiFeature::SetupROI()
                 return MOS_STATUS_INVALID_PARAMETER;
             }
 
-            uint32_t curX, curY;
-            for (curY = m_picParam->ROI[i].Top; curY < m_picParam->ROI[i].Bottom; curY++)
-            {
-                for (curX = m_picParam->ROI[i].Left; curX < m_picParam->ROI[i].Right; curX++)
-                {
-                    (pData + (m_basicFeature->m_picWidthInMb * curY + curX))->DW0.RegionOfInterestSelection = dqpidx + 1;  //Shift ROI by 1
-                }
-            }
+            AvcVdencStreamInState entry;
+            entry.DW0.RegionOfInterestSelection = dqpidx + 1;  //Shift ROI by 1
+            FillRoiRegion(pData, m_picParam->ROI[i], entry);
         }
     }
     else
@@ -99,21 +94,16 @@ MOS_STATUS AvcVdencCqpRoiFeature::SetupROI()
         ENCODE_NORMALMESSAGE("Setup CQP Non-Native ROI");
 
         int8_t qpPrimeY = (int8_t)CodecHal_Clip3(10, 51, m_picParam->QpY + m_basicFeature->m_sliceParams->slice_qp_delta);
-        for (int32_t i = 0; i < m_basicFeature->m_picWidthInMb * m_basicFeature->m_picHeightInMb; i++)
-        {
-            (pData + i)->DW1.QpPrimeY = qpPrimeY;
-        }
+
+        AvcVdencStreamInState entry;
+        entry.DW1.QpPrimeY = qpPrimeY;
+        EncodeStagedBuffer::FillEntries(
+            pData, &entry, sizeof(entry), m_basicFeature->m_picWidthInMb * m_basicFeature->m_picHeightInMb);
+
         for (int32_t i = m_picParam->NumROI - 1; i >= 0; i--)
         {
-            uint32_t curX, curY;
-            int8_t   newQp = (int8_t)CodecHal_Clip3(10, 51, qpPrimeY + m_picParam->ROI[i].PriorityLevelOrDQp);
-            for (curY = m_picParam->ROI[i].Top; curY < m_picParam->ROI[i].Bottom; curY++)
-            {
-                for (curX = m_picParam->ROI[i].Left; curX < m_picParam->ROI[i].Right; curX++)
-                {
-                    (pData + (m_basicFeature->m_picWidthInMb * curY + curX))->DW1.QpPrimeY = newQp;
-                }
-            }
+            entry.DW1.QpPrimeY = (int8_t)CodecHal_Clip3(10, 51, qpPrimeY + m_picParam->ROI[i].PriorityLevelOrDQp);
+            FillRoiRegion(pData, m_picParam->ROI[i], entry);
         }
     }
 
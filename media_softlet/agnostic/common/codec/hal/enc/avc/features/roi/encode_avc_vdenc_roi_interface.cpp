@@ -111,6 +111,9 @@ MOS_STATUS AvcVdencRoiInterface::Update(void *params)
     else
         m_picParam->ForceSkip.Enable = 0;
 
+    // Stream-in data of all setups above is written once
+    ENCODE_CHK_STATUS_RETURN(m_vdencStreamInFeature->Flush());
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -243,4 +246,18 @@ MOS_STATUS AvcVdencRoiInterface::GetDeltaQPIndex(uint32_t maxNumRoi, int32_t dqp
 
     return MOS_STATUS_SUCCESS;
 }
+
+void AvcVdencRoiInterface::FillRoiRegion(AvcVdencStreamInState *streamIn, const CODEC_ROI &roi, const AvcVdencStreamInState &entry)
+{
+    if (roi.Right <= roi.Left)
+    {
+        return;
+    }
+
+    for (uint32_t curY = roi.Top; curY < roi.Bottom; curY++)
+    {
+        EncodeStagedBuffer::FillEntries(
+            streamIn + m_basicFeature->m_picWidthInMb * curY + roi.Left, &entry, sizeof(entry), roi.Right - roi.Left);
+    }
+}
 }
@@ -111,6 +111,18 @@ protected:
 
     MOS_STATUS GetDeltaQPIndex(uint32_t maxNumRoi, int32_t dqp, int32_t& dqpIdx);
 
+    //!
+    //! \brief    Fill the MBs covered by a ROI rectangle with one stream-in entry
+    //!
+    //! \param    [in] streamIn
+    //!           Stream-in data of the frame
+    //! \param    [in] roi
+    //!           ROI rectangle in MB units
+    //! \param    [in] entry
+    //!           Stream-in entry written to every MB of the rectangle
+    //!
+    void FillRoiRegion(AvcVdencStreamInState *streamIn, const CODEC_ROI &roi, const AvcVdencStreamInState &entry);
+
     static constexpr uint8_t m_maxNumRoi       = 16;  //!< VDEnc maximum number of ROI supported (uncluding non-ROI zone0)
     static constexpr uint8_t m_maxNumNativeRoi = 3;   //!< Number of native ROI with different dQP supported by VDEnc HW
 
@@ -298,6 +298,7 @@ MOS_STATUS AvcVdencPipeline::ResetParams()
 
     avcBasicfeature->m_frameNum++;
 
+    ENCODE_CHK_STATUS_RETURN(ReportStagedUploads());
     ENCODE_CHK_STATUS_RETURN(m_statusReport->Reset());
 
     return MOS_STATUS_SUCCESS;
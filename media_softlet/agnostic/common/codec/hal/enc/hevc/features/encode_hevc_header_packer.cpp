@@ -150,7 +150,12 @@ void HevcHeaderPacker::PackSSH(
         PackSSHPartIdAddr(bs, nalu, sps, pps, slice);
 
     if (!slice.dependent_slice_segment_flag)
-        PackSSHPartIndependent(bs, nalu, sps, pps, slice);
+    {
+        if (m_bSSHCacheEnabled)
+            PackSSHPartIndependentCached(bs, nalu, sps, pps, slice);
+        else
+            PackSSHPartIndependent(bs, nalu, sps, pps, slice);
+    }
 
     if (pps.tiles_enabled_flag || pps.entropy_coding_sync_enabled_flag)
     {
@@ -260,6 +265,51 @@ void HevcHeaderPacker::PackSSHPartIndependent(
     ENCODE_ASSERT(nSE >= 2);
 }
 
+void HevcHeaderPacker::PackSSHPartIndependentCached(
+    BitstreamWriter &bs,
+    NALU const &     nalu,
+    SPS const &      sps,
+    PPS const &      pps,
+    Slice const &    slice)
+{
+    if (bs.HasInfo())
+    {
+        // Pack info records offsets into bs, which a copied part would not update
+        PackSSHPartIndependent(bs, nalu, sps, pps, slice);
+        return;
+    }
+
+    // The independent part does not use the fields PackSSHPartIdAddr packs
+    Slice key;
+    MOS_SecureMemcpy(&key, sizeof(key), &slice, sizeof(slice));
+    key.first_slice_segment_in_pic_flag = 0;
+    key.dependent_slice_segment_flag    = 0;
+    key.segment_address                 = 0;
+
+    // SPS and PPS are loaded once per SliceHeaderPacker call, except for the two fields
+    // LoadSliceHeaderParams updates per slice
+    bool bHit = m_sshCache.valid &&
+                m_sshCache.nal_unit_type == nalu.nal_unit_type &&
+                m_sshCache.log2_max_pic_order_cnt_lsb_minus4 == sps.log2_max_pic_order_cnt_lsb_minus4 &&
+                m_sshCache.lists_modification_present_flag == pps.lists_modification_present_flag &&
+                !memcmp(&m_sshCache.slice, &key, sizeof(key));
+
+    if (!bHit)
+    {
+        BitstreamWriter part(m_sshCache.bits.data(), (mfxU32)m_sshCache.bits.size());
+        PackSSHPartIndependent(part, nalu, sps, pps, slice);
+
+        m_sshCache.bitLen                            = part.GetOffset();
+        m_sshCache.nal_unit_type                     = nalu.nal_unit_type;
+        m_sshCache.log2_max_pic_order_cnt_lsb_minus4 = sps.log2_max_pic_order_cnt_lsb_minus4;
+        m_sshCache.lists_modification_present_flag   = pps.lists_modification_present_flag;
+        MOS_SecureMemcpy(&m_sshCache.slice, sizeof(m_sshCache.slice), &key, sizeof(key));
+        m_sshCache.valid = true;
+    }
+
+    bs.PutBitsBuffer(m_sshCache.bitLen, m_sshCache.bits.data());
+}
+
 void HevcHeaderPacker::PackSSHPartNonIDR(
     BitstreamWriter &bs,
     SPS const &      sps,
@@ -543,6 +593,7 @@ MOS_STATUS HevcHeaderPacker::SliceHeaderPacker(EncoderParams *encodeParams)
     ENCODE_CHK_STATUS_RETURN(GetSPSParams(static_cast<PCODEC_HEVC_ENCODE_SEQUENCE_PARAMS>(encodeParams->pSeqParams)));
     ENCODE_CHK_STATUS_RETURN(GetPPSParams(static_cast<PCODEC_HEVC_ENCODE_PICTURE_PARAMS>(encodeParams->pPicParams)));
     ENCODE_CHK_STATUS_RETURN(GetNaluParams(nalType, 0, 0, pBSBuffer->pCurrent == pBSBuffer->pBase));
+    m_sshCache.valid = false;
 
     //uint8_t *pCurrent = pBSBuffer->pCurrent;
     //uint32_t
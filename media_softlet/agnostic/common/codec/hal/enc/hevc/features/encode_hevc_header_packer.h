@@ -482,14 +482,29 @@ using STRPSPic = STRPS::Pic;
 class HevcHeaderPacker
 {
 public:
-    BSBuffer *              m_bsBuffer      = nullptr;
-    HevcNALU                m_naluParams    = {};
-    HevcSPS                 m_spsParams     = {};
-    HevcPPS                 m_ppsParams     = {};
-    HevcSlice               m_sliceParams   = {};
-    uint8_t                 nalType         = 0;
-    std::array<mfxU8, 1024> m_rbsp          = {};
-    bool                    m_bDssEnabled   = false;
+    BSBuffer *              m_bsBuffer         = nullptr;
+    HevcNALU                m_naluParams       = {};
+    HevcSPS                 m_spsParams        = {};
+    HevcPPS                 m_ppsParams        = {};
+    HevcSlice               m_sliceParams      = {};
+    uint8_t                 nalType            = 0;
+    std::array<mfxU8, 1024> m_rbsp             = {};
+    bool                    m_bDssEnabled      = false;
+    bool                    m_bSSHCacheEnabled = true;  //!< Reuse the independent slice segment header part across slices
+
+    //!
+    //! \brief  Independent slice segment header part packed for an earlier slice
+    //!
+    struct SSHPartIndependentCache
+    {
+        bool                    valid                             = false;
+        mfxU16                  nal_unit_type                     = 0;
+        mfxU8                   log2_max_pic_order_cnt_lsb_minus4 = 0;
+        mfxU8                   lists_modification_present_flag   = 0;
+        HevcSlice               slice                             = {};  //!< Slice params with the per segment fields cleared
+        std::array<mfxU8, 1024> bits                              = {};
+        mfxU32                  bitLen                            = 0;
+    } m_sshCache;
 
 public:
     HevcHeaderPacker();
@@ -537,6 +552,18 @@ public:
         PPS const &      pps,
         Slice const &    slice);
 
+    //!
+    //! \brief  Pack the independent slice segment header part, copying the bits
+    //!         packed for an earlier slice when only the slice segment address,
+    //!         first slice and dependent slice flags differ
+    //!
+    void PackSSHPartIndependentCached(
+        BitstreamWriter &bs,
+        NALU const &     nalu,
+        SPS const &      sps,
+        PPS const &      pps,
+        Slice const &    slice);
+
     void PackSSHPartNonIDR(
         BitstreamWriter &bs,
         SPS const &      sps,
@@ -449,12 +449,22 @@ namespace encode
         ENCODE_CHK_NULL_RETURN(m_slcData);
         m_numSlices = encodeParams->dwNumSlices;
         ENCODE_CHK_STATUS_RETURN(SetSequenceStructs());
+
+        // LA init clears the lookahead history, run it again for a new stream after the
+        // end of stream flush and on BRC or resolution reset. The queued records go with it.
+        ENCODE_CHK_NULL_RETURN(m_basicFeature);
+        if (m_lastPicInStream || m_hevcSeqParams->bResetBRC || m_basicFeature->m_resolutionChanged)
+        {
+            m_lookaheadInit = true;
+            m_laQueue.Reset();
+        }
         m_lastPicInStream = m_hevcPicParams->bLastPicInStream;
 
         m_hevcSliceParams = static_cast<PCODEC_HEVC_ENCODE_SLICE_PARAMS>(encodeParams->pSliceParams);
         ENCODE_CHK_STATUS_RETURN(SetupForceIntraStreamIn());
 
-        m_numValidLaRecords++;
+        m_laQueue.SetDepth(m_lookaheadDepth);
+        ENCODE_CHK_STATUS_RETURN(m_laQueue.Submit(m_hevcPicParams->StatusReportFeedbackNumber));
 
         return eStatus;
     }
@@ -471,7 +481,10 @@ namespace encode
             return eStatus;
         }
 
-        if (m_lookaheadReport && (encodeStatusMfx->lookaheadStatus.targetFrameSize > 0))
+        // The status report is parsed once its frame completed on the GPU, so the analysis
+        // retired to it is in place without waiting on the lookahead data buffer
+        bool lookaheadReport = m_laQueue.Complete(statusReportData->statusReportNumber);
+        if (lookaheadReport && (encodeStatusMfx->lookaheadStatus.targetFrameSize > 0))
         {
             statusReportData->pLookaheadStatus = &encodeStatusMfx->lookaheadStatus;
             encodeStatusMfx->lookaheadStatus.isValid = 1;
@@ -767,7 +780,7 @@ namespace encode
             return eStatus;
         }
 
-        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, m_numValidLaRecords, curPass, numPasses));
+        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, m_laQueue.GetQueuedCount(), curPass, numPasses));
 
         params.hucDataSource = m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass];
         params.dataLength = MOS_ALIGN_CEIL(m_vdencLaUpdateDmemBufferSize, CODECHAL_CACHELINE_SIZE);
@@ -887,24 +900,22 @@ namespace encode
         return m_enabled;
     }
 
-    bool VdencLplaAnalysis::IsLaRecordsEmpty()
+    MOS_STATUS VdencLplaAnalysis::FlushLaRecord()
     {
-        if (!m_numValidLaRecords)
-        {
-            return true; 
-        }
-        m_numValidLaRecords--;
-        return false;
+        ENCODE_FUNC_CALL();
+        ENCODE_CHK_NULL_RETURN(m_hevcPicParams);
+
+        return m_laQueue.Retire(m_hevcPicParams->StatusReportFeedbackNumber);
     }
 
     MOS_STATUS VdencLplaAnalysis::CalculateLaRecords(bool blastPass)
     {
         ENCODE_FUNC_CALL();
 
-        if (blastPass && m_numValidLaRecords >= m_lookaheadDepth)
+        if (blastPass && m_laQueue.IsAhead())
         {
-            m_numValidLaRecords--;
-            m_lookaheadReport = true;
+            ENCODE_CHK_NULL_RETURN(m_hevcPicParams);
+            ENCODE_CHK_STATUS_RETURN(m_laQueue.Retire(m_hevcPicParams->StatusReportFeedbackNumber));
         }
         return MOS_STATUS_SUCCESS;
     }
@@ -415,7 +415,14 @@ namespace encode
         //! \return bool
         //!         true if record is empty
         //!
-        bool IsLaRecordsEmpty();
+        bool IsLaRecordsEmpty() { return m_laQueue.GetQueuedCount() == 0; }
+
+        //!
+        //! \brief  Retire the oldest look ahead record to flush it at the end of stream
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS FlushLaRecord();
 
         //!
         //! \brief  Check if look ahead record is empty
@@ -516,8 +523,7 @@ namespace encode
         bool                       m_initDeltaQP                 = true;     //!< Initial delta QP
         uint32_t                   m_prevQpModulationStrength    = 0;        //!< Previous QP Modulation strength
         uint32_t                   m_prevTargetFrameSize         = 0;        //!< Target frame size of previous frame.
-        bool                       m_lookaheadReport             = false;    //!< Lookahead report valid flag
-        uint32_t                   m_numValidLaRecords           = 0;        //!< Number of valid lookahead records
+        EncodeLookaheadQueue       m_laQueue;                                //!< Frames in the lookahead pass, queued ones are the valid lookahead records
         uint8_t                    m_currLaDataIdx               = 0;        //!< Current lookahead data index
         mutable bool               m_lookaheadInit               = true;     //!< Lookahead init flag
         EncodeLPLA                *m_lplaHelper                  = nullptr;  //!< Lookahead helper
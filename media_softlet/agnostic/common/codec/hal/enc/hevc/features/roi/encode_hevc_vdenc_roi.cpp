@@ -49,22 +49,6 @@ HevcVdencRoi::HevcVdencRoi(
     m_basicFeature = dynamic_cast<EncodeBasicFeature *>(m_featureManager->GetFeature(FeatureIDs::basicFeature));
     ENCODE_CHK_NULL_NO_STATUS_RETURN(m_basicFeature);
 }
-MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
-{
-    // Clear streamin
-    ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-
-    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(data);
-
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
-
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
-
-    return MOS_STATUS_SUCCESS;
-}
-
 MOS_STATUS HevcVdencRoi::Init(void *setting)
 {
     ENCODE_FUNC_CALL();
@@ -159,14 +143,21 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
-        ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-
-        uint32_t lcuNumber = GetLCUNumber();
+        // One row of 64x64 LCUs, stream-in entries are in zigzag order within each of them
+        uint32_t streamInRowSize = (MOS_ALIGN_CEIL(m_basicFeature->m_frameWidth, 64) / 32) * 2 * CODECHAL_CACHELINE_SIZE;
+        ENCODE_CHK_STATUS_RETURN(m_streamInBuilder.Init(m_allocator, m_streamInSize, streamInRowSize));
+
+        // A frame with the parameters of the last upload keeps the staged data,
+        // the strategies are still prepared for the command parameters
+        m_streamInStaged = IsStreamInStaged(hevcSeqParams, hevcPicParams, hevcSlcParams);
+        if (!m_streamInStaged)
+        {
+            ENCODE_CHK_NULL_RETURN(m_streamInBuilder.BeginFrame());
 
-        ENCODE_CHK_STATUS_RETURN(ClearStreaminBuffer(lcuNumber));
+            uint32_t lcuNumber = GetLCUNumber();
 
-        m_roiOverlap.Update(lcuNumber);
+            m_roiOverlap.Update(lcuNumber);
+        }
 
         ENCODE_CHK_STATUS_RETURN(ExecuteDirtyRoi(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
@@ -186,8 +177,6 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
 
-        MOS_SafeFreeMemory(m_streamInTemp);
-
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
         ENCODE_CHK_NULL_RETURN(m_hwInterface->GetOsInterface());
@@ -214,19 +203,23 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 MOS_STATUS HevcVdencRoi::WriteStreaminData()
 {
     ENCODE_CHK_NULL_RETURN(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
-    uint8_t *streaminBuffer = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(streaminBuffer);
+    uint8_t *streamInData = m_streamInBuilder.GetData();
+    ENCODE_CHK_NULL_RETURN(streamInData);
 
-    m_roiOverlap.WriteStreaminData(
-        m_strategyFactory.GetRoi(), 
-        m_strategyFactory.GetDirtyRoi(),
-        m_streamInTemp);
+    if (!m_streamInStaged)
+    {
+        m_roiOverlap.WriteStreaminData(
+            m_strategyFactory.GetRoi(), 
+            m_strategyFactory.GetDirtyRoi(),
+            streamInData);
+    }
 
-    MOS_SecureMemcpy(streaminBuffer, m_streamInSize, m_streamInTemp, m_streamInSize);
+    // Only rows differing from what the recycled buffer holds are written
+    ENCODE_CHK_STATUS_RETURN(m_streamInBuilder.Upload(m_streamIn));
+    m_basicFeature->m_stagedUploadBytes += m_streamInBuilder.GetUploadedBytes();
+    ENCODE_VERBOSEMESSAGE("HEVC ROI stream-in: %u bytes uploaded.", m_streamInBuilder.GetUploadedBytes());
 
-    m_allocator->UnLock(m_streamIn);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -264,7 +257,7 @@ MOS_STATUS HevcVdencRoi::ExecuteRoi(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    ENCODE_CHK_STATUS_RETURN(SetupRoi(strategy));
     return MOS_STATUS_SUCCESS;
 }
 
@@ -289,7 +282,7 @@ MOS_STATUS HevcVdencRoi::ExecuteRoiExt(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    ENCODE_CHK_STATUS_RETURN(SetupRoi(strategy));
     return MOS_STATUS_SUCCESS;
 }
 
@@ -312,11 +305,117 @@ MOS_STATUS HevcVdencRoi::ExecuteDirtyRoi(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    ENCODE_CHK_STATUS_RETURN(SetupRoi(strategy));
 
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS HevcVdencRoi::SetupRoi(RoiStrategy *strategy)
+{
+    ENCODE_CHK_NULL_RETURN(strategy);
+
+    if (m_streamInStaged && !strategy->IsSetupPerFrame())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    return strategy->SetupRoi(m_roiOverlap);
+}
+
+bool HevcVdencRoi::IsStreamInStaged(
+    SeqParams *hevcSeqParams,
+    PicParams *hevcPicParams,
+    SlcParams *hevcSlcParams)
+{
+    ENCODE_FUNC_CALL();
+
+    if (m_isArbRoi || m_mbQpDataEnabled)
+    {
+        return false;
+    }
+
+    MEDIA_WA_TABLE *waTable = m_basicFeature->GetWaTable();
+    if (waTable == nullptr || m_featureManager == nullptr)
+    {
+        return false;
+    }
+    auto brcFeature = dynamic_cast<HEVCEncodeBRC *>(m_featureManager->GetFeature(HevcFeatureIDs::hevcBrcFeature));
+
+    // Everything the strategies read to build the stream-in data, the regions follow
+    struct
+    {
+        uint32_t frameWidth;
+        uint32_t frameHeight;
+        uint32_t oriFrameHeight;
+        uint8_t  codingType;
+        uint8_t  targetUsage;
+        uint8_t  minCodingBlockSize;
+        int8_t   qpY;
+        int8_t   sliceQpDelta;
+        uint8_t  roiEnabled;
+        uint8_t  dirtyRoiEnabled;
+        uint8_t  forceDeltaQpNotSupported;
+        uint8_t  hucBrc;
+        uint8_t  tilesEnabled;
+        uint8_t  numTileColumnsMinus1;
+        uint8_t  numTileRowsMinus1;
+        uint16_t tileColumnWidth[sizeof(hevcPicParams->tile_column_width) / sizeof(uint16_t)];
+        uint16_t tileRowHeight[sizeof(hevcPicParams->tile_row_height) / sizeof(uint16_t)];
+        int8_t   roiDistinctDeltaQp[sizeof(hevcPicParams->ROIDistinctDeltaQp)];
+        uint8_t  numRoi;
+        uint8_t  numDirtyRects;
+    } params;
+    MOS_ZeroMemory(&params, sizeof(params));
+
+    params.frameWidth               = m_basicFeature->m_frameWidth;
+    params.frameHeight              = m_basicFeature->m_frameHeight;
+    params.oriFrameHeight           = m_basicFeature->m_oriFrameHeight;
+    params.codingType               = hevcPicParams->CodingType;
+    params.targetUsage              = hevcSeqParams->TargetUsage;
+    params.minCodingBlockSize       = hevcSeqParams->log2_min_coding_block_size_minus3;
+    params.qpY                      = hevcPicParams->QpY;
+    params.sliceQpDelta             = hevcSlcParams->slice_qp_delta;
+    params.roiEnabled               = m_roiEnabled;
+    params.dirtyRoiEnabled          = m_dirtyRoiEnabled;
+    params.forceDeltaQpNotSupported = MEDIA_IS_WA(waTable, WaHEVCVDEncForceDeltaQpRoiNotSupported) ? 1 : 0;
+    params.hucBrc                   = (brcFeature != nullptr && brcFeature->IsVdencHucUsed()) ? 1 : 0;
+    params.tilesEnabled             = hevcPicParams->tiles_enabled_flag;
+    if (params.tilesEnabled)
+    {
+        params.numTileColumnsMinus1 = hevcPicParams->num_tile_columns_minus1;
+        params.numTileRowsMinus1    = hevcPicParams->num_tile_rows_minus1;
+        MOS_SecureMemcpy(params.tileColumnWidth, sizeof(params.tileColumnWidth), hevcPicParams->tile_column_width, sizeof(params.tileColumnWidth));
+        MOS_SecureMemcpy(params.tileRowHeight, sizeof(params.tileRowHeight), hevcPicParams->tile_row_height, sizeof(params.tileRowHeight));
+    }
+    // Taken before ExecuteRoi() sorts them, the sorted values follow from these and the regions
+    MOS_SecureMemcpy(params.roiDistinctDeltaQp, sizeof(params.roiDistinctDeltaQp), hevcPicParams->ROIDistinctDeltaQp, sizeof(params.roiDistinctDeltaQp));
+    params.numRoi        = m_roiEnabled ? MOS_MIN(hevcPicParams->NumROI, CODECHAL_ENCODE_HEVC_MAX_NUM_ROI) : 0;
+    params.numDirtyRects = m_dirtyRoiEnabled ? hevcPicParams->NumDirtyRects : 0;
+
+    if (params.numDirtyRects != 0 && hevcPicParams->pDirtyRect == nullptr)
+    {
+        return false;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)&params;
+    m_streamInParams.assign(bytes, bytes + sizeof(params));
+
+    // Regions are added field by field, the padding of CODEC_ROI is not set by the DDI
+    auto addRegions = [this](const CODEC_ROI *regions, uint32_t num) {
+        for (uint32_t i = 0; i < num; i++)
+        {
+            uint16_t rect[4] = {regions[i].Top, regions[i].Bottom, regions[i].Left, regions[i].Right};
+            const uint8_t *data = (const uint8_t *)rect;
+            m_streamInParams.insert(m_streamInParams.end(), data, data + sizeof(rect));
+            m_streamInParams.push_back((uint8_t)regions[i].PriorityLevelOrDQp);
+        }
+    };
+    addRegions(hevcPicParams->ROI, params.numRoi);
+    addRegions(hevcPicParams->pDirtyRect, params.numDirtyRects);
+
+    return m_streamInBuilder.IsStagedFor(m_streamInParams.data(), (uint32_t)m_streamInParams.size());
+}
+
 bool HevcVdencRoi::ProcessRoiDeltaQp(
     uint8_t    numROI,
     CODEC_ROI  *roiRegions,
@@ -30,6 +30,7 @@
 #include "media_feature.h"
 #include "encode_hevc_vdenc_roi_overlap.h"
 #include "encode_hevc_vdenc_roi_strategy.h"
+#include "encode_staged_buffer.h"
 #include "encode_hevc_brc.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_huc_itf.h"
@@ -182,6 +183,40 @@ protected:
 
 
 
+    //!
+    //! \brief    Check whether the staged stream-in data is the one of this frame
+    //!
+    //! \detail   The stream-in data is keyed on the parameters the strategies
+    //!           build it from. ARB and the MB QP map are never staged, their
+    //!           data depends on the frame number and a surface respectively.
+    //!
+    //! \param    [in] hevcSeqParams
+    //!           pointer of sequence parameters
+    //! \param    [in] hevcPicParams
+    //!           pointer of picture parameters
+    //! \param    [in] hevcSlcParams
+    //!           pointer of slice parameters
+    //! \return   bool
+    //!           true if the staged data is current, otherwise false
+    //!
+    bool IsStreamInStaged(
+        SeqParams *hevcSeqParams,
+        PicParams *hevcPicParams,
+        SlcParams *hevcSlcParams);
+
+    //!
+    //! \brief    Setup the ROI of a strategy
+    //!
+    //! \detail   Marking the overlap only serves the stream-in build, so it is
+    //!           skipped when the stream-in data is already staged.
+    //!
+    //! \param    [in] strategy
+    //!           ROI strategy
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SetupRoi(RoiStrategy *strategy);
+
     //!
     //! \brief    Write the Streamin data according to the overlap settings.
     //! \return   MOS_STATUS
@@ -204,13 +239,6 @@ protected:
         return (streamInWidth * streamInHeight);
     }
 
-    //!
-    //! \brief    ClearStreaminBuffer
-    //! \return   MOS_STATUS
-    //!           MOS_STATUS_SUCCESS if success, else fail reason
-    //!
-    MOS_STATUS ClearStreaminBuffer(uint32_t lucNumber);
-
     //!
     //! \brief    Get strategy for setting command parameters
     //!
@@ -243,11 +271,13 @@ protected:
     bool m_roiMode           = false;    //!< 0 Force qp mode, 1 force delta qp mode
     bool m_isArbRoiSupported = true;     //!< Whether is Adaptive Region Boost ROI Supported
 
-    PMOS_RESOURCE      m_streamIn = nullptr; //!< Stream in buffer
-    uint8_t *          m_streamInTemp = nullptr;
-    uint32_t           m_streamInSize = 0;
-    RoiStrategyFactory m_strategyFactory;    //!< Factory of strategy
-    RoiOverlap         m_roiOverlap;         //!< ROI and dirty ROI overlap
+    PMOS_RESOURCE         m_streamIn = nullptr;  //!< Stream in buffer
+    EncodeStagedBuffer m_streamInBuilder;     //!< Builds stream in data and uploads the changed rows
+    std::vector<uint8_t>  m_streamInParams;      //!< Parameters the stream in data of the frame is built from
+    bool                  m_streamInStaged = false;  //!< Stream in data of the frame is already staged
+    uint32_t              m_streamInSize = 0;
+    RoiStrategyFactory    m_strategyFactory;     //!< Factory of strategy
+    RoiOverlap            m_roiOverlap;          //!< ROI and dirty ROI overlap
 
     EncodeAllocator *m_allocator = nullptr;
     EncodeBasicFeature *m_basicFeature = nullptr;
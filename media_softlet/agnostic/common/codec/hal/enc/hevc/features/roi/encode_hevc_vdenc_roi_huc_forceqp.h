@@ -71,6 +71,9 @@ public:
 
     PMOS_RESOURCE GetStreamInBuf() const override { return m_hucRoiOutput; }
 
+    //! The delta QP buffer of the frame is written by SetupRoi()
+    bool IsSetupPerFrame() const override { return true; }
+
     //!
     //! \brief    Setup HuC BRC init/reset parameters
     //!
@@ -26,6 +26,7 @@
 
 #include "encode_hevc_vdenc_roi_strategy.h"
 #include "encode_hevc_vdenc_roi_overlap.h"
+#include "encode_staged_buffer.h"
 
 namespace encode
 {
@@ -110,25 +111,58 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
     ENCODE_CHK_NULL_RETURN(streaminBuffer);
     ENCODE_CHK_NULL_RETURN(m_overlapMap);
 
-    for (uint32_t i = 0; i < m_lcuNumber; i++)
+    const uint32_t entrySize = sizeof(HevcVdencStreamInState);
+
+    uint32_t i = 0;
+    while (i < m_lcuNumber)
     {
-        OverlapMarker marker = GetMarker(m_overlapMap[i]);
-        uint32_t      roiRegionIndex = GetRoiRegionIndex(m_overlapMap[i]);
+        uint16_t      data           = m_overlapMap[i];
+        OverlapMarker marker         = GetMarker(data);
+        uint32_t      roiRegionIndex = GetRoiRegionIndex(data);
+        RoiStrategy  *strategy       = nullptr;
 
         if (IsRoiMarker(marker))
         {
             ENCODE_CHK_NULL_RETURN(roi);
-
-            roi->WriteStreaminData(
-                i, marker, roiRegionIndex, streaminBuffer);
-
+            strategy = roi;
         }
         else if (IsDirtyRoiMarker(marker))
         {
             ENCODE_CHK_NULL_RETURN(dirtyRoi);
-            dirtyRoi->WriteStreaminData(
-                i, marker, roiRegionIndex, streaminBuffer);
+            strategy = dirtyRoi;
+        }
+        else
+        {
+            i++;
+            continue;
+        }
+
+        // LCUs sharing the same description in a row, e.g. the ROI background
+        uint32_t runEnd = i + 1;
+        while (runEnd < m_lcuNumber && m_overlapMap[runEnd] == data)
+        {
+            runEnd++;
+        }
+
+        if (strategy->IsStreaminDataPerLcu())
+        {
+            for (; i < runEnd; i++)
+            {
+                strategy->WriteStreaminData(
+                    i, marker, roiRegionIndex, streaminBuffer);
+            }
+            continue;
+        }
+
+        // Write the first LCU of the run and replicate it over the rest
+        strategy->WriteStreaminData(
+            i, marker, roiRegionIndex, streaminBuffer);
+        if (runEnd - i > 1)
+        {
+            uint8_t *entry = streaminBuffer + i * entrySize;
+            EncodeStagedBuffer::FillEntries(entry + entrySize, entry, entrySize, runEnd - i - 1);
         }
+        i = runEnd;
     }
     return MOS_STATUS_SUCCESS;
 }
@@ -45,6 +45,8 @@ namespace encode
 
         virtual ~QPMapROI() {}
 
+        bool IsStreaminDataPerLcu() const override { return true; }
+
     protected:
         //!
         //! \brief    Set the ROI ctrol mode(Native/ForceQP/MBQPMap)
@@ -64,6 +64,9 @@ MOS_STATUS RoiStrategy::PrepareParams(
     m_roiDistinctDeltaQp = hevcPicParams->ROIDistinctDeltaQp;
     ENCODE_CHK_NULL_RETURN(m_roiDistinctDeltaQp);
 
+    m_streaminParamsByTUValid[0] = false;
+    m_streaminParamsByTUValid[1] = false;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -261,6 +264,13 @@ void RoiStrategy::SetStreaminParamByTU(
     bool cu64Align,
     StreamInParams &streaminDataParams)
 {
+    // The settings only depend on frame level parameters, run them once per frame
+    if (m_streaminParamsByTUValid[cu64Align])
+    {
+        streaminDataParams = m_streaminParamsByTU[cu64Align];
+        return;
+    }
+
     MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
 
     auto settings = static_cast<HevcVdencFeatureSettings *>(m_featureManager->GetFeatureSettings()->GetConstSettings());
@@ -270,6 +280,9 @@ void RoiStrategy::SetStreaminParamByTU(
     {
         lambda(streaminDataParams, cu64Align);
     }
+
+    m_streaminParamsByTU[cu64Align]      = streaminDataParams;
+    m_streaminParamsByTUValid[cu64Align] = true;
 }
 
 void RoiStrategy::GetLCUsInRoiRegionForTile(
@@ -347,6 +360,11 @@ void RoiStrategy::GetLCUsInRoiRegion(
         return;
     }
 
+    if (bottom > top && right > left)
+    {
+        lcuVector.reserve(lcuVector.size() + (bottom - top) * (right - left));
+    }
+
     for (auto y = top; y < bottom; y++)
     {
         for (auto x = left; x < right; x++)
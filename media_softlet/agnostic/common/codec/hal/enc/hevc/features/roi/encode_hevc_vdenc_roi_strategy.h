@@ -316,6 +316,29 @@ public:
 
     void SetFeatureSetting(HevcVdencFeatureSettings *settings) { m_FeatureSettings = settings; }
 
+    //!
+    //! \brief    Whether the stream-in data of an LCU depends on its position
+    //!
+    //! \detail   If not, all LCUs with the same overlap marker and ROI region
+    //!           get the same stream-in data, which is then written once and
+    //!           replicated over runs of such LCUs.
+    //!
+    //! \return   bool
+    //!           true if the data depends on the LCU index, otherwise false
+    //!
+    virtual bool IsStreaminDataPerLcu() const { return false; }
+
+    //!
+    //! \brief    Whether SetupRoi() writes data of its own for each frame
+    //!
+    //! \detail   If not, it only marks the overlap for the stream-in build
+    //!           and is skipped when the stream-in data is already staged.
+    //!
+    //! \return   bool
+    //!           true if SetupRoi() must run for every frame, otherwise false
+    //!
+    virtual bool IsSetupPerFrame() const { return false; }
+
 protected:
     //!
     //! \brief    Calculate X/Y offsets for zigzag scan within 64 LCU
@@ -506,6 +529,9 @@ protected:
     bool     m_isTileModeEnabled  = false;
     uint32_t m_minCodingBlockSize = 0;
 
+    StreamInParams m_streaminParamsByTU[2]      = {};  //!< TU based streamin parameters of the frame, indexed by cu64Align
+    bool           m_streaminParamsByTUValid[2] = {};  //!< Whether m_streaminParamsByTU is set up for the frame
+
     EncodeAllocator *m_allocator    = nullptr;
     RecycleResource *m_recycle      = nullptr;
     HevcBasicFeature *m_basicFeature = nullptr;
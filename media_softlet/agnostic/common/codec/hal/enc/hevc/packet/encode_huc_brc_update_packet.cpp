@@ -163,6 +163,11 @@ namespace encode
             }
         }
 
+        // Constant data and DMEM are built in system memory, and only what changed
+        // since the recycled buffer was last written is uploaded to it
+        ENCODE_CHK_STATUS_RETURN(m_constDataStaging.Init(m_allocator, m_vdencBrcConstDataBufferSize, CODECHAL_CACHELINE_SIZE));
+        ENCODE_CHK_STATUS_RETURN(m_updateDmemStaging.Init(m_allocator, m_vdencBrcUpdateDmemBufferSize, CODECHAL_CACHELINE_SIZE));
+
         return MOS_STATUS_SUCCESS;
     }
 
@@ -533,15 +538,16 @@ namespace encode
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
         // Program update DMEM
-        auto hucVdencBrcUpdateDmem =
-            (VdencHevcHucBrcUpdateDmem *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
+        auto hucVdencBrcUpdateDmem = (VdencHevcHucBrcUpdateDmem *)m_updateDmemStaging.BeginFrame();
         ENCODE_CHK_NULL_RETURN(hucVdencBrcUpdateDmem);
-        MOS_ZeroMemory(hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
 
         const_cast<HucBrcUpdatePkt* const>(this)->SetCommonDmemBuffer(hucVdencBrcUpdateDmem);
         SetExtDmemBuffer(hucVdencBrcUpdateDmem);
 
-        m_allocator->UnLock(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
+        ENCODE_CHK_STATUS_RETURN(m_updateDmemStaging.Upload(
+            const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()])));
+        m_basicFeature->m_stagedUploadBytes += m_updateDmemStaging.GetUploadedBytes();
+        ENCODE_VERBOSEMESSAGE("HEVC BRC update DMEM: %u bytes uploaded.", m_updateDmemStaging.GetUploadedBytes());
 
         return MOS_STATUS_SUCCESS;
     }
@@ -564,7 +570,7 @@ namespace encode
 
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
-        auto hucConstData = (VdencHevcHucBrcConstantData *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE*>(&m_vdencBrcConstDataBuffer[m_pipeline->m_currRecycledBufIdx]));
+        auto hucConstData = (VdencHevcHucBrcConstantData *)m_constDataStaging.BeginFrame();
         ENCODE_CHK_NULL_RETURN(hucConstData);
 
         ENCODE_CHK_STATUS_RETURN(SetConstLambdaHucBrcUpdate(hucConstData));
@@ -642,7 +648,9 @@ namespace encode
             currentLocation = baseLocation;
         }
 
-        m_allocator->UnLock(const_cast<MOS_RESOURCE*>(&m_vdencBrcConstDataBuffer[m_pipeline->m_currRecycledBufIdx]));
+        ENCODE_CHK_STATUS_RETURN(m_constDataStaging.Upload(const_cast<MOS_RESOURCE*>(&m_vdencBrcConstDataBuffer[m_pipeline->m_currRecycledBufIdx])));
+        m_basicFeature->m_stagedUploadBytes += m_constDataStaging.GetUploadedBytes();
+        ENCODE_VERBOSEMESSAGE("HEVC BRC constant data: %u bytes uploaded.", m_constDataStaging.GetUploadedBytes());
 
         return eStatus;
     }
@@ -34,6 +34,7 @@
 #include "encode_utils.h"
 #include "encode_hevc_vdenc_pipeline.h"
 #include "encode_hevc_basic_feature.h"
+#include "encode_staged_buffer.h"
 #if _ENCODE_RESERVED
 #include "encode_huc_brc_update_packet_ext.h"
 #endif // _ENCODE_RESERVED
@@ -263,6 +264,8 @@ namespace encode
         MOS_RESOURCE                            m_dataFromPicsBuffer = {}; //!< Data Buffer of Current and Reference Pictures for Weighted Prediction
         uint32_t                                m_vdenc2ndLevelBatchBufferSize[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = { 0 };
         MOS_RESOURCE                            m_vdencBrcUpdateDmemBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM][VDENC_BRC_NUM_OF_PASSES] = { 0 };  //!< VDEnc BrcUpdate DMEM buffer
+        mutable EncodeStagedBuffer              m_constDataStaging;                                //!< Staged brc constant data
+        mutable EncodeStagedBuffer              m_updateDmemStaging;                               //!< Staged BrcUpdate DMEM
 
         mutable uint32_t                        m_1stPakInsertObjectCmdSize = 0;                   //!< Size of 1st PAK_INSERT_OBJ cmd
         mutable uint32_t                        m_hcpWeightOffsetStateCmdSize   = 0;               //!< Size of HCP_WEIGHT_OFFSET_STATE cmd
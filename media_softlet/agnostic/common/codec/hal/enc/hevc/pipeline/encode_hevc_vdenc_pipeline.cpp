@@ -126,6 +126,7 @@ MOS_STATUS HevcVdencPipeline::ActivateVdencVideoPackets()
                 // Flush the last frames
                 while (!laAnalysisFeature->IsLaRecordsEmpty())
                 {
+                    ENCODE_CHK_STATUS_RETURN(laAnalysisFeature->FlushLaRecord());
                     ENCODE_CHK_STATUS_RETURN(ActivatePacket(HucLaUpdate, immediateSubmit, curPass, 0));
                 }
             }
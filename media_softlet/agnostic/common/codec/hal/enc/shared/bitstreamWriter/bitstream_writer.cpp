@@ -22,6 +22,7 @@
 
 #include "bitstream_writer.h"
 #include <assert.h>
+#include <string.h>
 
 BitstreamWriter::BitstreamWriter(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
     : m_bsStart(bs), m_bsEnd(bs + size), m_bs(bs), m_bitStart(bitOffset & 7), m_bitOffset(bitOffset & 7), m_codILow(0)  // cabac variables
@@ -65,7 +66,45 @@ void BitstreamWriter::Reset(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
 }
 
 void BitstreamWriter::PutBitsBuffer(mfxU32 n, void *bb, mfxU32 o)
-{}
+{
+    mfxU8 *b = (mfxU8 *)bb + (o >> 3);
+    mfxU32 N = 0;
+
+    o &= 7;
+
+    // leading bits up to the source byte boundary
+    if (o && n)
+    {
+        N = (n < 8 - o) ? n : (8 - o);
+        PutBits(N, b[0] >> (8 - o - N));
+        n -= N;
+        b++;
+    }
+
+    if (!m_bitOffset)
+    {
+        N = n >> 3;
+        memcpy(m_bs, b, N);
+        m_bs += N;
+        b += N;
+        n &= 7;
+    }
+    else
+    {
+        for (; n >= 16; n -= 16, b += 2)
+            PutBits(16, (b[0] << 8) | b[1]);
+
+        if (n >= 8)
+        {
+            PutBits(8, b[0]);
+            n -= 8;
+            b++;
+        }
+    }
+
+    if (n)
+        PutBits(n, b[0] >> (8 - n));
+}
 
 void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
 {
@@ -173,6 +173,10 @@ public:
     {
         m_pInfo = pInfo;
     }
+    bool HasInfo() const
+    {
+        return m_pInfo != nullptr;
+    }
 
 private:
     void   RenormE();
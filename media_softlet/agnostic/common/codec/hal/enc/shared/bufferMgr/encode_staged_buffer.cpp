@@ -0,0 +1,252 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_staged_buffer.cpp
+//! \brief    Defines the staging of driver generated buffer data in system memory
+//! \details  Data such as VDEnc stream-in or HuC DMEM is built in system memory
+//!           and only the rows which differ from the content of the target
+//!           buffer are written
+//!
+
+#include "encode_staged_buffer.h"
+#include "encode_allocator.h"
+#include "encode_utils.h"
+#include "mos_utilities.h"
+
+namespace encode
+{
+EncodeStagedBuffer::~EncodeStagedBuffer()
+{
+    Release();
+}
+
+void EncodeStagedBuffer::Release()
+{
+    MOS_FreeMemory(m_data);
+    MOS_FreeMemory(m_prevData);
+    m_data     = nullptr;
+    m_prevData = nullptr;
+    m_size     = 0;
+    m_rowSize  = 0;
+    m_rowNum   = 0;
+    m_version  = 0;
+    m_isStaged = false;
+    m_rowVersions.clear();
+    m_buffers.clear();
+    m_params.clear();
+    m_frameParams.clear();
+}
+
+MOS_STATUS EncodeStagedBuffer::Init(EncodeAllocator *allocator, uint32_t size, uint32_t rowSize)
+{
+    ENCODE_FUNC_CALL();
+    ENCODE_CHK_NULL_RETURN(allocator);
+
+    if (size == 0 || rowSize == 0)
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    m_allocator = allocator;
+
+    if (m_data != nullptr && m_size == size && m_rowSize == rowSize)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    // Layout changed, the target buffers may have been reallocated as well
+    Release();
+
+    m_data     = (uint8_t *)MOS_AllocAndZeroMemory(size);
+    m_prevData = (uint8_t *)MOS_AllocAndZeroMemory(size);
+    if (m_data == nullptr || m_prevData == nullptr)
+    {
+        Release();
+        return MOS_STATUS_NO_SPACE;
+    }
+
+    m_size    = size;
+    m_rowSize = rowSize;
+    m_rowNum  = (size + rowSize - 1) / rowSize;
+    m_rowVersions.assign(m_rowNum, 0);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+uint8_t *EncodeStagedBuffer::BeginFrame()
+{
+    ENCODE_FUNC_CALL();
+
+    // The data is rebuilt, it matches no parameters until uploaded
+    m_isStaged = false;
+    m_params.clear();
+    if (m_data != nullptr)
+    {
+        MOS_ZeroMemory(m_data, m_size);
+    }
+    return m_data;
+}
+
+bool EncodeStagedBuffer::IsStagedFor(const void *params, uint32_t size)
+{
+    ENCODE_FUNC_CALL();
+
+    m_isStaged = false;
+    if (params == nullptr || size == 0 || m_data == nullptr)
+    {
+        m_frameParams.clear();
+        return false;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)params;
+    m_frameParams.assign(bytes, bytes + size);
+
+    // The parameters become those of the staged data only once uploaded, so a
+    // frame whose build was abandoned half way is never taken as current
+    m_isStaged = m_version != 0 && m_frameParams == m_params;
+    return m_isStaged;
+}
+
+MOS_STATUS EncodeStagedBuffer::Upload(PMOS_RESOURCE resource)
+{
+    ENCODE_FUNC_CALL();
+    ENCODE_CHK_NULL_RETURN(m_allocator);
+    ENCODE_CHK_NULL_RETURN(m_data);
+    ENCODE_CHK_NULL_RETURN(resource);
+
+    m_uploadedBytes = 0;
+
+    // Bump the version for the rows which differ from the last upload, no row
+    // can differ when the data was built from the parameters of the last upload
+    bool changed = false;
+    for (uint32_t row = 0; row < m_rowNum && !m_isStaged; row++)
+    {
+        uint32_t offset = row * m_rowSize;
+        uint32_t size   = MOS_MIN(m_rowSize, m_size - offset);
+
+        if (m_version == 0 || memcmp(m_data + offset, m_prevData + offset, size) != 0)
+        {
+            if (!changed)
+            {
+                m_version++;
+                changed = true;
+            }
+            m_rowVersions[row] = m_version;
+            MOS_SecureMemcpy(m_prevData + offset, size, m_data + offset, size);
+        }
+    }
+
+    // The parameters are consumed, a frame which does not set them is unknown
+    m_params.swap(m_frameParams);
+    m_frameParams.clear();
+    m_isStaged = false;
+
+    BufferVersion *buffer = nullptr;
+    for (auto &entry : m_buffers)
+    {
+        if (entry.resource == resource)
+        {
+            buffer = &entry;
+            break;
+        }
+    }
+    if (buffer == nullptr)
+    {
+        m_buffers.push_back({resource, resource->pGmmResInfo, 0});
+        buffer = &m_buffers.back();
+    }
+    else if (buffer->gmmResInfo != resource->pGmmResInfo)
+    {
+        // Reallocated at the same address, the content is unknown
+        buffer->gmmResInfo = resource->pGmmResInfo;
+        buffer->version    = 0;
+    }
+
+    // The buffer already holds the data of this frame
+    if (buffer->version == m_version)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint8_t *dst = (uint8_t *)m_allocator->LockResourceForWrite(resource);
+    ENCODE_CHK_NULL_RETURN(dst);
+
+    // Write out of date rows, merging adjacent rows into one copy
+    uint32_t row = 0;
+    while (row < m_rowNum)
+    {
+        if (buffer->version != 0 && m_rowVersions[row] <= buffer->version)
+        {
+            row++;
+            continue;
+        }
+
+        uint32_t firstRow = row;
+        while (row < m_rowNum && (buffer->version == 0 || m_rowVersions[row] > buffer->version))
+        {
+            row++;
+        }
+
+        uint32_t offset = firstRow * m_rowSize;
+        uint32_t size   = MOS_MIN(row * m_rowSize, m_size) - offset;
+        MOS_SecureMemcpy(dst + offset, size, m_data + offset, size);
+        m_uploadedBytes += size;
+    }
+
+    buffer->version = m_version;
+
+    return m_allocator->UnLock(resource);
+}
+
+void EncodeStagedBuffer::Invalidate(PMOS_RESOURCE resource)
+{
+    for (auto &entry : m_buffers)
+    {
+        if (entry.resource == resource)
+        {
+            entry.version = 0;
+            return;
+        }
+    }
+}
+
+void EncodeStagedBuffer::FillEntries(void *dst, const void *entry, uint32_t entrySize, uint32_t count)
+{
+    if (dst == nullptr || entry == nullptr || entrySize == 0 || count == 0)
+    {
+        return;
+    }
+
+    // Copy the template once, then double the filled span with each copy so a
+    // span of N entries takes log2(N) wide memcpy stores instead of N field writes
+    uint8_t *data   = (uint8_t *)dst;
+    uint32_t filled = 1;
+    MOS_SecureMemcpy(data, entrySize, entry, entrySize);
+
+    while (filled < count)
+    {
+        uint32_t num = MOS_MIN(filled, count - filled);
+        MOS_SecureMemcpy(data + filled * entrySize, num * entrySize, data, num * entrySize);
+        filled += num;
+    }
+}
+}  // namespace encode
@@ -0,0 +1,186 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_staged_buffer.h
+//! \brief    Defines the staging of driver generated buffer data in system memory
+//! \details  Data such as VDEnc stream-in or HuC DMEM is built in system memory
+//!           and only the rows which differ from the content of the target
+//!           buffer are written
+//!
+
+#ifndef __ENCODE_STAGED_BUFFER_H__
+#define __ENCODE_STAGED_BUFFER_H__
+
+#include "media_class_trace.h"
+#include "mos_defs.h"
+#include "mos_os.h"
+#include <stdint.h>
+#include <vector>
+
+namespace encode
+{
+class EncodeAllocator;
+
+//!
+//! \class    EncodeStagedBuffer
+//!
+//! \brief    Stages buffer data in system memory and uploads it incrementally.
+//!
+//! \detail   Features write the data of a frame into the system memory
+//!           returned by BeginFrame(). Upload() compares it row by row with
+//!           the data uploaded before and keeps a version per row. Target
+//!           buffers rotate through recycled slots, so each buffer remembers
+//!           the version it holds: rows changed since then are rewritten, and
+//!           the lock is skipped entirely when the buffer is already up to date.
+//!           A feature which builds its data from frame parameters checks them
+//!           with IsStagedFor() first, and skips both the build and the row
+//!           comparison when they match the parameters of the last upload.
+//!           A buffer is recognized by its resource and its GMM resource info,
+//!           so a buffer reallocated at the same address is written in full.
+//!
+class EncodeStagedBuffer
+{
+public:
+    EncodeStagedBuffer() = default;
+
+    ~EncodeStagedBuffer();
+
+    //!
+    //! \brief  Set up the staging for the data layout of the sequence
+    //!
+    //! \param  [in] allocator
+    //!         Encode allocator used to lock the target buffers
+    //! \param  [in] size
+    //!         Size in bytes of the data
+    //! \param  [in] rowSize
+    //!         Size in bytes of one row, the unit of comparison and upload
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Init(EncodeAllocator *allocator, uint32_t size, uint32_t rowSize);
+
+    //!
+    //! \brief  Start the data of a new frame
+    //!
+    //! \return uint8_t *
+    //!         Zeroed data of the frame, nullptr if not initialized
+    //!
+    uint8_t *BeginFrame();
+
+    //!
+    //! \brief  Check whether the staged data was built from these parameters
+    //! \details The parameters are kept as the ones of the current frame. If
+    //!          they match those of the last upload, the staged data is current
+    //!          and the caller skips BeginFrame() and the build; Upload() then
+    //!          only brings the target buffer up to date.
+    //!
+    //! \param  [in] params
+    //!         Everything the caller builds the data from
+    //! \param  [in] size
+    //!         Size in bytes of the parameters
+    //! \return bool
+    //!         true if the staged data is current, otherwise false
+    //!
+    bool IsStagedFor(const void *params, uint32_t size);
+
+    //!
+    //! \brief  Get the data of the current frame
+    //!
+    //! \return uint8_t *
+    //!         Staged data
+    //!
+    uint8_t *GetData() const { return m_data; }
+
+    //!
+    //! \brief  Write the rows of the target buffer which are out of date
+    //!
+    //! \param  [in] resource
+    //!         Target buffer used by the current frame
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Upload(PMOS_RESOURCE resource);
+
+    //!
+    //! \brief  Forget the content of a target buffer
+    //! \details Must be called when the buffer is written by anything else than
+    //!          Upload(), e.g. by a HuC kernel.
+    //!
+    //! \param  [in] resource
+    //!         Target buffer
+    //! \return void
+    //!
+    void Invalidate(PMOS_RESOURCE resource);
+
+    //!
+    //! \brief  Fill consecutive entries with copies of one entry
+    //!
+    //! \param  [out] dst
+    //!         First entry to fill
+    //! \param  [in] entry
+    //!         Template entry
+    //! \param  [in] entrySize
+    //!         Size in bytes of one entry
+    //! \param  [in] count
+    //!         Number of entries to fill
+    //! \return void
+    //!
+    static void FillEntries(void *dst, const void *entry, uint32_t entrySize, uint32_t count);
+
+    uint32_t GetUploadedBytes() const { return m_uploadedBytes; }  //!< Bytes written by the last Upload()
+
+protected:
+    //!
+    //! \brief  Target buffer and the data version it holds
+    //!
+    struct BufferVersion
+    {
+        PMOS_RESOURCE      resource;
+        GMM_RESOURCE_INFO *gmmResInfo;  //!< Tells a reallocated buffer from the one versioned
+        uint32_t           version;
+    };
+
+    //!
+    //! \brief  Release system memory and forget all buffers
+    //!
+    void Release();
+
+    EncodeAllocator *m_allocator = nullptr;  //!< Encode allocator
+
+    uint8_t *m_data     = nullptr;  //!< Data of the current frame
+    uint8_t *m_prevData = nullptr;  //!< Data of the last upload
+    uint32_t m_size     = 0;        //!< Size of the data
+    uint32_t m_rowSize  = 0;        //!< Size of one row
+    uint32_t m_rowNum   = 0;        //!< Number of rows
+
+    uint32_t                   m_version       = 0;  //!< Data version, 0 means nothing uploaded yet
+    std::vector<uint32_t>      m_rowVersions;        //!< Version in which each row last changed
+    std::vector<BufferVersion> m_buffers;            //!< Versions held by the target buffers
+    std::vector<uint8_t>       m_params;             //!< Parameters of the last upload, empty if unknown
+    std::vector<uint8_t>       m_frameParams;        //!< Parameters of the current frame
+    bool                       m_isStaged      = false;  //!< Staged data matches the current frame parameters
+    uint32_t                   m_uploadedBytes = 0;  //!< Bytes written by the last upload
+
+MEDIA_CLASS_DEFINE_END(encode__EncodeStagedBuffer)
+};
+}  // namespace encode
+#endif  // !__ENCODE_STAGED_BUFFER_H__
@@ -26,6 +26,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_queue.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_slot.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_allocator.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/encode_staged_buffer.cpp
 )
 
 set(TMP_HEADERS_
@@ -35,6 +36,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_queue.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_slot.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_allocator.h
+    ${CMAKE_CURRENT_LIST_DIR}/encode_staged_buffer.h
 )
 
 set(SOFTLET_ENCODE_COMMON_HEADERS_
@@ -112,6 +112,7 @@ MOS_STATUS EncodeBasicFeature::Update(void *params)
     m_newQmatrixData        = encodeParams->bNewQmatrixData;   // used by AVC and MPEG2
     m_numSlices             = encodeParams->dwNumSlices;       // used by all except VP9
     m_slcData               = (PCODEC_ENCODER_SLCDATA)(encodeParams->pSlcHeaderData);// used by AVC, MPEG2, and HEVC
+    m_stagedUploadBytes     = 0;
 
     ENCODE_CHK_NULL_RETURN(encodeParams->psRawSurface);
     m_rawSurface           = *(encodeParams->psRawSurface);           // used by all
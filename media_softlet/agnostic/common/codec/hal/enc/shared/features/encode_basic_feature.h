@@ -159,6 +159,7 @@ public:
     BSBuffer                    m_bsBuffer = {};                   //!< Bit-stream buffer
 
     uint32_t                    m_bitstreamSize = 0;               //!< Maximum amount of data to be output to presBitstreamBuffer.
+    uint32_t                    m_stagedUploadBytes = 0;           //!< Bytes written by staged uploads for the current frame, see EncodeStagedBuffer
     bool                        m_mbQpDataEnabled = false;         //!< [AVC & MPEG2] Indicates that psMbQpDataSurface is present.
     bool                        m_mbDisableSkipMapEnabled = false; //!< [AVC] Indicates that psMbDisableSkipMapSurface is present.
     MOS_SURFACE                 m_mbDisableSkipMapSurface = {};    //!< [AVC] MB disable skip map provided by framework
@@ -108,4 +108,73 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
+    void EncodeLookaheadQueue::SetDepth(uint32_t depth)
+    {
+        uint32_t maxDepth = m_maxDepth;
+        m_depth           = MOS_CLAMP_MIN_MAX(depth, 1, maxDepth);
+    }
+
+    void EncodeLookaheadQueue::Reset()
+    {
+        m_tail = m_retired;
+    }
+
+    MOS_STATUS EncodeLookaheadQueue::Submit(uint32_t frameNum)
+    {
+        ENCODE_FUNC_CALL();
+
+        ENCODE_CHK_COND_RETURN(GetQueuedCount() >= m_capacity, "Lookahead queue is full");
+
+        if (m_tail - m_head >= m_capacity)
+        {
+            // The status report of the oldest retired frame was never parsed, the
+            // application does not read lookahead results that far behind
+            ENCODE_VERBOSEMESSAGE("Lookahead result of frame %u dropped", m_frames[m_head % m_capacity].frameNum);
+            m_head++;
+        }
+
+        Frame &frame      = m_frames[m_tail % m_capacity];
+        frame.frameNum    = frameNum;
+        frame.submitIndex = m_submitted++;
+        m_tail++;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS EncodeLookaheadQueue::Retire(uint32_t statusReportNum)
+    {
+        ENCODE_FUNC_CALL();
+
+        ENCODE_CHK_COND_RETURN(GetQueuedCount() == 0, "No queued frame to retire");
+
+        m_frames[m_retired % m_capacity].statusReportNum = statusReportNum;
+        m_retired++;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    bool EncodeLookaheadQueue::Complete(uint32_t statusReportNum)
+    {
+        // Status reports are parsed in submission order, so only the newest frame
+        // retired to this status report has its analysis left in it
+        uint32_t last = m_retired;
+        for (uint32_t i = m_head; i != m_retired; i++)
+        {
+            if (m_frames[i % m_capacity].statusReportNum == statusReportNum)
+            {
+                last = i;
+            }
+        }
+
+        if (last == m_retired)
+        {
+            return false;
+        }
+
+        m_lastLatency = m_submitted - m_frames[last % m_capacity].submitIndex;
+        m_head        = last + 1;
+
+        return true;
+    }
+
 } // encode
@@ -105,6 +105,109 @@ namespace encode
 
     MEDIA_CLASS_DEFINE_END(encode__EncodeLPLA)
     };
+
+    //!
+    //! \class   EncodeLookaheadQueue
+    //! \brief   Bookkeeping of the lookahead records of the lookahead pass
+    //! \details The lookahead pass is the application's bLookAheadPhase encoder instance, this
+    //!          class does not run or schedule it. It tracks which frames have a record in the
+    //!          HuC lookahead stats and data buffers and which status report carries the
+    //!          analysis of each frame. A frame is queued when it enters the pass. Once depth
+    //!          frames are queued, every lookahead update retires the oldest one: its analysis
+    //!          is written by HuC into the status report of the frame submitted with that
+    //!          update. The frame completes when that status report is parsed, i.e. after its
+    //!          GPU fence has signalled, so nothing blocks on the analysis buffers.
+    //!
+    class EncodeLookaheadQueue
+    {
+    public:
+        static constexpr uint32_t m_maxDepth = 128;  //!< Number of entries in the lookahead stats and data buffers
+
+        //!
+        //! \brief  Set the number of frames the lookahead pass runs ahead
+        //! \param  [in] depth
+        //!         Lookahead depth in frames, clamped to [1, m_maxDepth]
+        //!
+        void SetDepth(uint32_t depth);
+
+        //!
+        //! \brief  Drop the queued frames when lookahead init clears their records
+        //! \details Retired frames are kept, their analysis is already in the status
+        //!          reports submitted before the reset.
+        //!
+        void Reset();
+
+        //!
+        //! \brief  Queue a frame entering the lookahead pass
+        //! \param  [in] frameNum
+        //!         Status report number of the frame
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS Submit(uint32_t frameNum);
+
+        //!
+        //! \brief  Retire the oldest queued frame to a lookahead update
+        //! \param  [in] statusReportNum
+        //!         Status report number the analysis of the frame is written to
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS Retire(uint32_t statusReportNum);
+
+        //!
+        //! \brief  Complete the frames whose analysis was written to a status report
+        //! \details Frames retired to older status reports that were never parsed are
+        //!          completed as well, without a result.
+        //! \param  [in] statusReportNum
+        //!         Status report number being parsed
+        //! \return bool
+        //!         true if the status report carries a lookahead result
+        //!
+        bool Complete(uint32_t statusReportNum);
+
+        //!
+        //! \brief  Check if the lookahead pass is depth frames ahead, so an update has a result to produce
+        //!
+        bool IsAhead() const { return GetQueuedCount() >= m_depth; }
+
+        uint32_t GetDepth() const { return m_depth; }
+
+        //!
+        //! \brief  Frames submitted to the lookahead pass and not retired yet
+        //!
+        uint32_t GetQueuedCount() const { return m_tail - m_retired; }
+
+        //!
+        //! \brief  Frames retired whose status report was not parsed yet
+        //!
+        uint32_t GetPendingCount() const { return m_retired - m_head; }
+
+        //!
+        //! \brief  Frames submitted after the last completed one when it was submitted, i.e. lookahead latency in frames
+        //!
+        uint32_t GetLastLatency() const { return m_lastLatency; }
+
+    protected:
+        struct Frame
+        {
+            uint32_t frameNum        = 0;  //!< Status report number of the frame
+            uint32_t statusReportNum = 0;  //!< Status report number carrying its analysis, valid once retired
+            uint32_t submitIndex     = 0;  //!< Value of m_submitted when the frame was submitted
+        };
+
+        static constexpr uint32_t m_capacity = 2 * m_maxDepth;  //!< Queued frames plus retired frames in flight
+
+        Frame    m_frames[m_capacity];
+        uint32_t m_head        = 0;  //!< Oldest retired frame not completed
+        uint32_t m_retired     = 0;  //!< Oldest queued frame not retired
+        uint32_t m_tail        = 0;  //!< Next frame to submit
+        uint32_t m_submitted   = 0;  //!< Frames submitted, including the ones dropped by Reset
+        uint32_t m_depth       = 1;  //!< Lookahead depth in frames
+        uint32_t m_lastLatency = 0;
+
+    MEDIA_CLASS_DEFINE_END(encode__EncodeLookaheadQueue)
+    };
 } // encode
 
 #endif
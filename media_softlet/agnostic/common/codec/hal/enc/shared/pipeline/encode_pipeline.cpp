@@ -316,6 +316,20 @@ MOS_STATUS EncodePipeline::ExecuteActivePackets()
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS EncodePipeline::ReportStagedUploads()
+{
+    ENCODE_FUNC_CALL();
+
+    auto basicFeature = dynamic_cast<EncodeBasicFeature *>(m_featureManager->GetFeature(FeatureIDs::basicFeature));
+    ENCODE_CHK_NULL_RETURN(basicFeature);
+    auto statusReport = dynamic_cast<EncoderStatusReport *>(m_statusReport);
+    ENCODE_CHK_NULL_RETURN(statusReport);
+
+    statusReport->SetStagedUploadBytes(basicFeature->m_stagedUploadBytes);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS EncodePipeline::ExecuteResolveMetaData(PMOS_RESOURCE pInput, PMOS_RESOURCE pOutput)
 {
     ENCODE_FUNC_CALL();
@@ -185,6 +185,15 @@ protected:
     //!
     MOS_STATUS ExecuteActivePackets() override;
 
+    //!
+    //! \brief  Report the bytes of the staged uploads of the frame
+    //! \details Called once the frame is submitted, before the status report
+    //!          moves on to the next frame.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ReportStagedUploads();
+
     //! \brief  Calculate Command Size for all packets in active packets list
     //!
     //! \param  [in, out] commandBufferSize
@@ -255,6 +255,11 @@ namespace encode {
         return eStatus;
     }
 
+    void EncoderStatusReport::SetStagedUploadBytes(uint32_t bytes)
+    {
+        m_statusReportData[CounterToIndex(m_submittedCount)].stagedUploadBytes = bytes;
+    }
+
     PMOS_RESOURCE EncoderStatusReport::GetHwCtrBuf()
     {
         return m_hwcounterBuf;
@@ -277,6 +277,8 @@ namespace encode {
         uint32_t                        av1EnableFrameOBU;
         uint32_t                        frameWidth;
         uint32_t                        frameHeight;
+
+        uint32_t                        stagedUploadBytes;      //!< Bytes of driver built data (stream-in, HuC BRC constant data and DMEM) written for the frame
     };
 
     class EncoderStatusReport : public MediaStatusReport
@@ -331,6 +333,15 @@ namespace encode {
         //!
         virtual MOS_STATUS Reset() override;
 
+        //!
+        //! \brief  Set the bytes written by staged uploads for the submitted frame
+        //!
+        //! \param  [in] bytes
+        //!         Bytes written to GPU buffers from staged data
+        //! \return void
+        //!
+        void SetStagedUploadBytes(uint32_t bytes);
+
         virtual PMOS_RESOURCE GetHwCtrBuf();
 
     protected:
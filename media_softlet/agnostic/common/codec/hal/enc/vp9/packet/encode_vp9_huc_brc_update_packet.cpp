@@ -185,19 +185,23 @@ MOS_STATUS Vp9HucBrcUpdatePkt::AllocateResources()
         }
     }
 
+    // DMEM is built in system memory, only what changed since the recycled buffer was last written is uploaded
+    ENCODE_CHK_STATUS_RETURN(m_updateDmemStaging.Init(m_allocator, sizeof(HucBrcUpdateDmem), CODECHAL_CACHELINE_SIZE));
+
     return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS Vp9HucBrcUpdatePkt::SetDmemBuffer() const
 {
     ENCODE_FUNC_CALL();
+    ENCODE_CHK_NULL_RETURN(m_basicFeature);
 
     auto brcFeature = dynamic_cast<Vp9EncodeBrc *>(m_featureManager->GetFeature(Vp9FeatureIDs::vp9BrcFeature));
     ENCODE_CHK_NULL_RETURN(brcFeature);
 
     // Setup BRC DMEM
     auto              currPass = m_pipeline->GetCurrentPass();
-    HucBrcUpdateDmem *dmem     = (HucBrcUpdateDmem *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE *>(&m_resVdencBrcUpdateDmemBuffer[currPass][m_pipeline->m_currRecycledBufIdx]));
+    HucBrcUpdateDmem *dmem     = (HucBrcUpdateDmem *)m_updateDmemStaging.BeginFrame();
     ENCODE_CHK_NULL_RETURN(dmem);
 
     MOS_SecureMemcpy(dmem, sizeof(HucBrcUpdateDmem), m_brcUpdateDmem, sizeof(m_brcUpdateDmem));
@@ -209,7 +213,9 @@ MOS_STATUS Vp9HucBrcUpdatePkt::SetDmemBuffer() const
     dmem->UPD_MaxNumPAKs_U8 = m_pipeline->GetPassNum() - 1;
     dmem->UPD_PAKPassNum_U8 = (uint8_t)currPass;
 
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(const_cast<MOS_RESOURCE *>(&m_resVdencBrcUpdateDmemBuffer[currPass][m_pipeline->m_currRecycledBufIdx])));
+    ENCODE_CHK_STATUS_RETURN(m_updateDmemStaging.Upload(const_cast<MOS_RESOURCE *>(&m_resVdencBrcUpdateDmemBuffer[currPass][m_pipeline->m_currRecycledBufIdx])));
+    m_basicFeature->m_stagedUploadBytes += m_updateDmemStaging.GetUploadedBytes();
+    ENCODE_VERBOSEMESSAGE("VP9 BRC update DMEM: %u bytes uploaded.", m_updateDmemStaging.GetUploadedBytes());
 
     return MOS_STATUS_SUCCESS;
 }
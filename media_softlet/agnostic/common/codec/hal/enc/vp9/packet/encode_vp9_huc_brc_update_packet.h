@@ -35,6 +35,7 @@
 #include "encode_utils.h"
 #include "encode_vp9_vdenc_pipeline.h"
 #include "encode_vp9_basic_feature.h"
+#include "encode_staged_buffer.h"
 
 namespace encode
 {
@@ -134,6 +135,7 @@ protected:
     static const uint32_t m_brcUpdateDmem[64];
 
     MOS_RESOURCE     m_resVdencBrcUpdateDmemBuffer[3][CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {};       //!< VDENC BRC/Update DMEM buffer
+    mutable EncodeStagedBuffer m_updateDmemStaging;                                                        //!< Staged BRC/Update DMEM
     Vp9BasicFeature *m_basicFeature                   = nullptr;  //!< VP9 Basic Feature used in each frame
 
 MEDIA_CLASS_DEFINE_END(encode__Vp9HucBrcUpdatePkt)
@@ -1719,6 +1719,23 @@ public:
         MOS_STREAM_HANDLE streamState,
         GPU_CONTEXT_HANDLE gpuContext);
 
+    //!
+    //! \brief   Get Gpu Busy Command Buffer Count
+    //! \details Number of command buffers submitted to the GPU context which
+    //!          the GPU has not completed yet
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //! \param    [in] gpuContext
+    //!           MOS GPU Context handle
+    //!
+    //! \return   uint32_t
+    //!           Busy command buffer count, 0 if failed to get the GPU context
+    //!
+    static uint32_t GetGpuBusyCmdBufferCount(
+        MOS_STREAM_HANDLE  streamState,
+        GPU_CONTEXT_HANDLE gpuContext);
+
     //!
     //! \brief   Increment Gpu Status Tag
     //!
@@ -2310,6 +2327,18 @@ public:
 
     static uint64_t GetResourceHandle(MOS_STREAM_HANDLE streamState, PMOS_RESOURCE osResource);
 
+    //!
+    //! \brief   Check if resource is in use by GPU
+    //! \details Does not wait, a lock of a busy resource would stall until GPU is done with it.
+    //! \param   [in] streamState
+    //!          Handle of Os Stream State
+    //! \param   [in] osResource
+    //!          Pointer to OS Resource
+    //! \return  bool
+    //!          true if resource is busy, otherwise false
+    //!
+    static bool IsResourceBusy(MOS_STREAM_HANDLE streamState, PMOS_RESOURCE osResource);
+
 private:
     //!
     //! \brief    Init per stream parameters
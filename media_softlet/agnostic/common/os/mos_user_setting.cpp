@@ -212,6 +212,15 @@ MOS_STATUS MosUserSetting::InitMosCommonUserSetting(MediaUserSettingSharedPtr us
         true,
         USER_SETTING_CONFIG_PERF_PATH); //"Perf Profiler Output File Name."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_TIMELINE_FILE_NAME,
+        MediaUserSetting::Group::Device,
+        std::string(),
+        true,
+        true,
+        USER_SETTING_CONFIG_PERF_PATH); //"Perf Profiler streaming timeline file, empty to disable."
+
     DeclareUserSettingKey(
         userSettingPtr,
         __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_MUL_PROC_SINGLE_BIN,
@@ -302,6 +311,13 @@ MOS_STATUS MosUserSetting::InitMosCommonUserSetting(MediaUserSettingSharedPtr us
         true,
         USER_SETTING_CONFIG_PERF_PATH); //"Performance Profiler Memory Information Register."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_MCPY_LOAD_BALANCE_ENABLE,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Select media copy engine by GPU queue depth of copy engines."
+
 #if MOS_COMMAND_BUFFER_DUMP_SUPPORTED
     DeclareUserSettingKey(
         userSettingPtr,
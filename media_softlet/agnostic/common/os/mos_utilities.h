@@ -70,6 +70,9 @@ public:
     MOS_FUNC_EXPORT static void MosSetUltFlag(uint8_t ultFlag);
     MOS_FUNC_EXPORT static int32_t MosGetMemNinjaCounter();
     MOS_FUNC_EXPORT static int32_t MosGetMemNinjaCounterGfx();
+    MOS_FUNC_EXPORT static void MosSetPerfCounterFlag(uint8_t enable);
+    MOS_FUNC_EXPORT static int32_t MosGetMemAllocTotalCounter();
+    MOS_FUNC_EXPORT static int32_t MosGetMutexLockCounter();
 
     friend class CommonLib::MosCallback;
 
@@ -2879,6 +2882,20 @@ public:
     static uint8_t                      *m_mosUltFlag;
     static int32_t                      m_mosMemAllocCounterNoUserFeature;
     static int32_t                      m_mosMemAllocCounterNoUserFeatureGfx;
+    static bool                         m_mosPerfCounterEnabled;       //!< Count allocations and mutex locks, set by ULT benchmark
+    static int32_t                      m_mosMemAllocTotalCounter;     //!< Number of allocations since perf counters enabled
+    static int32_t                      m_mosMutexLockCounter;         //!< Number of mutex locks since perf counters enabled
+
+    //!
+    //! \brief    Count one allocation if perf counters are enabled
+    //!
+    static void MosPerfCountAlloc()
+    {
+        if (m_mosPerfCounterEnabled)
+        {
+            MosAtomicIncrement(&m_mosMemAllocTotalCounter);
+        }
+    }
 
     //Temporarily defined as the reference to compatible with the cases using uf key to enable/disable APG.
     static int32_t                      *m_mosMemAllocCounter;
@@ -3009,6 +3026,7 @@ _Ty* MosUtilities::MosNewUtil(_Types&&... _Args)
     if (ptr != nullptr)
     {
         MosAtomicIncrement(m_mosMemAllocCounter);
+        MosPerfCountAlloc();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, sizeof(_Ty), functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -3048,6 +3066,7 @@ _Ty* MosUtilities::MosNewArrayUtil(size_t numElements)
     if (ptr != nullptr)
     {
         MosAtomicIncrement(m_mosMemAllocCounter);
+        MosPerfCountAlloc();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, numElements*sizeof(_Ty), functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -433,6 +433,23 @@ MOS_FUNC_EXPORT int32_t MosUtilities::MosGetMemNinjaCounterGfx()
     return m_mosMemAllocCounterNoUserFeatureGfx;
 }
 
+MOS_FUNC_EXPORT void MosUtilities::MosSetPerfCounterFlag(uint8_t enable)
+{
+    m_mosMemAllocTotalCounter = 0;
+    m_mosMutexLockCounter     = 0;
+    m_mosPerfCounterEnabled   = (enable != 0);
+}
+
+MOS_FUNC_EXPORT int32_t MosUtilities::MosGetMemAllocTotalCounter()
+{
+    return m_mosMemAllocTotalCounter;
+}
+
+MOS_FUNC_EXPORT int32_t MosUtilities::MosGetMutexLockCounter()
+{
+    return m_mosMutexLockCounter;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -452,6 +469,21 @@ extern "C" {
         MosUtilities::MosSetUltFlag(ultFlag);
     }
 
+    MOS_FUNC_EXPORT void MOS_SetPerfCounterFlag(uint8_t enable)
+    {
+        MosUtilities::MosSetPerfCounterFlag(enable);
+    }
+
+    MOS_FUNC_EXPORT int32_t MOS_GetMemAllocTotalCounter()
+    {
+        return MosUtilities::MosGetMemAllocTotalCounter();
+    }
+
+    MOS_FUNC_EXPORT int32_t MOS_GetMutexLockCounter()
+    {
+        return MosUtilities::MosGetMutexLockCounter();
+    }
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -32,6 +32,9 @@
 
 int32_t              MosUtilities::m_mosMemAllocCounterNoUserFeature    = 0;
 int32_t              MosUtilities::m_mosMemAllocCounterNoUserFeatureGfx = 0;
+bool                 MosUtilities::m_mosPerfCounterEnabled              = false;
+int32_t              MosUtilities::m_mosMemAllocTotalCounter            = 0;
+int32_t              MosUtilities::m_mosMutexLockCounter                = 0;
 const MtControlData *MosUtilities::m_mosTraceControlData                = nullptr;
 MtEnable             MosUtilities::m_mosTraceEnable                     = false;
 MtFilter             MosUtilities::m_mosTraceFilter                     = {};
@@ -217,6 +220,7 @@ void  *MosUtilities::MosAlignedAllocMemory(
     if(ptr != nullptr)
     {
         MosAtomicIncrement(m_mosMemAllocCounter);
+        MosPerfCountAlloc();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -276,6 +280,7 @@ void *MosUtilities::MosAllocMemory(size_t size)
     if(ptr != nullptr)
     {
         MosAtomicIncrement(m_mosMemAllocCounter);
+        MosPerfCountAlloc();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -314,6 +319,7 @@ void *MosUtilities::MosAllocAndZeroMemory(size_t size)
         MosZeroMemory(ptr, size);
 
         MosAtomicIncrement(m_mosMemAllocCounter);
+        MosPerfCountAlloc();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -366,6 +372,7 @@ void *MosUtilities::MosReallocMemory(
         if (newPtr != nullptr)
         {
             MosAtomicIncrement(m_mosMemAllocCounter);
+            MosPerfCountAlloc();
             MOS_MEMNINJA_ALLOC_MESSAGE(newPtr, newSize, functionName, filename, line);
             PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(newPtr),
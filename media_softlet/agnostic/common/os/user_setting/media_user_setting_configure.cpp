@@ -32,6 +32,7 @@ namespace Internal {
 const UFKEY_NEXT Configure::m_rootKey = UFKEY_INTERNAL_NEXT;
 const char *Configure::m_configPath = USER_SETTING_CONFIG_PATH;
 const char *Configure::m_reportPath = USER_SETTING_REPORT_PATH;
+const char *Configure::m_snapshotEnvName = "MEDIA_USER_SETTING_SNAPSHOT";
 
 Configure::Configure(MOS_USER_FEATURE_KEY_PATH_INFO *keyPathInfo):Configure()
 {
@@ -58,6 +59,10 @@ Configure::Configure()
     m_statedReportPath = m_reportPath;
 
     MosUtilities::MosInitializeReg(m_regBufferMap);
+
+    // Registry and environment variables are resolved once and served from an immutable
+    // snapshot, so that hot path reads do not need to touch registry, env or the lock.
+    m_snapshotEnabled = MosUtilities::MosEnvVariableEqual(m_snapshotEnvName, "1");
 }
 
 Configure::~Configure()
@@ -82,6 +87,7 @@ MOS_STATUS Configure::Register(
         m_mutexLock.Unlock();
         return MOS_STATUS_FILE_EXISTS;
     }
+    m_snapshotGeneration++;
 
     auto &defs = GetDefinitions(group);
     std::string subPath = "";
@@ -130,43 +136,46 @@ MOS_STATUS Configure::Read(Value &value,
     bool useCustomValue,
     uint32_t option)
 {
-    int32_t     ret     = 0;
     MOS_STATUS  status  = MOS_STATUS_SUCCESS;
+
+    if (m_snapshotEnabled && option == MEDIA_USER_SETTING_INTERNAL)
+    {
+        auto snapshot = GetSnapshot();
+        if (snapshot != nullptr)
+        {
+            int32_t groupIdx = (group < Group::Device || group >= Group::MaxCount) ? Group::Device : group;
+            auto    &items   = snapshot->items[groupIdx];
+            auto    it       = items.find(MakeHash(valueName));
+            // Item registered after the snapshot was built is read from definitions below.
+            if (it != items.end())
+            {
+                auto &item = it->second;
+                if (item.debugOnly)
+                {
+                    value = useCustomValue ? customValue : item.value;
+                    return MOS_STATUS_SUCCESS;
+                }
+
+                value = (item.status == MOS_STATUS_SUCCESS || !useCustomValue) ? item.value : customValue;
+                return item.status;
+            }
+        }
+    }
+
     auto        &defs   = GetDefinitions(group);
     auto        def     = defs[MakeHash(valueName)];
     if (def == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
     }
-    auto        defaultType = def->DefaultValue().ValueType();
 
     if (def->IsDebugOnly() && !m_isDebugMode)
     {
         value = useCustomValue ? customValue : def->DefaultValue();
         return MOS_STATUS_SUCCESS;
     }
-    //First, Read user setting. If succeed, return;
-    {
-        std::string path = GetReadPath(def, option);
-        UFKEY_NEXT  key  = {};
 
-        status = MosUtilities::MosOpenRegKey(m_rootKey, path, KEY_READ, &key, m_regBufferMap);
-
-        if (status == MOS_STATUS_SUCCESS)
-        {
-            m_mutexLock.Lock();
-            status = MosUtilities::MosGetRegValue(key, valueName, defaultType, value, m_regBufferMap);
-            m_mutexLock.Unlock();
-            MosUtilities::MosCloseRegKey(key);
-        }
-    }
-
-    //Second, if 1st failed, read envionment variable. External user setting does not set env varaible now.
-    if (status != MOS_STATUS_SUCCESS && option == MEDIA_USER_SETTING_INTERNAL)
-    {
-        // read env variable if no user setting set
-        status = MosUtilities::MosReadEnvVariable(def->ItemEnvName(), defaultType, value);
-    }
+    status = ResolveValue(value, valueName, def, option);
 
     if (status != MOS_STATUS_SUCCESS)
     {
@@ -219,6 +228,12 @@ MOS_STATUS Configure::Write(
     MOS_STATUS status = MOS_STATUS_UNKNOWN;
 
     m_mutexLock.Lock();
+    // Reports are written to report path which is not read back, only a write to
+    // the read path of the item changes the resolved value.
+    if (option == MEDIA_USER_SETTING_INTERNAL && path == def->GetSubPath())
+    {
+        m_snapshotGeneration++;
+    }
     status = MosUtilities::MosCreateRegKey(m_rootKey, path, KEY_WRITE, &key, m_regBufferMap);
 
     if (status == MOS_STATUS_SUCCESS)
@@ -238,6 +253,106 @@ MOS_STATUS Configure::Write(
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS Configure::ResolveValue(
+    Value &value,
+    const std::string &itemName,
+    std::shared_ptr<Definition> def,
+    uint32_t option)
+{
+    MOS_STATUS  status      = MOS_STATUS_SUCCESS;
+    auto        defaultType = def->DefaultValue().ValueType();
+
+    //First, Read user setting. If succeed, return;
+    {
+        std::string path = GetReadPath(def, option);
+        UFKEY_NEXT  key  = {};
+
+        // Opening a key may insert it into registry buffer, which Write changes concurrently.
+        m_mutexLock.Lock();
+        status = MosUtilities::MosOpenRegKey(m_rootKey, path, KEY_READ, &key, m_regBufferMap);
+
+        if (status == MOS_STATUS_SUCCESS)
+        {
+            status = MosUtilities::MosGetRegValue(key, itemName, defaultType, value, m_regBufferMap);
+            MosUtilities::MosCloseRegKey(key);
+        }
+        m_mutexLock.Unlock();
+    }
+
+    //Second, if 1st failed, read envionment variable. External user setting does not set env varaible now.
+    if (status != MOS_STATUS_SUCCESS && option == MEDIA_USER_SETTING_INTERNAL)
+    {
+        // read env variable if no user setting set
+        status = MosUtilities::MosReadEnvVariable(def->ItemEnvName(), defaultType, value);
+    }
+
+    return status;
+}
+
+std::shared_ptr<const Configure::Snapshot> Configure::GetSnapshot()
+{
+    // Fast path, no lock while the published snapshot is current. The generation is
+    // only bumped under m_mutexLock, an acquire load sees every bump before it.
+    auto current = std::atomic_load(&m_snapshot);
+    if (current != nullptr && current->generation == m_snapshotGeneration.load(std::memory_order_acquire))
+    {
+        return current;
+    }
+
+    // One rebuild at a time, so that an older snapshot is never published over a newer one.
+    std::lock_guard<std::mutex> buildLock(m_snapshotBuildMutex);
+    current = std::atomic_load(&m_snapshot);
+    if (current != nullptr && current->generation == m_snapshotGeneration.load(std::memory_order_acquire))
+    {
+        return current;
+    }
+
+    std::shared_ptr<Snapshot> snapshot(new (std::nothrow) Snapshot());
+    if (snapshot == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Collect definitions and the generation they belong to under lock, then resolve
+    // without holding it since ResolveValue takes the lock itself when accessing registry
+    // buffer. A change during resolving bumps the generation again and the snapshot is
+    // rebuilt on next read.
+    std::vector<std::pair<int32_t, std::pair<std::size_t, std::shared_ptr<Definition>>>> defs;
+    m_mutexLock.Lock();
+    snapshot->generation = m_snapshotGeneration.load(std::memory_order_relaxed);
+    for (int32_t group = Group::Device; group < Group::MaxCount; group++)
+    {
+        for (auto &def : m_definitions[group])
+        {
+            if (def.second != nullptr)
+            {
+                defs.push_back(std::make_pair(group, std::make_pair(def.first, def.second)));
+            }
+        }
+    }
+    m_mutexLock.Unlock();
+
+    for (auto &entry : defs)
+    {
+        auto         &def = entry.second.second;
+        SnapshotItem item = {};
+        item.debugOnly     = def->IsDebugOnly() && !m_isDebugMode;
+        item.status        = item.debugOnly ? MOS_STATUS_SUCCESS :
+                             ResolveValue(item.value, def->ItemName(), def, MEDIA_USER_SETTING_INTERNAL);
+        if (item.debugOnly || item.status != MOS_STATUS_SUCCESS)
+        {
+            item.value = def->DefaultValue();
+        }
+        snapshot->items[entry.first].insert(std::make_pair(entry.second.first, item));
+    }
+
+    // Previous snapshot is released when the last reader holding it is done.
+    std::shared_ptr<const Snapshot> published = snapshot;
+    std::atomic_store(&m_snapshot, published);
+
+    return published;
+}
+
 std::string Configure::GetReadPath(
     std::shared_ptr<Definition> def,
     uint32_t option)
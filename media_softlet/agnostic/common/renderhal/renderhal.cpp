@@ -949,6 +949,254 @@ void RenderHal_GetPixelsPerSample(
     }
 }
 
+//!
+//! \brief    Set Surface State Entry
+//! \details  Encode surface state through MHW, or copy the state encoded for
+//!           identical parameters from surface state cache. Surface address
+//!           is not part of the encoded state, it is patched on submission.
+//!           CM does not use it, CmSurfaceStateManager keeps encoded states
+//!           per surface and parameter set already.
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to Hardware Interface Structure
+//! \param    PMHW_SURFACE_STATE_PARAMS pParams
+//!           [in/out] Pointer to MHW surface state parameters
+//! \return   MOS_STATUS
+//!
+MOS_STATUS RenderHal_SetSurfaceStateEntry(
+    PRENDERHAL_INTERFACE        pRenderHal,
+    PMHW_SURFACE_STATE_PARAMS   pParams)
+{
+    PRENDERHAL_SURFACE_STATE_CACHE       pCache;
+    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY pEntry;
+    uint32_t                             dwHash;
+    uint32_t                             dwSize;
+
+    //-----------------------------------------------
+    MHW_RENDERHAL_CHK_NULL_RETURN(pRenderHal);
+    MHW_RENDERHAL_CHK_NULL_RETURN(pRenderHal->pMhwStateHeap);
+    MHW_RENDERHAL_CHK_NULL_RETURN(pRenderHal->pHwSizes);
+    MHW_RENDERHAL_CHK_NULL_RETURN(pParams);
+    MHW_RENDERHAL_CHK_NULL_RETURN(pParams->pSurfaceState);
+    //-----------------------------------------------
+
+    dwSize = pParams->bUseAdvState ? pRenderHal->pHwSizes->dwSizeSurfaceStateAvs : pRenderHal->pHwSizes->dwSizeSurfaceState;
+    if (dwSize == 0 || dwSize > RENDERHAL_SURFACE_STATE_CACHE_MAX_SIZE)
+    {
+        return pRenderHal->pMhwStateHeap->SetSurfaceStateEntry(pParams);
+    }
+
+    if (pRenderHal->pSurfaceStateCache == nullptr)
+    {
+        pRenderHal->pSurfaceStateCache = (PRENDERHAL_SURFACE_STATE_CACHE)MOS_AllocAndZeroMemory(sizeof(RENDERHAL_SURFACE_STATE_CACHE));
+        if (pRenderHal->pSurfaceStateCache == nullptr)
+        {
+            return pRenderHal->pMhwStateHeap->SetSurfaceStateEntry(pParams);
+        }
+    }
+    pCache = pRenderHal->pSurfaceStateCache;
+
+    // Key is the parameter set from dwCacheabilityControl to L1CacheConfig plus the GMM tile
+    // mode. The output and destination pointers are not part of it. Only the fields telling
+    // surfaces apart are hashed, the whole key is compared.
+    dwHash = pParams->dwFormat * 0x9E3779B1u;
+    dwHash ^= (pParams->dwWidth << 16 | pParams->dwHeight) * 0x85EBCA77u;
+    dwHash ^= (pParams->dwPitch + pParams->dwCacheabilityControl + pParams->dwYOffsetForU + (uint32_t)pParams->iYOffset) * 0xC2B2AE3Du;
+    dwHash ^= pParams->SurfaceType3D | (pParams->MmcState << 3) | (pParams->RotationMode << 6) | (pParams->bUseAdvState << 9);
+    pEntry = &pCache->Entry[(dwHash ^ (dwHash >> 15)) & (RENDERHAL_SURFACE_STATE_CACHE_ENTRIES - 1)];
+
+    if (pEntry->dwSize == dwSize &&
+        memcmp(&pEntry->Params.dwCacheabilityControl, &pParams->dwCacheabilityControl, RENDERHAL_SURFACE_STATE_CACHE_KEY_SIZE) == 0 &&
+        pEntry->Params.TileModeGMM     == pParams->TileModeGMM &&
+        pEntry->Params.bGMMTileEnabled == pParams->bGMMTileEnabled)
+    {
+        MOS_SecureMemcpy(pParams->pSurfaceState, dwSize, pEntry->State, dwSize);
+        pParams->pdwCmd          = (uint32_t *)(pParams->pSurfaceState + pEntry->dwCmdOffset);
+        pParams->dwLocationInCmd = pEntry->dwLocationInCmd;
+        pCache->dwHits++;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MHW_RENDERHAL_CHK_STATUS_RETURN(pRenderHal->pMhwStateHeap->SetSurfaceStateEntry(pParams));
+    pCache->dwMisses++;
+
+    // Replace the entry with the new encoding, parameter change invalidates the old one
+    pEntry->dwSize = 0;
+    if (pParams->pdwCmd &&
+        (uint8_t *)pParams->pdwCmd >= pParams->pSurfaceState &&
+        (uint8_t *)pParams->pdwCmd <  pParams->pSurfaceState + dwSize)
+    {
+        MOS_SecureMemcpy(&pEntry->Params.dwCacheabilityControl, RENDERHAL_SURFACE_STATE_CACHE_KEY_SIZE,
+            &pParams->dwCacheabilityControl, RENDERHAL_SURFACE_STATE_CACHE_KEY_SIZE);
+        pEntry->Params.TileModeGMM     = pParams->TileModeGMM;
+        pEntry->Params.bGMMTileEnabled = pParams->bGMMTileEnabled;
+        MOS_SecureMemcpy(pEntry->State, sizeof(pEntry->State), pParams->pSurfaceState, dwSize);
+        pEntry->dwCmdOffset     = (uint32_t)((uint8_t *)pParams->pdwCmd - pParams->pSurfaceState);
+        pEntry->dwLocationInCmd = pParams->dwLocationInCmd;
+        pEntry->dwSize          = dwSize;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief    Get Kernel Hash Buckets
+//! \details  Get number of kernel residency hash buckets for a kernel count
+//! \param    int32_t iKernelCount
+//!           [in] Number of kernel allocation entries
+//! \return   uint32_t
+//!           Number of buckets, power of 2
+//!
+static uint32_t RenderHal_GetKernelHashBuckets(int32_t iKernelCount)
+{
+    uint32_t dwBuckets = 16;
+    while (dwBuckets < (uint32_t)iKernelCount)
+    {
+        dwBuckets <<= 1;
+    }
+    return dwBuckets;
+}
+
+//!
+//! \brief    Get Kernel Hash
+//! \details  Get kernel residency hash bucket of a kernel
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKUID
+//!           [in] Kernel unique ID
+//! \param    int32_t iKCID
+//!           [in] Kernel cache ID
+//! \return   uint32_t
+//!           Hash bucket index
+//!
+static inline uint32_t RenderHal_GetKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKUID,
+    int32_t               iKCID)
+{
+    uint32_t dwHash = ((uint32_t)iKUID * 0x9E3779B1) ^ ((uint32_t)iKCID * 0x85EBCA77);
+    return (dwHash ^ (dwHash >> 16)) & pStateHeap->dwKernelHashMask;
+}
+
+//!
+//! \brief    Find Kernel
+//! \details  Find allocation of a kernel resident in ISH
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iMaxKernels
+//!           [in] Number of kernel allocation entries
+//! \param    int32_t iKUID
+//!           [in] Kernel unique ID
+//! \param    int32_t iKCID
+//!           [in] Kernel cache ID
+//! \return   int32_t
+//!           Kernel allocation index, -1 if kernel is not loaded
+//!
+static int32_t RenderHal_FindKernel(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iMaxKernels,
+    int32_t               iKUID,
+    int32_t               iKCID)
+{
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    int32_t                   iKernelAllocationID;
+    int32_t                   i;
+
+    if (pStateHeap->pKernelHashTable == nullptr)
+    {
+        pKernelAllocation = pStateHeap->pKernelAllocation;
+        for (i = 0; i < iMaxKernels; i++, pKernelAllocation++)
+        {
+            if (pKernelAllocation->iKUID == iKUID &&
+                pKernelAllocation->iKCID == iKCID)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    iKernelAllocationID = pStateHeap->pKernelHashTable[RenderHal_GetKernelHash(pStateHeap, iKUID, iKCID)];
+    for (i = 0; i < iMaxKernels && iKernelAllocationID >= 0 && iKernelAllocationID < iMaxKernels; i++)
+    {
+        pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+        if (pKernelAllocation->iKUID == iKUID &&
+            pKernelAllocation->iKCID == iKCID)
+        {
+            return iKernelAllocationID;
+        }
+        iKernelAllocationID = pKernelAllocation->iHashNext;
+    }
+
+    return -1;
+}
+
+//!
+//! \brief    Insert Kernel Hash
+//! \details  Add a loaded kernel allocation to the residency hash
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKernelAllocationID
+//!           [in] Kernel allocation index
+//! \return   void
+//!
+static void RenderHal_InsertKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKernelAllocationID)
+{
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    uint32_t                  dwBucket;
+
+    if (pStateHeap->pKernelHashTable == nullptr)
+    {
+        return;
+    }
+
+    pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+    dwBucket          = RenderHal_GetKernelHash(pStateHeap, pKernelAllocation->iKUID, pKernelAllocation->iKCID);
+
+    pKernelAllocation->iHashNext           = pStateHeap->pKernelHashTable[dwBucket];
+    pStateHeap->pKernelHashTable[dwBucket] = iKernelAllocationID;
+}
+
+//!
+//! \brief    Remove Kernel Hash
+//! \details  Remove a kernel allocation from the residency hash
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iMaxKernels
+//!           [in] Number of kernel allocation entries
+//! \param    int32_t iKernelAllocationID
+//!           [in] Kernel allocation index
+//! \return   void
+//!
+static void RenderHal_RemoveKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iMaxKernels,
+    int32_t               iKernelAllocationID)
+{
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    int32_t                   *piLink;
+    int32_t                   i;
+
+    if (pStateHeap->pKernelHashTable == nullptr)
+    {
+        return;
+    }
+
+    pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+    piLink            = &pStateHeap->pKernelHashTable[RenderHal_GetKernelHash(pStateHeap, pKernelAllocation->iKUID, pKernelAllocation->iKCID)];
+    for (i = 0; i < iMaxKernels && *piLink >= 0 && *piLink < iMaxKernels; i++)
+    {
+        if (*piLink == iKernelAllocationID)
+        {
+            *piLink = pKernelAllocation->iHashNext;
+            break;
+        }
+        piLink = &pStateHeap->pKernelAllocation[*piLink].iHashNext;
+    }
+    pKernelAllocation->iHashNext = -1;
+}
+
 //!
 //! \brief    Allocate GSH, SSH, ISH control structures and heaps
 //! \details  Allocates State Heap control structure (system memory)
@@ -1085,6 +1333,8 @@ void RenderHal_GetPixelsPerSample(
 |  |         |                    .                      |
 |  |         | Kernel Allocation [K-1]                   |
 |  |         |-------------------------------------------|
+|  |         | Kernel Hash Bucket [0] to [H-1]           |
+|  |         |-------------------------------------------|
 |  |         | Media State Control Structure [0]         |--+
 |  |         | Media State Control Structure [1]         |--|--+
 |  |         |                    .                      |  |  |
@@ -1117,6 +1367,7 @@ void RenderHal_GetPixelsPerSample(
 |            |==============================|
 |
 |     where K  = (sSettings.iKernelCount)     Kernel Allocation Entries
+|           H  = power of 2 >= max(K, 16)     Kernel Residency Hash Buckets
 |           Q  = (sSettings.iMediaStateHeaps) Media States
 |           M  = (sSettings.iMediaIDs)        Media Interface Descriptors (ID)
 |           P  = (sSettings.iSurfaceStates)   Surface States
@@ -1193,6 +1444,7 @@ MOS_STATUS RenderHal_AllocateStateHeaps(
     // Calculate size of State Heap control structure
     dwSizeAlloc  = MOS_ALIGN_CEIL(stateHeapSize, 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(RENDERHAL_KRN_ALLOCATION)     , 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) * sizeof(int32_t), 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * pSettings->iMediaIDs * sizeof(int32_t)   , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iSurfaceStates   * sizeof(RENDERHAL_SURFACE_STATE_ENTRY), 16);
@@ -1230,6 +1482,11 @@ MOS_STATUS RenderHal_AllocateStateHeaps(
     pStateHeap->pKernelAllocation = (PRENDERHAL_KRN_ALLOCATION) ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(RENDERHAL_KRN_ALLOCATION), 16);
 
+    // Pointer to Kernel residency hash buckets
+    pStateHeap->pKernelHashTable = (int32_t*) ptr;
+    pStateHeap->dwKernelHashMask = RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) - 1;
+    ptr += MOS_ALIGN_CEIL((pStateHeap->dwKernelHashMask + 1) * sizeof(int32_t), 16);
+
     // Pointer to Media State allocations
     pStateHeap->pMediaStates = (PRENDERHAL_MEDIA_STATE) ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
@@ -1579,6 +1836,7 @@ MOS_STATUS RenderHal_ReAllocateStateHeapsforAdvFeature(
     // Calculate size of State Heap control structure
     dwSizeAlloc  = MOS_ALIGN_CEIL(stateHeapSize                                                      , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(RENDERHAL_KRN_ALLOCATION)     , 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) * sizeof(int32_t), 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize                       , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * pSettings->iMediaIDs * sizeof(int32_t)   , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iSurfaceStates   * sizeof(RENDERHAL_SURFACE_STATE_ENTRY), 16);
@@ -1606,6 +1864,10 @@ MOS_STATUS RenderHal_ReAllocateStateHeapsforAdvFeature(
     pStateHeap->pKernelAllocation = (PRENDERHAL_KRN_ALLOCATION)ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(RENDERHAL_KRN_ALLOCATION), 16);
 
+    // Pointer to Kernel residency hash buckets
+    pStateHeap->pKernelHashTable = (int32_t *)ptr;
+    ptr += MOS_ALIGN_CEIL((pStateHeap->dwKernelHashMask + 1) * sizeof(int32_t), 16);
+
     // Pointer to Media State allocations
     pStateHeap->pMediaStates = (PRENDERHAL_MEDIA_STATE)ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
@@ -2230,100 +2492,73 @@ int32_t RenderHal_LoadKernel(
         iKernelUniqueID = pKernel->iKUID;
         iKernelCacheID  = pKernel->iKCID;
 
-        // Check if kernel is already loaded; Search free allocation index
-        iSearchIndex      = -1;
-        iMaxKernels       = pRenderHal->StateHeapSettings.iKernelCount;
-        pKernelAllocation = pStateHeap->pKernelAllocation;
-        for (iKernelAllocationID = 0;
-             iKernelAllocationID < iMaxKernels;
-             iKernelAllocationID++, pKernelAllocation++)
+        // Check if kernel is already loaded
+        iMaxKernels         = pRenderHal->StateHeapSettings.iKernelCount;
+        iKernelAllocationID = RenderHal_FindKernel(pStateHeap, iMaxKernels, iKernelUniqueID, iKernelCacheID);
+
+        // Forced reload of a kernel that no longer fits its block: evict the resident copy
+        // and load the new binary as a new kernel below
+        if (iKernelAllocationID >= 0 &&
+            pKernel->bForceReload &&
+            iKernelSize > pStateHeap->pKernelAllocation[iKernelAllocationID].iSize)
         {
-            if (pKernelAllocation->iKUID == iKernelUniqueID &&
-                pKernelAllocation->iKCID == iKernelCacheID)
+            pKernelAllocation = &(pStateHeap->pKernelAllocation[iKernelAllocationID]);
+
+            // A block still in use by the GPU cannot be freed yet. Detach it from the kernel IDs,
+            // it stays allocated until the eviction search below reclaims it.
+            if (pRenderHal->pfnUnloadKernel(pRenderHal, iKernelAllocationID) != MOS_STATUS_SUCCESS)
             {
-                if (iKernelAllocationID != RENDERHAL_KERNEL_LOAD_FAIL)
+                RenderHal_RemoveKernelHash(pStateHeap, iMaxKernels, iKernelAllocationID);
+                pKernelAllocation->iKUID = -1;
+                pKernelAllocation->iKCID = -1;
+                if (pKernelAllocation->pKernelEntry)
                 {
-                    // Update kernel usage
-                    pRenderHal->pfnTouchKernel(pRenderHal, iKernelAllocationID);
-
-                    // Increment reference counter
-                    if (pKernelEntry)
-                    {
-                        pKernelEntry->dwLoaded = 1;
-                    }
-                    pRenderHal->iKernelAllocationID = iKernelAllocationID;
+                    pKernelAllocation->pKernelEntry->dwLoaded = 0;
                 }
-
-                // Return kernel allocation index
-                return iKernelAllocationID;
+                pKernelAllocation->pKernelEntry = nullptr;
             }
 
-            if (iSearchIndex < 0 &&
-                pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
-            {
-                iSearchIndex = iKernelAllocationID;
-            }
+            pStateHeap->KernelStats.dwEvictions++;
+            pKernel->bForceReload = false;
+            iKernelAllocationID   = RENDERHAL_KERNEL_LOAD_FAIL;
         }
 
-        // The kernel size to be dumped in oca buffer.
-        pStateHeap->iKernelUsedForDump = iKernelSize;
-
         // Kernel already loaded: refresh timer; return allocation index
-        if (iKernelAllocationID < iMaxKernels)
+        if (iKernelAllocationID >= 0)
         {
+            pKernelAllocation = &(pStateHeap->pKernelAllocation[iKernelAllocationID]);
+
             // To reload the kernel forcibly if needed
             if (pKernel->bForceReload)
             {
                 dwOffset = pKernelAllocation->dwOffset;
                 MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
+                pStateHeap->KernelStats.ui64IshBytesCopied += iKernelSize;
 
                 pKernel->bForceReload = false;
             }
+
+            pKernelAllocation->dwUseCount++;
+            pStateHeap->KernelStats.dwLoadHits++;
             break;
         }
 
-        // Kernel parameters
-        pKernelPtr      = pKernel->pBinary;
-        iKernelSize     = pKernel->iSize;
-        iKernelUniqueID = pKernel->iKUID;
-        iKernelCacheID  = pKernel->iKCID;
-
-        // Check if kernel is already loaded; Search free allocation index
-        iSearchIndex      = -1;
-        iMaxKernels       = pRenderHal->StateHeapSettings.iKernelCount;
-        pKernelAllocation = pStateHeap->pKernelAllocation;
-        for (iKernelAllocationID = 0;
-             iKernelAllocationID < iMaxKernels;
-             iKernelAllocationID++, pKernelAllocation++)
-        {
-            if (pKernelAllocation->iKUID == iKernelUniqueID &&
-                pKernelAllocation->iKCID == iKernelCacheID)
-            {
-                break;
-            }
-
-            if (iSearchIndex < 0 &&
-                pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
-            {
-                iSearchIndex = iKernelAllocationID;
-            }
-        }
+        pStateHeap->KernelStats.dwLoadMisses++;
+        iKernelAllocationID = RENDERHAL_KERNEL_LOAD_FAIL;
 
         // The kernel size to be dumped in oca buffer.
         pStateHeap->iKernelUsedForDump = iKernelSize;
 
-        // Kernel already loaded: refresh timer; return allocation index
-        if (iKernelAllocationID < iMaxKernels)
+        // Search free allocation index
+        iSearchIndex      = -1;
+        pKernelAllocation = pStateHeap->pKernelAllocation;
+        for (int32_t i = 0; i < iMaxKernels; i++, pKernelAllocation++)
         {
-            // To reload the kernel forcibly if needed
-            if (pKernel->bForceReload)
+            if (pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
             {
-                dwOffset = pKernelAllocation->dwOffset;
-                MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
-
-                pKernel->bForceReload = false;
+                iSearchIndex = i;
+                break;
             }
-            break;
         }
 
         // Simple allocation: allocation index available, space available
@@ -2382,6 +2617,9 @@ int32_t RenderHal_LoadKernel(
             uint32_t dwOldest = 0;
             uint32_t dwLastUsed;
 
+            // Update sync tags so kernels completed by GPU may be replaced
+            pRenderHal->pfnRefreshSync(pRenderHal);
+
             // Search and deallocate least used kernel
             pKernelAllocation = pStateHeap->pKernelAllocation;
             for (iKernelAllocationID = 0;
@@ -2403,9 +2641,11 @@ int32_t RenderHal_LoadKernel(
                     continue;
                 }
 
-                // Find kernel not used for the greater amount of time (measured in number of operations)
+                // Find kernel not used for the greater amount of time (measured in number of operations),
+                // weighted down by how often it was reused since loaded.
                 // Must not unload recently allocated kernels
-                dwLastUsed = (uint32_t)(pStateHeap->dwAccessCounter - pKernelAllocation->dwCount);
+                dwLastUsed = (uint32_t)(pStateHeap->dwAccessCounter - pKernelAllocation->dwCount) & 0x0FFFFFFF;
+                dwLastUsed = dwLastUsed * 8 / (1 + MOS_MIN(pKernelAllocation->dwUseCount, 7));
                 if (dwLastUsed > dwOldest)
                 {
                     iSearchIndex = iKernelAllocationID;
@@ -2428,6 +2668,7 @@ int32_t RenderHal_LoadKernel(
                 iKernelAllocationID = RENDERHAL_KERNEL_LOAD_FAIL;
                 break;
             }
+            pStateHeap->KernelStats.dwEvictions++;
         }
 
         // Allocate the entry
@@ -2451,9 +2692,12 @@ int32_t RenderHal_LoadKernel(
         pKernelAllocation->Params       = *pParameters;
         pKernelAllocation->pKernelEntry = pKernelEntry;
         pKernelAllocation->iAllocIndex  = iKernelAllocationID;
+        pKernelAllocation->dwUseCount   = 0;
+        RenderHal_InsertKernelHash(pStateHeap, iKernelAllocationID);
 
         // Copy kernel data
         MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
+        pStateHeap->KernelStats.ui64IshBytesCopied += iKernelSize;
         if (iKernelSize < iSize)
         {
             MOS_ZeroMemory(pStateHeap->pIshBuffer + dwOffset + iKernelSize, iSize - iKernelSize);
@@ -2534,6 +2778,8 @@ MOS_STATUS RenderHal_UnloadKernel(
         pKernelAllocation->pKernelEntry->dwLoaded = 0;
     }
 
+    RenderHal_RemoveKernelHash(pStateHeap, pRenderHal->StateHeapSettings.iKernelCount, iKernelAllocationID);
+
     // Release kernel entry (Offset/size may be used for reallocation)
     pKernelAllocation->iKID             = -1;
     pKernelAllocation->iKUID            = -1;
@@ -2630,9 +2876,20 @@ void RenderHal_ResetKernels(
         pKernelAllocation->dwCount          = 0;
         pKernelAllocation->pKernelEntry     = nullptr;
         pKernelAllocation->iAllocIndex      = i;
+        pKernelAllocation->iHashNext        = -1;
+        pKernelAllocation->dwUseCount       = 0;
         pKernelAllocation->Params           = g_cRenderHal_InitKernelParams;
     }
 
+    // Empty kernel residency hash
+    if (pStateHeap->pKernelHashTable)
+    {
+        for (i = 0; i <= (int32_t)pStateHeap->dwKernelHashMask; i++)
+        {
+            pStateHeap->pKernelHashTable[i] = -1;
+        }
+    }
+
     // Free Kernel Heap
     pStateHeap->dwAccessCounter = 0;
     pStateHeap->iKernelSize = pRenderHal->StateHeapSettings.iKernelHeapSize;
@@ -4552,6 +4809,10 @@ MOS_STATUS RenderHal_Destroy(PRENDERHAL_INTERFACE pRenderHal)
     // Free Debug Surface
     RenderHal_FreeDebugSurface(pRenderHal);
 
+    // Free Surface State Cache
+    MOS_FreeMemory(pRenderHal->pSurfaceStateCache);
+    pRenderHal->pSurfaceStateCache = nullptr;
+
     // Decrease reference count for shared pointer
     pRenderHal->userSettingPtr = nullptr;
 
@@ -4828,6 +5089,26 @@ MOS_STATUS RenderHal_Reset(
                                             true,
                                             true));
 
+    // Report and restart kernel residency statistics of previous frame
+    PRENDERHAL_KRN_RESIDENCY_STATS pKernelStats = &pRenderHal->pStateHeap->KernelStats;
+    if (pKernelStats->dwLoadHits || pKernelStats->dwLoadMisses)
+    {
+        MHW_RENDERHAL_NORMALMESSAGE("Kernel loads: %d hits, %d misses, %d evictions, %lld bytes copied to ISH.",
+            pKernelStats->dwLoadHits, pKernelStats->dwLoadMisses, pKernelStats->dwEvictions,
+            (long long)pKernelStats->ui64IshBytesCopied);
+        MOS_ZeroMemory(pKernelStats, sizeof(*pKernelStats));
+    }
+
+    PRENDERHAL_SURFACE_STATE_CACHE pSurfaceStateCache = pRenderHal->pSurfaceStateCache;
+    if (pSurfaceStateCache && (pSurfaceStateCache->dwHits || pSurfaceStateCache->dwMisses))
+    {
+        MHW_RENDERHAL_NORMALMESSAGE("Surface state cache: %d hits, %d misses, hit rate %d%%.",
+            pSurfaceStateCache->dwHits, pSurfaceStateCache->dwMisses,
+            pSurfaceStateCache->dwHits * 100 / (pSurfaceStateCache->dwHits + pSurfaceStateCache->dwMisses));
+        pSurfaceStateCache->dwHits   = 0;
+        pSurfaceStateCache->dwMisses = 0;
+    }
+
     // Reset Slice Shutdown Mode
     pRenderHal->bRequestSingleSlice   = false;
     pRenderHal->PowerOption.nSlice    = 0;
@@ -5651,7 +5932,7 @@ MOS_STATUS RenderHal_SetSurfaceStateBuffer(
     Params.bGMMTileEnabled       = true;
 
     // Setup Surface State Entry via MHW state heap interface
-    MHW_RENDERHAL_CHK_STATUS_RETURN(pRenderHal->pMhwStateHeap->SetSurfaceStateEntry(&Params));
+    MHW_RENDERHAL_CHK_STATUS_RETURN(RenderHal_SetSurfaceStateEntry(pRenderHal, &Params));
 
     return eStatus;
 }
@@ -564,6 +564,52 @@ MOS_STATUS BltStateNext::CopyMainSurface(
 
 }
 
+//!
+//! \brief    Copy main surface list
+//! \details  BLT engine will copy each source surface to destination surface,
+//!           copies are submitted in as few command buffers as possible
+//! \param    src
+//!           [in] Array of source resources
+//! \param    dst
+//!           [in] Array of destination resources
+//! \param    copyNum
+//!           [in] Number of copies
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::CopyMainSurfaceList(
+    PMOS_RESOURCE *src,
+    PMOS_RESOURCE *dst,
+    uint32_t       copyNum)
+{
+    BLT_STATE_PARAM bltStateParams[BLT_MAX_COPY_NUM_PER_SUBMIT];
+
+    BLT_CHK_NULL_RETURN(src);
+    BLT_CHK_NULL_RETURN(dst);
+    MOS_TraceEventExt(EVENT_MEDIA_COPY, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
+
+    for (uint32_t copied = 0; copied < copyNum; )
+    {
+        uint32_t paramNum = MOS_MIN(copyNum - copied, BLT_MAX_COPY_NUM_PER_SUBMIT);
+
+        MOS_ZeroMemory(bltStateParams, sizeof(bltStateParams));
+        for (uint32_t i = 0; i < paramNum; i++)
+        {
+            BLT_CHK_NULL_RETURN(src[copied + i]);
+            BLT_CHK_NULL_RETURN(dst[copied + i]);
+            bltStateParams[i].bCopyMainSurface = true;
+            bltStateParams[i].pSrcSurface      = src[copied + i];
+            bltStateParams[i].pDstSurface      = dst[copied + i];
+        }
+
+        BLT_CHK_STATUS_RETURN(SubmitCMD(bltStateParams, paramNum));
+        copied += paramNum;
+    }
+
+    MOS_TraceEventExt(EVENT_MEDIA_COPY, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+    return MOS_STATUS_SUCCESS;
+}
+
 //!
 //! \brief    Setup fast copy parameters
 //! \details  Setup fast copy parameters for BLT Engine
@@ -705,13 +751,27 @@ MOS_STATUS BltStateNext::SetupBltCopyParam(
 MOS_STATUS BltStateNext::SubmitCMD(
     PBLT_STATE_PARAM pBltStateParam)
 {
-    MOS_STATUS                   eStatus;
+    return SubmitCMD(pBltStateParam, 1);
+}
+
+//!
+//! \brief    Submit command for copy list
+//! \details  Submit BLT commands of all copies in one command buffer
+//! \param    pBltStateParam
+//!           [in] Pointer to BLT_STATE_PARAM array
+//! \param    paramNum
+//!           [in] Number of BLT_STATE_PARAM in array
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::SubmitCMD(
+    PBLT_STATE_PARAM pBltStateParam,
+    uint32_t         paramNum)
+{
     MOS_COMMAND_BUFFER           cmdBuffer;
-    MHW_FAST_COPY_BLT_PARAM      fastCopyBltParam;
-    MHW_CTRL_SURF_COPY_BLT_PARAM ctrlSurfCopyBltParam;
     MOS_GPUCTX_CREATOPTIONS_ENHANCED createOption = {};
-    int                          planeNum = 1;
 
+    BLT_CHK_NULL_RETURN(pBltStateParam);
     BLT_CHK_NULL_RETURN(m_miItf);
     BLT_CHK_NULL_RETURN(m_bltItf);
 
@@ -732,6 +792,66 @@ MOS_STATUS BltStateNext::SubmitCMD(
     MOS_ZeroMemory(&cmdBuffer, sizeof(MOS_COMMAND_BUFFER));
     BLT_CHK_STATUS_RETURN(m_osInterface->pfnGetCommandBuffer(m_osInterface, &cmdBuffer, 0));
 
+    m_osInterface->pfnSetPerfTag(m_osInterface, BLT_COPY);
+    MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
+    BLT_CHK_NULL_RETURN(perfProfiler);
+    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+
+    for (uint32_t i = 0; i < paramNum; i++)
+    {
+        if (i > 0)
+        {
+            // Later copy may read the destination of former one.
+            auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+            flushDwParams = {};
+            BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+        }
+        BLT_CHK_STATUS_RETURN(AddCopyCmds(&cmdBuffer, &pBltStateParam[i]));
+    }
+
+    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectEndCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+
+    // Add flush DW
+    auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+    flushDwParams = {};
+    auto skuTable       = m_osInterface->pfnGetSkuTable(m_osInterface);
+    if (skuTable && MEDIA_IS_SKU(skuTable, FtrEnablePPCFlush))
+    {
+         flushDwParams.bEnablePPCFlush = true;
+    }
+    BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+    // Add Batch Buffer end
+    BLT_CHK_STATUS_RETURN(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
+
+    // Return unused command buffer space to OS
+    m_osInterface->pfnReturnCommandBuffer(m_osInterface, &cmdBuffer, 0);
+
+    // Flush the command buffer
+    BLT_CHK_STATUS_RETURN(m_osInterface->pfnSubmitCommandBuffer(m_osInterface, &cmdBuffer, false));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief    Add copy commands
+//! \details  Add BLT commands of one copy into command buffer
+//! \param    cmdBuffer
+//!           [in] Pointer to command buffer
+//! \param    pBltStateParam
+//!           [in] Pointer to BLT_STATE_PARAM
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::AddCopyCmds(
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    PBLT_STATE_PARAM    pBltStateParam)
+{
+    MHW_FAST_COPY_BLT_PARAM      fastCopyBltParam;
+    int                          planeNum = 1;
+
+    BLT_CHK_NULL_RETURN(cmdBuffer);
+    BLT_CHK_NULL_RETURN(pBltStateParam);
+
     MOS_SURFACE       srcResDetails;
     MOS_SURFACE       dstResDetails;
     MOS_ZeroMemory(&srcResDetails, sizeof(MOS_SURFACE));
@@ -747,11 +867,6 @@ MOS_STATUS BltStateNext::SubmitCMD(
         return MOS_STATUS_INVALID_PARAMETER;
     }
     planeNum = GetPlaneNum(dstResDetails.Format);
-    m_osInterface->pfnSetPerfTag(m_osInterface, BLT_COPY);
-    MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
-    BLT_CHK_NULL_RETURN(perfProfiler);
-    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
-
     if (pBltStateParam->bCopyMainSurface)
     {
         BLT_CHK_STATUS_RETURN(SetupBltCopyParam(
@@ -773,12 +888,12 @@ MOS_STATUS BltStateNext::SubmitCMD(
             swctrl.DW0.Tile4Destination = 1;
         }
         Register.dwData = swctrl.DW0.Value;
-        BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_LOAD_REGISTER_IMM)(&cmdBuffer));
+        BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_LOAD_REGISTER_IMM)(cmdBuffer));
 
         if (m_blokCopyon)
         {
             BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                &cmdBuffer,
+                cmdBuffer,
                 &fastCopyBltParam,
                 srcResDetails.YPlaneOffset.iSurfaceOffset,
                 dstResDetails.YPlaneOffset.iSurfaceOffset));
@@ -786,7 +901,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
         else
         {
             BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                &cmdBuffer,
+                cmdBuffer,
                 &fastCopyBltParam,
                 srcResDetails.YPlaneOffset.iSurfaceOffset,
                 dstResDetails.YPlaneOffset.iSurfaceOffset));
@@ -801,7 +916,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
             if (m_blokCopyon)
             {
                 BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                    &cmdBuffer,
+                    cmdBuffer,
                     &fastCopyBltParam,
                     srcResDetails.UPlaneOffset.iSurfaceOffset,
                     dstResDetails.UPlaneOffset.iSurfaceOffset));
@@ -809,7 +924,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
             else
             {
                 BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                    &cmdBuffer,
+                    cmdBuffer,
                     &fastCopyBltParam,
                     srcResDetails.UPlaneOffset.iSurfaceOffset,
                     dstResDetails.UPlaneOffset.iSurfaceOffset));
@@ -824,7 +939,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
                 if (m_blokCopyon)
                 {
                     BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                        &cmdBuffer,
+                        cmdBuffer,
                         &fastCopyBltParam,
                         srcResDetails.VPlaneOffset.iSurfaceOffset,
                         dstResDetails.VPlaneOffset.iSurfaceOffset));
@@ -832,7 +947,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
                 else
                 {
                     BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                        &cmdBuffer,
+                        cmdBuffer,
                         &fastCopyBltParam,
                         srcResDetails.VPlaneOffset.iSurfaceOffset,
                         dstResDetails.VPlaneOffset.iSurfaceOffset));
@@ -845,25 +960,6 @@ MOS_STATUS BltStateNext::SubmitCMD(
             }
          }
     }
-    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectEndCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
-
-    // Add flush DW
-    auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
-    flushDwParams = {};
-    auto skuTable       = m_osInterface->pfnGetSkuTable(m_osInterface);
-    if (skuTable && MEDIA_IS_SKU(skuTable, FtrEnablePPCFlush))
-    {
-         flushDwParams.bEnablePPCFlush = true;
-    }
-    BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
-    // Add Batch Buffer end
-    BLT_CHK_STATUS_RETURN(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
-
-    // Return unused command buffer space to OS
-    m_osInterface->pfnReturnCommandBuffer(m_osInterface, &cmdBuffer, 0);
-
-    // Flush the command buffer
-    BLT_CHK_STATUS_RETURN(m_osInterface->pfnSubmitCommandBuffer(m_osInterface, &cmdBuffer, false));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -35,6 +35,11 @@
 #include "media_copy.h"
 #include "media_copy_common.h"
 
+//!
+//! \brief  Max number of copies in one BLT command buffer
+//!
+#define BLT_MAX_COPY_NUM_PER_SUBMIT 32
+
 class BltStateNext
 {
 public:
@@ -85,6 +90,24 @@ public:
         PMOS_RESOURCE src,
         PMOS_RESOURCE dst);
 
+    //!
+    //! \brief    Copy main surface list
+    //! \details  BLT engine will copy each source surface to destination surface,
+    //!           copies are submitted in as few command buffers as possible
+    //! \param    src
+    //!           [in] Array of source resources
+    //! \param    dst
+    //!           [in] Array of destination resources
+    //! \param    copyNum
+    //!           [in] Number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS CopyMainSurfaceList(
+        PMOS_RESOURCE *src,
+        PMOS_RESOURCE *dst,
+        uint32_t       copyNum);
+
     //!
     //! \brief    Setup blt copy parameters
     //! \details  Setup blt copy parameters for BLT Engine
@@ -116,6 +139,34 @@ public:
     virtual MOS_STATUS SubmitCMD(
         PBLT_STATE_PARAM pBltStateParam);
 
+    //!
+    //! \brief    Submit command for copy list
+    //! \details  Submit BLT commands of all copies in one command buffer
+    //! \param    pBltStateParam
+    //!           [in] Pointer to BLT_STATE_PARAM array
+    //! \param    paramNum
+    //!           [in] Number of BLT_STATE_PARAM in array
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS SubmitCMD(
+        PBLT_STATE_PARAM pBltStateParam,
+        uint32_t         paramNum);
+
+    //!
+    //! \brief    Add copy commands
+    //! \details  Add BLT commands of one copy into command buffer
+    //! \param    cmdBuffer
+    //!           [in] Pointer to command buffer
+    //! \param    pBltStateParam
+    //!           [in] Pointer to BLT_STATE_PARAM
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS AddCopyCmds(
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        PBLT_STATE_PARAM    pBltStateParam);
+
     //!
     //! \brief    Get Block copy color depth.
     //! \details  get different format's color depth.
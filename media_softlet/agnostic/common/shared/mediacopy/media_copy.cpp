@@ -31,6 +31,7 @@
 #include "mhw_cp_interface.h"
 #include "mos_utilities.h"
 #include "mos_util_debug.h"
+#include <vector>
 
 MediaCopyBaseState::MediaCopyBaseState():
     m_osInterface(nullptr)
@@ -42,6 +43,23 @@ MediaCopyBaseState::~MediaCopyBaseState()
 {
     MOS_STATUS              eStatus;
 
+    const char *engineName[MCPY_ENGINE_NUM] = {"VeBox", "BLT", "Render"};
+    for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+    {
+        if (m_engineStats[i].copyCount || m_engineStats[i].failCount)
+        {
+            uint32_t samples = m_engineStats[i].busySampleCount;
+            MCPY_NORMALMESSAGE("Media Copy %s Engine: copies %d, failed %d, moved in by load %d, average busy cmd buffers %.2f in %d samples",
+                engineName[i], m_engineStats[i].copyCount, m_engineStats[i].failCount, m_engineStats[i].movedInCount,
+                samples ? (double)m_engineStats[i].busyCmdBufSum / samples : 0.0, samples);
+        }
+        if (m_engineStatsMutex[i])
+        {
+            MosUtilities::MosDestroyMutex(m_engineStatsMutex[i]);
+            m_engineStatsMutex[i] = nullptr;
+        }
+    }
+
     if (m_osInterface)
     {
         m_osInterface->pfnDestroy(m_osInterface, false);
@@ -78,10 +96,24 @@ MOS_STATUS MediaCopyBaseState::Initialize(PMOS_INTERFACE osInterface)
         m_inUseGPUMutex     = MosUtilities::MosCreateMutex();
         MCPY_CHK_NULL_RETURN(m_inUseGPUMutex);
     }
+    for (uint32_t i = 0; i < MCPY_ENGINE_NUM; i++)
+    {
+        if (m_engineStatsMutex[i] == nullptr)
+        {
+            m_engineStatsMutex[i] = MosUtilities::MosCreateMutex();
+            MCPY_CHK_NULL_RETURN(m_engineStatsMutex[i]);
+        }
+    }
     MCPY_CHK_NULL_RETURN(m_osInterface);
     Mos_SetVirtualEngineSupported(m_osInterface, true);
     m_osInterface->pfnVirtualEngineSupported(m_osInterface, true, true);
 
+    ReadUserSetting(
+        m_osInterface->pfnGetUserSettingInstance(m_osInterface),
+        m_loadBalanceEnabled,
+        __MEDIA_USER_FEATURE_VALUE_MCPY_LOAD_BALANCE_ENABLE,
+        MediaUserSetting::Group::Device);
+
    #if (_DEBUG || _RELEASE_INTERNAL)
     if (m_surfaceDumper == nullptr)
     {
@@ -209,6 +241,130 @@ MOS_STATUS MediaCopyBaseState::CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_E
     return MOS_STATUS_SUCCESS;
 }
 
+//!
+//! \brief    select copy engine by load
+//! \details  move copy from preferred engine to another supported engine, if the GPU context of
+//!           preferred one has clearly more submitted but not completed command buffers.
+//!           A copy method other than default needs a larger difference to be moved.
+//!           Only engines already used by this media copy are considered, as the GPU context
+//!           of the others does not exist yet. Engine stats are guarded by per engine mutex,
+//!           so the selection does not wait for copy submission on m_inUseGPUMutex.
+//! \param    preferEngine
+//!           [in] engine selected by copy method
+//! \param    caps
+//!           [in] reference of featue supported engine
+//! \param    explicitMethod
+//!           [in] true if engine is requested by a copy method other than default
+//! \return   MCPY_ENGINE
+//!           Return selected engine.
+//!
+MCPY_ENGINE MediaCopyBaseState::LoadBalanceEngineSelect(MCPY_ENGINE preferEngine, MCPY_ENGINE_CAPS &caps, bool explicitMethod)
+{
+    bool     supported[MCPY_ENGINE_NUM] = {caps.engineVebox ? true : false, caps.engineBlt ? true : false, caps.engineRender ? true : false};
+    uint32_t busyCount[MCPY_ENGINE_NUM] = {};
+
+    if ((uint32_t)preferEngine >= MCPY_ENGINE_NUM)
+    {
+        return preferEngine;
+    }
+
+    for (uint32_t engine = 0; engine < MCPY_ENGINE_NUM; engine++)
+    {
+        if (engine != (uint32_t)preferEngine && !supported[engine])
+        {
+            continue;
+        }
+
+        // GPU context of engine is created by its first copy, sample only engines used before.
+        MosUtilities::MosLockMutex(m_engineStatsMutex[engine]);
+        bool used = m_engineStats[engine].copyCount > 0;
+        if (used)
+        {
+            busyCount[engine] = GetEngineBusyCmdBufferCount((MCPY_ENGINE)engine);
+            m_engineStats[engine].busySampleCount++;
+            m_engineStats[engine].busyCmdBufSum += busyCount[engine];
+        }
+        MosUtilities::MosUnlockMutex(m_engineStatsMutex[engine]);
+        supported[engine] = used;
+    }
+
+    MCPY_ENGINE selected = preferEngine;
+    for (uint32_t engine = 0; engine < MCPY_ENGINE_NUM; engine++)
+    {
+        // Keep the preferred engine unless another one has at least two command buffers less in flight,
+        // a copy method asking for the engine keeps it unless the engine has twice the queue depth.
+        uint32_t threshold = explicitMethod ? busyCount[engine] * 2 + 1 : busyCount[engine] + 1;
+        if (engine != (uint32_t)preferEngine && supported[engine] && threshold < busyCount[selected])
+        {
+            selected = (MCPY_ENGINE)engine;
+        }
+    }
+
+    if (selected != preferEngine)
+    {
+        MosUtilities::MosLockMutex(m_engineStatsMutex[selected]);
+        m_engineStats[selected].movedInCount++;
+        MosUtilities::MosUnlockMutex(m_engineStatsMutex[selected]);
+        MCPY_NORMALMESSAGE("Media Copy moved from engine %d (%d busy cmd buffers) to engine %d (%d busy cmd buffers)",
+            preferEngine, busyCount[preferEngine], selected, busyCount[selected]);
+    }
+
+    return selected;
+}
+
+//!
+//! \brief    get engine queue depth
+//! \details  get number of command buffers submitted to engine GPU context but not completed by GPU.
+//!           The GPU context keeps the count at submission and retires completed command buffers
+//!           in order, so the query only checks the oldest in-flight ones.
+//! \param    mcpyEngine
+//!           [in] copy engine
+//! \return   uint32_t
+//!           Return busy command buffer count, 0 if engine GPU context is not created.
+//!
+uint32_t MediaCopyBaseState::GetEngineBusyCmdBufferCount(MCPY_ENGINE mcpyEngine)
+{
+    // GPU contexts used by MediaVeboxCopy, MediaBltCopy and MediaRenderCopy.
+    const MOS_GPU_CONTEXT gpuContext[MCPY_ENGINE_NUM] = {MOS_GPU_CONTEXT_VEBOX, MOS_GPU_CONTEXT_BLT, MOS_GPU_CONTEXT_COMPUTE};
+
+    if (m_osInterface == nullptr || (uint32_t)mcpyEngine >= MCPY_ENGINE_NUM)
+    {
+        return 0;
+    }
+
+    return MosInterface::GetGpuBusyCmdBufferCount(
+        m_osInterface->osStreamState,
+        m_osInterface->m_GpuContextHandleMap[gpuContext[mcpyEngine]]);
+}
+
+//!
+//! \brief    update engine statistics.
+//! \details  update copy count of engine after copy done.
+//! \param    mcpyEngine
+//!           [in] copy engine
+//! \param    status
+//!           [in] copy status
+//! \return   void
+//!
+void MediaCopyBaseState::UpdateEngineStats(MCPY_ENGINE mcpyEngine, MOS_STATUS status)
+{
+    if ((uint32_t)mcpyEngine >= MCPY_ENGINE_NUM)
+    {
+        return;
+    }
+
+    MosUtilities::MosLockMutex(m_engineStatsMutex[mcpyEngine]);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        m_engineStats[mcpyEngine].failCount++;
+    }
+    else
+    {
+        m_engineStats[mcpyEngine].copyCount++;
+    }
+    MosUtilities::MosUnlockMutex(m_engineStatsMutex[mcpyEngine]);
+}
+
 uint32_t GetMinRequiredSurfaceSizeInBytes(uint32_t pitch, uint32_t height, MOS_FORMAT format)
 {
     uint32_t nBytes = 0;
@@ -288,13 +444,124 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
+    MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+    MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+    MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
+
+    MCPY_CHK_STATUS_RETURN(PrepareCopy(src, dst, preferMethod, mcpySrc, mcpyDst, mcpyEngine));
+
+    MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
+
+    return eStatus;
+}
+
+//!
+//! \brief    surface copy list func.
+//! \details  copy each source surface to destination surface in list order, consecutive
+//!           copies selecting BLT engine are submitted together where the engine supports it.
+//! \param    src
+//!           [in] Array of source surfaces
+//! \param    dst
+//!           [in] Array of destination surfaces
+//! \param    copyNum
+//!           [in] Number of copies
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+//!
+MOS_STATUS MediaCopyBaseState::SurfaceCopyList(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t copyNum, MCPY_METHOD preferMethod)
+{
+    MCPY_CHK_NULL_RETURN(src);
+    MCPY_CHK_NULL_RETURN(dst);
+
+    if (copyNum == 1)
+    {
+        return SurfaceCopy(src[0], dst[0], preferMethod);
+    }
+
+    std::vector<PMOS_RESOURCE> bltSrc;
+    std::vector<PMOS_RESOURCE> bltDst;
+
+    // Submit the pending run of BLT copies, so copies are executed in list order.
+    auto flushBltCopies = [&]() -> MOS_STATUS {
+        if (bltSrc.empty())
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        MosUtilities::MosLockMutex(m_inUseGPUMutex);
+        MOS_STATUS eStatus = MediaBltCopyList(bltSrc.data(), bltDst.data(), (uint32_t)bltSrc.size());
+        UpdateEngineStats(MCPY_ENGINE_BLT, eStatus);
+        MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
+
+        MCPY_NORMALMESSAGE("Media Copy works on BLT Engine for %d copies", (uint32_t)bltSrc.size());
+        bltSrc.clear();
+        bltDst.clear();
+        return eStatus;
+    };
+
+    for (uint32_t i = 0; i < copyNum; i++)
+    {
+        MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+        MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+        MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
+
+        MCPY_CHK_NULL_RETURN(src[i]);
+        MCPY_CHK_NULL_RETURN(dst[i]);
+        MCPY_CHK_STATUS_RETURN(PrepareCopy(src[i], dst[i], preferMethod, mcpySrc, mcpyDst, mcpyEngine));
+
+        bool batched = (mcpyEngine == MCPY_ENGINE_BLT);
+#if (_DEBUG || _RELEASE_INTERNAL)
+        // Keep surface dump of each copy.
+        batched = batched && (m_surfaceDumper == nullptr);
+#endif
+        if (!batched)
+        {
+            // Copies after a BLT run may depend on it, e.g. read its destination.
+            MCPY_CHK_STATUS_RETURN(flushBltCopies());
+            MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
+            continue;
+        }
+
+        if ((mcpySrc.TileMode != MOS_TILE_LINEAR) && (mcpySrc.CompressionMode != MOS_MMC_DISABLED))
+        {
+            MCPY_NORMALMESSAGE("mmc on, mcpySrc.TileMode= %d, mcpySrc.CompressionMode = %d", mcpySrc.TileMode, mcpySrc.CompressionMode);
+            MosUtilities::MosLockMutex(m_inUseGPUMutex);
+            MOS_STATUS eStatus = m_osInterface->pfnDecompResource(m_osInterface, mcpySrc.OsRes);
+            MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
+            MCPY_CHK_STATUS_RETURN(eStatus);
+        }
+        bltSrc.push_back(mcpySrc.OsRes);
+        bltDst.push_back(mcpyDst.OsRes);
+    }
+
+    return flushBltCopies();
+}
+
+//!
+//! \brief    prepare surface copy.
+//! \details  check surfaces and copy capability, then select copy engine.
+//! \param    src
+//!           [in] Pointer to source surface
+//! \param    dst
+//!           [in] Pointer to destination surface
+//! \param    preferMethod
+//!           [in] copy method
+//! \param    mcpySrc
+//!           [out] Media copy state's input parmaters
+//! \param    mcpyDst
+//!           [out] Media copy state's output parmaters
+//! \param    mcpyEngine
+//!           [out] selected copy engine
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+//!
+MOS_STATUS MediaCopyBaseState::PrepareCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst, MCPY_METHOD preferMethod,
+    MCPY_STATE_PARAMS &mcpySrc, MCPY_STATE_PARAMS &mcpyDst, MCPY_ENGINE &mcpyEngine)
+{
     MOS_SURFACE ResDetails;
     MOS_ZeroMemory(&ResDetails, sizeof(MOS_SURFACE));
     ResDetails.Format = Format_Invalid;
 
-    MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
-    MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
-    MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
     MCPY_ENGINE_CAPS      mcpyEngineCaps = {1, 1, 1, 1};
     MCPY_CHK_STATUS_RETURN(m_osInterface->pfnGetResourceInfo(m_osInterface, src, &ResDetails));
     MCPY_CHK_STATUS_RETURN(m_osInterface->pfnGetMemoryCompressionMode(m_osInterface, src, (PMOS_MEMCOMP_STATE)&(mcpySrc.CompressionMode)));
@@ -338,9 +605,22 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 
     CopyEnigneSelect(preferMethod, mcpyEngine, mcpyEngineCaps);
 
-    MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
+    bool loadBalance = m_loadBalanceEnabled;
+#if (_DEBUG || _RELEASE_INTERNAL)
+    loadBalance = loadBalance && (m_MCPYForceMode == 0);
+#endif
+    if (loadBalance)
+    {
+        // Blt engine does not support protection, don't move protected copy to it.
+        MCPY_ENGINE_CAPS balanceCaps = mcpyEngineCaps;
+        if (mcpySrc.CpMode == MCPY_CPMODE_CP && !m_allowCPBltCopy)
+        {
+            balanceCaps.engineBlt = false;
+        }
+        mcpyEngine = LoadBalanceEngineSelect(mcpyEngine, balanceCaps, preferMethod != MCPY_METHOD_DEFAULT);
+    }
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STATE_PARAMS mcpyDst, MCPY_ENGINE mcpyEngine)
@@ -401,6 +681,7 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
                 eStatus = m_osInterface->pfnDecompResource(m_osInterface, mcpySrc.OsRes);
                 if (MOS_STATUS_SUCCESS != eStatus)
                 {
+                    UpdateEngineStats(mcpyEngine, eStatus);
                     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
                     MCPY_CHK_STATUS_RETURN(eStatus);
                 }
@@ -413,6 +694,7 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
         default:
             break;
     }
+    UpdateEngineStats(mcpyEngine, eStatus);
     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
 
 #if (_DEBUG || _RELEASE_INTERNAL)
@@ -54,6 +54,20 @@ enum MCPY_ENGINE
     MCPY_ENGINE_RENDER,
 };
 
+//!
+//! \brief  Per engine statistics of media copy
+//!
+typedef struct _MCPY_ENGINE_STATS
+{
+    uint32_t copyCount;        // copies done on engine
+    uint32_t failCount;        // copies failed on engine
+    uint32_t movedInCount;     // copies moved to engine by load balance
+    uint32_t busySampleCount;  // samples of engine GPU queue depth taken by load balance
+    uint64_t busyCmdBufSum;    // sum of busy command buffers in the samples
+}MCPY_ENGINE_STATS;
+
+#define MCPY_ENGINE_NUM 3
+
 enum MCPY_CPMODE
 {
     MCPY_CPMODE_CP = 0,
@@ -139,6 +153,21 @@ public:
     //!
     virtual MOS_STATUS SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst, MCPY_METHOD preferMethod = MCPY_METHOD_PERFORMANCE);
 
+    //!
+    //! \brief    surface copy list func.
+    //! \details  copy each source surface to destination surface in list order, consecutive
+    //!           copies selecting BLT engine are submitted together where the engine supports it.
+    //! \param    src
+    //!           [in] Array of source surfaces
+    //! \param    dst
+    //!           [in] Array of destination surfaces
+    //! \param    copyNum
+    //!           [in] Number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS SurfaceCopyList(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t copyNum, MCPY_METHOD preferMethod = MCPY_METHOD_PERFORMANCE);
+
     //!
     //! \brief    aux surface copy.
     //! \details  copy surface.
@@ -154,6 +183,27 @@ public:
 
 protected:
 
+    //!
+    //! \brief    prepare surface copy.
+    //! \details  check surfaces and copy capability, then select copy engine.
+    //! \param    src
+    //!           [in] Pointer to source surface
+    //! \param    dst
+    //!           [in] Pointer to destination surface
+    //! \param    preferMethod
+    //!           [in] copy method
+    //! \param    mcpySrc
+    //!           [out] Media copy state's input parmaters
+    //! \param    mcpyDst
+    //!           [out] Media copy state's output parmaters
+    //! \param    mcpyEngine
+    //!           [out] selected copy engine
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    MOS_STATUS PrepareCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst, MCPY_METHOD preferMethod,
+        MCPY_STATE_PARAMS &mcpySrc, MCPY_STATE_PARAMS &mcpyDst, MCPY_ENGINE &mcpyEngine);
+
     //!
     //! \brief    dispatch copy task if support.
     //! \details  dispatch copy task to HW engine (vebox, EU, Blt) based on customer and default.
@@ -226,6 +276,48 @@ protected:
     //!
     MOS_STATUS CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_ENGINE& mcpyEngine, MCPY_ENGINE_CAPS& caps);
 
+    //!
+    //! \brief    select copy engine by load
+    //! \details  move copy from preferred engine to another supported engine, if the GPU context of
+    //!           preferred one has clearly more submitted but not completed command buffers.
+    //!           A copy method other than default needs a larger difference to be moved.
+    //!           Only engines already used by this media copy are considered, as the GPU context
+    //!           of the others does not exist yet. Engine stats are guarded by per engine mutex,
+    //!           so the selection does not wait for copy submission on m_inUseGPUMutex.
+    //! \param    preferEngine
+    //!           [in] engine selected by copy method
+    //! \param    caps
+    //!           [in] reference of featue supported engine
+    //! \param    explicitMethod
+    //!           [in] true if engine is requested by a copy method other than default
+    //! \return   MCPY_ENGINE
+    //!           Return selected engine.
+    //!
+    MCPY_ENGINE LoadBalanceEngineSelect(MCPY_ENGINE preferEngine, MCPY_ENGINE_CAPS &caps, bool explicitMethod);
+
+    //!
+    //! \brief    get engine queue depth
+    //! \details  get number of command buffers submitted to engine GPU context but not completed by GPU.
+    //!           The GPU context keeps the count at submission and retires completed command buffers
+    //!           in order, so the query only checks the oldest in-flight ones.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \return   uint32_t
+    //!           Return busy command buffer count, 0 if engine GPU context is not created.
+    //!
+    virtual uint32_t GetEngineBusyCmdBufferCount(MCPY_ENGINE mcpyEngine);
+
+    //!
+    //! \brief    update engine statistics.
+    //! \details  update copy count of engine after copy done.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \param    status
+    //!           [in] copy status
+    //! \return   void
+    //!
+    void UpdateEngineStats(MCPY_ENGINE mcpyEngine, MOS_STATUS status);
+
     //!
     //! \brief    use blt engie to do surface copy.
     //! \details  implementation media blt copy.
@@ -239,6 +331,31 @@ protected:
     virtual MOS_STATUS MediaBltCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
     {return MOS_STATUS_SUCCESS;}
 
+    //!
+    //! \brief    use blt engie to do surface copy list.
+    //! \details  implementation media blt copy list, copy one by one if not batched on platform.
+    //! \param    src
+    //!           [in] Array of source surfaces
+    //! \param    dst
+    //!           [in] Array of destination surfaces
+    //! \param    copyNum
+    //!           [in] Number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS MediaBltCopyList(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t copyNum)
+    {
+        for (uint32_t i = 0; i < copyNum; i++)
+        {
+            MOS_STATUS status = MediaBltCopy(src[i], dst[i]);
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return MOS_STATUS_SUCCESS;
+    }
+
     //!
     //! \brief    use Render engie to do surface copy.
     //! \details  implementation media Render copy.
@@ -275,7 +392,12 @@ public:
 
 
 protected:
+    // All engines submit through the shared m_osInterface and switch its current GPU context,
+    // so submission is serialized. Engine selection and stats only take the per engine mutex.
     PMOS_MUTEX           m_inUseGPUMutex = nullptr; // Mutex for in-use GPU context
+    bool                 m_loadBalanceEnabled = false;
+    MCPY_ENGINE_STATS    m_engineStats[MCPY_ENGINE_NUM] = {};
+    PMOS_MUTEX           m_engineStatsMutex[MCPY_ENGINE_NUM] = {}; // Mutex for m_engineStats of each engine
 MEDIA_CLASS_DEFINE_END(MediaCopyBaseState)
 };
 #endif
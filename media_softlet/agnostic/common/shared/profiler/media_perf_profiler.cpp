@@ -26,6 +26,7 @@
 //!
 
 #include <stddef.h>
+#include <chrono>
 #include "media_perf_profiler.h"
 #include "media_skuwa_specific.h"
 #include "mhw_itf.h"
@@ -124,6 +125,8 @@ struct NodeHeader
     }                                              \
 }
 
+const uint32_t MediaPerfProfiler::m_streamPeriodMs;
+
 MediaPerfProfiler::MediaPerfProfiler()
 {
     m_perfStoreBufferMap.clear();
@@ -151,6 +154,15 @@ MediaPerfProfiler::MediaPerfProfiler()
 
 MediaPerfProfiler::~MediaPerfProfiler()
 {
+    StopStreaming();
+
+    if (m_streamFile != nullptr)
+    {
+        fprintf(m_streamFile, "\n]\n");
+        fclose(m_streamFile);
+        m_streamFile = nullptr;
+    }
+
     if (m_mutex != nullptr)
     {
         MosUtilities::MosDestroyMutex(m_mutex);
@@ -199,7 +211,21 @@ void MediaPerfProfiler::Destroy(MediaPerfProfiler* profiler, void* context, MOS_
     {
         if (profiler->m_initializedMap[pOsContext] == true)
         {
-            if(profiler->m_enableProfilerDump)
+            auto streamIter = profiler->m_streamContextMap.find(pOsContext);
+            if (streamIter != profiler->m_streamContextMap.end())
+            {
+                // All commands are completed, drain the remaining nodes before releasing buffer
+                std::string events;
+                profiler->DrainStream(pOsContext, streamIter->second, events);
+                profiler->WriteStream(events);
+
+                osInterface->pfnUnlockResource(
+                    osInterface,
+                    profiler->m_perfStoreBufferMap[pOsContext]);
+
+                profiler->m_streamContextMap.erase(streamIter);
+            }
+            else if(profiler->m_enableProfilerDump)
             {
                 profiler->SavePerfData(osInterface);
             }
@@ -271,6 +297,14 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
         return status;
     }
 
+    // Read timeline file name, streaming mode is enabled when it is set
+    ReadUserSetting(
+        userSettingPtr,
+        m_streamFileName,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_TIMELINE_FILE_NAME,
+        MediaUserSetting::Group::Device);
+    m_streamFileName = m_streamFileName.c_str();
+
     // Read buffer size
     ReadUserSetting(
             userSettingPtr,
@@ -360,6 +394,11 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
             osInterface,
             pPerfStoreBuffer);
 
+    if (!m_streamFileName.empty())
+    {
+        CHK_STATUS_UNLOCK_MUTEX_RETURN(InitStreaming(osInterface, pPerfStoreBuffer));
+    }
+
     m_initializedMap[pOsContext] = true;
 
     MosUtilities::MosUnlockMutex(m_mutex);
@@ -367,6 +406,222 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS MediaPerfProfiler::InitStreaming(MOS_INTERFACE *osInterface, PMOS_RESOURCE perfStoreBuffer)
+{
+    CHK_NULL_RETURN(osInterface);
+    CHK_NULL_RETURN(perfStoreBuffer);
+
+    if (m_bufferSize < sizeof(NodeHeader) + 2 * sizeof(PerfEntry))
+    {
+        MOS_OS_ASSERTMESSAGE("Perf store buffer is too small for streaming!");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    // Keep one spare entry since end timestamp of the last node is 8 bytes aligned
+    m_streamNodeNum = (m_bufferSize - sizeof(NodeHeader)) / sizeof(PerfEntry) - 1;
+
+    // Open the timeline file first, nothing is left mapped or registered if it fails
+    {
+        std::lock_guard<std::mutex> lock(m_streamFileMutex);
+        if (m_streamFile == nullptr)
+        {
+            std::string fileName = m_streamFileName;
+            if (m_multiprocess)
+            {
+                fileName += "-pid" + std::to_string(MosUtilities::MosGetPid()) + ".json";
+            }
+
+            if (MosUtilities::MosSecureFileOpen(&m_streamFile, fileName.c_str(), "w") != MOS_STATUS_SUCCESS ||
+                m_streamFile == nullptr)
+            {
+                m_streamFile = nullptr;
+                MOS_OS_ASSERTMESSAGE("Failed to open perf timeline file %s!", fileName.c_str());
+                return MOS_STATUS_FILE_OPEN_FAILED;
+            }
+
+            // Chrome trace JSON array format, the closing bracket is optional for trace viewers
+            int32_t pid = MosUtilities::MosGetPid();
+            fprintf(m_streamFile, "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Media Driver\"}}", pid);
+            fprintf(m_streamFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"CPU Submit\"}}", pid);
+            const char *nodeNames[] = {"GPU 3D", "GPU Video", "GPU BLT", "GPU VE", "GPU Video2"};
+            for (uint32_t node = PERF_GPU_NODE_3D; node <= PERF_GPU_NODE_VIDEO2; node++)
+            {
+                fprintf(m_streamFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", pid, 1000 + node, nodeNames[node]);
+            }
+            fflush(m_streamFile);
+        }
+    }
+
+    // Keep the buffer mapped, so that background reader does not depend on lifetime of OS interface
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    lockFlags.NoOverWrite = 1;
+
+    uint8_t *data = (uint8_t *)osInterface->pfnLockResource(
+        osInterface,
+        perfStoreBuffer,
+        &lockFlags);
+    CHK_NULL_RETURN(data);
+
+    StreamContext &stream = m_streamContextMap[osInterface->pOsContext];
+    stream.data           = data;
+    stream.readSeq        = m_perfDataIndexMap[osInterface->pOsContext];
+    stream.clockOffsetSet = false;
+    stream.records.assign(m_streamNodeNum, StreamNodeRecord());
+
+    std::lock_guard<std::mutex> lock(m_streamThreadMutex);
+    if (!m_streamThread.joinable())
+    {
+        m_streamThreadStop = false;
+        m_streamThread     = std::thread(&MediaPerfProfiler::StreamThreadProc, this);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void MediaPerfProfiler::DrainStream(PMOS_CONTEXT pOsContext, StreamContext &stream, std::string &events)
+{
+    if (stream.data == nullptr || m_streamNodeNum == 0)
+    {
+        return;
+    }
+
+    uint32_t writeSeq = m_perfDataIndexMap[pOsContext];
+    int32_t  pid      = MosUtilities::MosGetPid();
+    char     event[512];
+
+    while (stream.readSeq != writeSeq)
+    {
+        // Nodes older than one ring have been overwritten by later submissions
+        if (writeSeq - stream.readSeq > m_streamNodeNum)
+        {
+            m_streamDroppedNum += writeSeq - stream.readSeq - m_streamNodeNum;
+            stream.readSeq      = writeSeq - m_streamNodeNum;
+        }
+
+        uint32_t         slot       = stream.readSeq % m_streamNodeNum;
+        StreamNodeRecord &record    = stream.records[slot];
+        // Same alignment as AddPerfCollectStartCmd and AddPerfCollectEndCmd
+        volatile uint64_t *beginClock = (volatile uint64_t *)(stream.data +
+            MOS_ALIGN_CEIL(BASE_OF_NODE(slot) + OFFSET_OF(PerfEntry, beginTimeClockValue), 8));
+        volatile uint64_t *endClock   = (volatile uint64_t *)(stream.data +
+            MOS_ALIGN_CEIL(BASE_OF_NODE(slot) + OFFSET_OF(PerfEntry, endTimeClockValue), 8));
+        uint64_t         gpuBegin   = *beginClock;
+        uint64_t         gpuEnd     = *endClock;
+
+        if (!record.valid || record.seq != stream.readSeq || gpuBegin == 0 || gpuEnd < gpuBegin)
+        {
+            // Wait for GPU, unless the node is far behind, e.g. its command buffer was never submitted
+            if (writeSeq - stream.readSeq < m_streamNodeNum / 2)
+            {
+                break;
+            }
+            m_streamDroppedNum++;
+            stream.readSeq++;
+            continue;
+        }
+
+        uint64_t flowId = ++m_streamFlowId;
+        MOS_SecureStringPrint(event, sizeof(event), sizeof(event),
+            ",\n{\"name\":\"Submit 0x%x\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":%d,\"tid\":0,\"ts\":%llu,\"dur\":%llu,\"args\":{\"seq\":%u}}"
+            ",\n{\"name\":\"submit\",\"cat\":\"flow\",\"ph\":\"s\",\"id\":%llu,\"pid\":%d,\"tid\":0,\"ts\":%llu}",
+            record.perfTag, pid, (unsigned long long)record.cpuBeginUs, (unsigned long long)(record.cpuEndUs - record.cpuBeginUs), record.seq,
+            (unsigned long long)flowId, pid, (unsigned long long)record.cpuBeginUs);
+        events += event;
+
+        if (m_timerBase != 0)
+        {
+            double gpuBeginUs = (double)gpuBegin * 1000000.0 / m_timerBase;
+            double gpuDurUs   = (double)(gpuEnd - gpuBegin) * 1000000.0 / m_timerBase;
+
+            // GPU starts no earlier than CPU adds the start command, so the largest
+            // difference seen so far is the tightest estimation of clock offset.
+            int64_t offset = (int64_t)record.cpuBeginUs - (int64_t)gpuBeginUs;
+            if (!stream.clockOffsetSet || offset > stream.clockOffsetUs)
+            {
+                stream.clockOffsetUs  = offset;
+                stream.clockOffsetSet = true;
+            }
+            double ts = gpuBeginUs + stream.clockOffsetUs;
+
+            MOS_SecureStringPrint(event, sizeof(event), sizeof(event),
+                ",\n{\"name\":\"GPU 0x%x\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"seq\":%u,\"context\":\"%p\"}}"
+                ",\n{\"name\":\"submit\",\"cat\":\"flow\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%llu,\"pid\":%d,\"tid\":%u,\"ts\":%.3f}",
+                record.perfTag, pid, 1000 + record.gpuNode, ts, gpuDurUs, record.seq, pOsContext,
+                (unsigned long long)flowId, pid, 1000 + record.gpuNode, ts);
+            events += event;
+        }
+
+        *beginClock  = 0;
+        *endClock    = 0;
+        record.valid = false;
+        stream.readSeq++;
+    }
+}
+
+void MediaPerfProfiler::WriteStream(const std::string &events)
+{
+    if (events.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_streamFileMutex);
+    if (m_streamFile != nullptr)
+    {
+        fwrite(events.data(), 1, events.size(), m_streamFile);
+        fflush(m_streamFile);
+    }
+}
+
+void MediaPerfProfiler::FlushStream()
+{
+    std::string events;
+
+    MosUtilities::MosLockMutex(m_mutex);
+    for (auto &stream : m_streamContextMap)
+    {
+        DrainStream(stream.first, stream.second, events);
+    }
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    WriteStream(events);
+}
+
+void MediaPerfProfiler::StreamThreadProc()
+{
+    std::unique_lock<std::mutex> lock(m_streamThreadMutex);
+    while (!m_streamThreadStop)
+    {
+        m_streamThreadCond.wait_for(lock, std::chrono::milliseconds(m_streamPeriodMs), [this] { return m_streamThreadStop; });
+        if (m_streamThreadStop)
+        {
+            break;
+        }
+        lock.unlock();
+        FlushStream();
+        lock.lock();
+    }
+}
+
+void MediaPerfProfiler::StopStreaming()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_streamThreadMutex);
+        m_streamThreadStop = true;
+    }
+    m_streamThreadCond.notify_all();
+
+    if (m_streamThread.joinable())
+    {
+        m_streamThread.join();
+    }
+
+    if (m_streamDroppedNum != 0)
+    {
+        MOS_OS_NORMALMESSAGE("Perf timeline dropped %d nodes overwritten before drained.", m_streamDroppedNum);
+    }
+}
+
 MOS_STATUS MediaPerfProfiler::StoreData(
     std::shared_ptr<mhw::mi::Itf> miItf,
     PMOS_COMMAND_BUFFER           cmdBuffer,
@@ -479,6 +734,21 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectStartCmd(
 
     perfDataIndex = m_perfDataIndexMap[pOsContext];
     m_perfDataIndexMap[pOsContext]++;
+
+    auto streamIter = m_streamContextMap.find(pOsContext);
+    if (streamIter != m_streamContextMap.end())
+    {
+        // Perf store buffer is used as ring in streaming mode, the oldest node is overwritten
+        StreamNodeRecord &record = streamIter->second.records[perfDataIndex % m_streamNodeNum];
+        record.seq        = perfDataIndex;
+        record.cpuBeginUs = MosUtilities::MosGetCurTime();
+        record.cpuEndUs   = record.cpuBeginUs;
+        record.perfTag    = osInterface->pfnGetPerfTag(osInterface);
+        record.gpuNode    = GpuContextToGpuNode(osInterface->pfnGetGpuContext(osInterface));
+        record.valid      = true;
+        perfDataIndex %= m_streamNodeNum;
+    }
+
     m_contextIndexMap[context] = perfDataIndex;
 
     MosUtilities::MosUnlockMutex(m_mutex);
@@ -604,6 +874,17 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectEndCmd(
 
     perfDataIndex = m_contextIndexMap[context];
 
+    if (m_streamNodeNum != 0)
+    {
+        MosUtilities::MosLockMutex(m_mutex);
+        auto streamIter = m_streamContextMap.find(pOsContext);
+        if (streamIter != m_streamContextMap.end() && perfDataIndex < m_streamNodeNum)
+        {
+            streamIter->second.records[perfDataIndex].cpuEndUs = MosUtilities::MosGetCurTime();
+        }
+        MosUtilities::MosUnlockMutex(m_mutex);
+    }
+
     int8_t regIndex = 0;
     for (regIndex = 0; regIndex < 8; regIndex++)
     {
@@ -29,7 +29,13 @@
 #include <map>
 #include <unordered_map>
 #include <stdint.h>
+#include <stdio.h>
 #include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "mos_defs.h"
 #include "mos_os.h"
 #include "media_class_trace.h"
@@ -149,7 +155,7 @@ public:
     //!
     virtual ~MediaPerfProfiler();
 
-private:
+protected:
     //!
     //! \brief    Save data to the buffer which store the performance data
     //!
@@ -282,6 +288,90 @@ private:
     //!
     uint32_t PlatFormIdMap(PLATFORM platform);
 
+    //!
+    //! \brief    Host side record of one perf node in streaming mode
+    //!
+    struct StreamNodeRecord
+    {
+        uint32_t seq        = 0;        //!< Sequence number of the node, to detect overwritten slot
+        uint64_t cpuBeginUs = 0;        //!< CPU time when start command is added
+        uint64_t cpuEndUs   = 0;        //!< CPU time when end command is added
+        uint32_t perfTag    = 0;        //!< Perf tag of the submission
+        uint32_t gpuNode    = 0;        //!< GPU node of the submission
+        bool     valid      = false;    //!< Record is in use
+    };
+
+    //!
+    //! \brief    Streaming state of one device context
+    //!
+    struct StreamContext
+    {
+        uint8_t                        *data          = nullptr;  //!< Persistent CPU mapping of perf store buffer
+        uint32_t                       readSeq        = 0;        //!< Sequence number of next node to drain
+        int64_t                        clockOffsetUs  = 0;        //!< Offset from GPU clock to CPU clock in us
+        bool                           clockOffsetSet = false;    //!< Whether clockOffsetUs is valid
+        std::vector<StreamNodeRecord>  records;                   //!< Host records indexed by ring slot
+    };
+
+    //!
+    //! \brief    Initialize streaming mode for device context
+    //!
+    //! \param    [in] osInterface
+    //!           Pointer of OS interface
+    //! \param    [in] perfStoreBuffer
+    //!           Perf store buffer of device context
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS InitStreaming(MOS_INTERFACE *osInterface, PMOS_RESOURCE perfStoreBuffer);
+
+    //!
+    //! \brief    Drain completed nodes of device context into timeline events,
+    //!           m_mutex must be held by caller
+    //!
+    //! \param    [in] pOsContext
+    //!           Device context
+    //! \param    [in,out] stream
+    //!           Streaming state of device context
+    //! \param    [out] events
+    //!           Chrome trace events appended
+    //!
+    //! \return   void
+    //!
+    void DrainStream(PMOS_CONTEXT pOsContext, StreamContext &stream, std::string &events);
+
+    //!
+    //! \brief    Drain all device contexts and append events to timeline file
+    //!
+    //! \return   void
+    //!
+    void FlushStream();
+
+    //!
+    //! \brief    Append timeline events to timeline file
+    //!
+    //! \param    [in] events
+    //!           Chrome trace events
+    //!
+    //! \return   void
+    //!
+    void WriteStream(const std::string &events);
+
+    //!
+    //! \brief    Background reader which periodically flushes timeline
+    //!
+    //! \return   void
+    //!
+    void StreamThreadProc();
+
+    //!
+    //! \brief    Stop background reader
+    //!
+    //! \return   void
+    //!
+    void StopStreaming();
+
     //!
     //! \brief    Save data to the buffer which store the performance data 
     //!
@@ -505,7 +595,7 @@ public:
         MhwMiInterface *miInterface,
         MOS_COMMAND_BUFFER *cmdBuffer);
 
-private:
+protected:
     std::unordered_map<PMOS_CONTEXT, PMOS_RESOURCE>  m_perfStoreBufferMap;   //!< Buffer for perf data collection
     std::unordered_map<PMOS_CONTEXT,uint32_t>        m_refMap;               //!< The number of refereces
     std::unordered_map<PMOS_CONTEXT,uint32_t>        m_perfDataIndexMap;     //!< The index of performance data node in buffer
@@ -534,6 +624,19 @@ private:
     uint32_t                      m_perfDataCombinedSize = 0;    //!< Combined perf data size
     uint32_t                      m_perfDataCombinedIndex = 0;   //!< Combined perf data index
     uint32_t                      m_perfDataCombinedOffset = 0;  //!< Combined perf data offset
+
+    std::unordered_map<PMOS_CONTEXT, StreamContext> m_streamContextMap;  //!< Streaming state of device contexts
+    std::string                   m_streamFileName = "";         //!< Timeline file, streaming mode is enabled if not empty
+    FILE                          *m_streamFile = nullptr;       //!< Timeline file handle
+    std::mutex                    m_streamFileMutex;             //!< Mutex for timeline file writing
+    uint32_t                      m_streamNodeNum = 0;           //!< Number of nodes in ring buffer
+    uint32_t                      m_streamDroppedNum = 0;        //!< Number of nodes overwritten before drained
+    uint64_t                      m_streamFlowId = 0;            //!< Id of flow event from CPU submit to GPU span
+    std::thread                   m_streamThread;                //!< Background reader
+    std::mutex                    m_streamThreadMutex;           //!< Mutex for background reader wakeup
+    std::condition_variable       m_streamThreadCond;            //!< Condition for background reader wakeup
+    bool                          m_streamThreadStop = false;    //!< Request to stop background reader
+    static const uint32_t         m_streamPeriodMs = 100;        //!< Period of background reader
 MEDIA_CLASS_DEFINE_END(MediaPerfProfiler)
 };
 
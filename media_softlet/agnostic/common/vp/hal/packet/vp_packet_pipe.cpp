@@ -263,7 +263,7 @@ MOS_STATUS PacketPipe::SwitchContext(PacketType type, MediaScalability *&scalabi
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS PacketPipe::Execute(MediaStatusReport *statusReport, MediaScalability *&scalability, MediaContext *mediaContext, bool bEnableVirtualEngine, uint8_t numVebox)
+MOS_STATUS PacketPipe::Execute(MediaStatusReport *statusReport, MediaScalability *&scalability, MediaContext *mediaContext, bool bEnableVirtualEngine, uint8_t numVebox, bool deferSubmit)
 {
     VP_FUNC_CALL();
 
@@ -283,7 +283,8 @@ MOS_STATUS PacketPipe::Execute(MediaStatusReport *statusReport, MediaScalability
         PacketProperty prop  = {};
         prop.packetId        = pPacket->GetPacketId();
         prop.packet          = pPacket;
-        prop.immediateSubmit = true;
+        // Packet being deferred will be submitted along with other packets in task by VpPipeline::FlushScalingLadder.
+        prop.immediateSubmit = !deferSubmit;
         prop.stateProperty.statusReport = statusReport;
 
         bool isSkip = false;
@@ -308,6 +309,10 @@ MOS_STATUS PacketPipe::Execute(MediaStatusReport *statusReport, MediaScalability
             VP_PUBLIC_NORMALMESSAGE("Execute Packet %p.", pPacket);
             VP_PUBLIC_CHK_STATUS_RETURN(pTask->Submit(true, scalability, nullptr));
         }
+        else
+        {
+            VP_PUBLIC_NORMALMESSAGE("Defer submission of Packet %p.", pPacket);
+        }
 
 #if USE_MEDIA_DEBUG_TOOL
         for (auto& handle : pPacket->GetSurfSetting().surfGroup)
@@ -370,7 +375,68 @@ void PacketPipeFactory::ReturnPacketPipe(PacketPipe *&pPipe)
     {
         return;
     }
+    if (pPipe->m_submitPending)
+    {
+        // Packets are still in command task. Pipe will be returned by DeferredPacketPipes::Release.
+        VP_PUBLIC_NORMALMESSAGE("Defer returning packet pipe %p until being submitted.", pPipe);
+        pPipe->m_returnPending = true;
+        pPipe = nullptr;
+        return;
+    }
     pPipe->Clean();
     m_Pool.push_back(pPipe);
     pPipe = nullptr;
+}
+
+/****************************************************************************************************/
+/*                                      DeferredPacketPipes                                         */
+/****************************************************************************************************/
+
+DeferredPacketPipes::DeferredPacketPipes(PacketPipeFactory &packetPipeFactory) : m_packetPipeFactory(packetPipeFactory)
+{
+}
+
+DeferredPacketPipes::~DeferredPacketPipes()
+{
+    Release();
+}
+
+MOS_STATUS DeferredPacketPipes::Add(PacketPipe *pipe, bool owned, const Output &output)
+{
+    VP_FUNC_CALL();
+    VP_PUBLIC_CHK_NULL_RETURN(pipe);
+
+    if (pipe->m_submitPending)
+    {
+        // Packets of one pipe can only be added to command task once before submission.
+        VP_PUBLIC_ASSERTMESSAGE("Packet pipe %p has been deferred.", pipe);
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    pipe->m_submitPending = true;
+    pipe->m_returnPending = false;
+    m_pipes.push_back(pipe);
+    m_owned.push_back(owned);
+    m_outputs.push_back(output);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void DeferredPacketPipes::Release()
+{
+    VP_FUNC_CALL();
+
+    for (uint32_t i = 0; i < m_pipes.size(); ++i)
+    {
+        PacketPipe *pipe = m_pipes[i];
+        pipe->m_submitPending = false;
+        if (m_owned[i] || pipe->m_returnPending)
+        {
+            pipe->m_returnPending = false;
+            m_packetPipeFactory.ReturnPacketPipe(pipe);
+        }
+    }
+    m_pipes.clear();
+    m_owned.clear();
+    m_outputs.clear();
 }
\ No newline at end of file
@@ -81,7 +81,7 @@ public:
     virtual ~PacketPipe();
     MOS_STATUS Clean();
     MOS_STATUS AddPacket(HwFilter &hwFilter);
-    MOS_STATUS Execute(MediaStatusReport *statusReport, MediaScalability *&scalability, MediaContext *mediaContext, bool bEnableVirtualEngine, uint8_t numVebox);
+    MOS_STATUS Execute(MediaStatusReport *statusReport, MediaScalability *&scalability, MediaContext *mediaContext, bool bEnableVirtualEngine, uint8_t numVebox, bool deferSubmit = false);
     VPHAL_OUTPUT_PIPE_MODE GetOutputPipeMode()
     {
         return m_outputPipeMode;
@@ -97,11 +97,33 @@ public:
         return m_Pipe.size();
     }
 
+    //!
+    //! \brief  Check whether the submission of current pipe can be deferred and
+    //!         combined with other pipes into one command buffer.
+    //! \details Only single vebox packet pipe is supported, whose states are packed
+    //!         in vebox heap per packet instead of being shared by the pipe.
+    //! \return bool
+    //!         true if the submission can be deferred
+    //!
+    bool IsSubmitDeferrable()
+    {
+        return 1 == m_Pipe.size() && m_Pipe[0] && VP_PIPELINE_PACKET_VEBOX == m_Pipe[0]->GetPacketId();
+    }
+
     VpCmdPacket *GetPacket(uint32_t idx)
     {
         return idx < m_Pipe.size() ? m_Pipe[idx] : nullptr;
     }
 
+    //!
+    //! \brief  Check whether the packets of current pipe are in command task and not submitted yet.
+    //! \details Such pipe cannot be reused or cleaned until DeferredPacketPipes::Release.
+    //!
+    bool IsSubmitPending()
+    {
+        return m_submitPending;
+    }
+
     static MOS_STATUS SwitchContext(PacketType type, MediaScalability *&scalability, MediaContext *mediaContext, bool bEnableVirtualEngine, uint8_t numVebox);
 
 private:
@@ -112,6 +134,11 @@ private:
     std::vector<VpCmdPacket *> m_Pipe;
     VPHAL_OUTPUT_PIPE_MODE m_outputPipeMode = VPHAL_OUTPUT_PIPE_MODE_INVALID;
     bool m_veboxFeatureInuse = false;
+    bool m_submitPending = false;   // Packets are in command task waiting for submission.
+    bool m_returnPending = false;   // Returned to PacketPipeFactory while submission pending.
+
+    friend class PacketPipeFactory;
+    friend class DeferredPacketPipes;
 
 MEDIA_CLASS_DEFINE_END(vp__PacketPipe)
 };
@@ -131,5 +158,65 @@ private:
 MEDIA_CLASS_DEFINE_END(vp__PacketPipeFactory)
 };
 
+//!
+//! \brief  Packet pipes whose packets are added to command task and submitted later in one command buffer.
+//! \details A pipe added here is owned either by the caller or by VpPacketReuseManager. The pipes being
+//!          returned to PacketPipeFactory before submission, e.g. replaced in packet reuse manager,
+//!          are kept out of the pool until Release.
+//!
+class DeferredPacketPipes
+{
+public:
+    struct Output
+    {
+        uint32_t       frameCounter = 0;        //!< Frame counter of the pipe context
+        PVPHAL_SURFACE target       = nullptr;  //!< Target surface written by the pipe
+    };
+
+    DeferredPacketPipes(PacketPipeFactory &packetPipeFactory);
+    virtual ~DeferredPacketPipes();
+
+    //!
+    //! \brief  Add the pipe whose packets have been added to command task
+    //! \param  [in] pipe
+    //!         Packet pipe with submission deferred
+    //! \param  [in] owned
+    //!         true if the pipe is returned to PacketPipeFactory in Release, false if it is held by packet reuse manager
+    //! \param  [in] output
+    //!         Output of the pipe
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Add(PacketPipe *pipe, bool owned, const Output &output);
+
+    //!
+    //! \brief  Release the pipes after command task being submitted or cleared
+    //!
+    void Release();
+
+    bool IsEmpty()
+    {
+        return m_pipes.empty();
+    }
+
+    uint32_t Size()
+    {
+        return (uint32_t)m_pipes.size();
+    }
+
+    const std::vector<Output> &GetOutputs()
+    {
+        return m_outputs;
+    }
+
+private:
+    PacketPipeFactory         &m_packetPipeFactory;
+    std::vector<PacketPipe *>  m_pipes;
+    std::vector<bool>          m_owned;
+    std::vector<Output>        m_outputs;
+
+MEDIA_CLASS_DEFINE_END(vp__DeferredPacketPipes)
+};
+
 }
 #endif // !__VP_PACKET_PIPE_H__
@@ -2550,6 +2550,7 @@ VpVeboxCmdPacket:: ~VpVeboxCmdPacket()
     MOS_Delete(m_sfcRender);
     MOS_Delete(m_lastExecRenderData);
     MOS_Delete(m_surfMemCacheCtl);
+    MOS_FreeMemory(m_indirectStateCache);
 
     m_allocator->DestroyVpSurface(m_currentSurface);
     m_allocator->DestroyVpSurface(m_previousSurface);
@@ -2786,6 +2787,30 @@ MOS_STATUS VpVeboxCmdPacket::SetupIndirectStates()
     //----------------------------------
     VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->AssignVeboxState());
 
+    const MHW_VEBOX_HEAP *veboxHeap = nullptr;
+    VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->GetVeboxHeapInfo(&veboxHeap));
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap);
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap->pLockedDriverResourceMem);
+
+    uint8_t    *curState     = veboxHeap->pLockedDriverResourceMem + veboxHeap->uiCurState * veboxHeap->uiInstanceSize;
+    const char *regenReason  = nullptr;
+    VP_VEBOX_INDIRECT_STATE_KEY key;
+
+    VP_RENDER_CHK_STATUS_RETURN(GetIndirectStateKey(key, regenReason));
+    bool cacheable = (regenReason == nullptr);
+
+    if (cacheable)
+    {
+        regenReason = CheckIndirectStateCache(key, veboxHeap->uiInstanceSize);
+        if (regenReason == nullptr)
+        {
+            // Same inputs as last generation, copy the whole heap instance instead of re-encoding it
+            VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(curState, veboxHeap->uiInstanceSize, m_indirectStateCache, m_indirectStateCacheSize));
+            m_indirectStateReuseCount++;
+            return MOS_STATUS_SUCCESS;
+        }
+    }
+
     // Set IECP State
     VP_RENDER_CHK_STATUS_RETURN(AddVeboxIECPState());
 
@@ -2798,9 +2823,168 @@ MOS_STATUS VpVeboxCmdPacket::SetupIndirectStates()
     // Set HDR State
     VP_RENDER_CHK_STATUS_RETURN(AddVeboxHdrState());
 
+    VP_RENDER_NORMALMESSAGE("Vebox indirect states regenerated (version %d, previous version reused %d times): %s.",
+        m_indirectStateVersion + 1, m_indirectStateReuseCount, regenReason);
+    m_indirectStateVersion++;
+    m_indirectStateReuseCount = 0;
+
+    if (!cacheable)
+    {
+        // States depend on data outside of the key, drop cached copy as it may be stale afterwards
+        MOS_FreeMemory(m_indirectStateCache);
+        m_indirectStateCache     = nullptr;
+        m_indirectStateCacheSize = 0;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    if (m_indirectStateCache == nullptr || m_indirectStateCacheSize != veboxHeap->uiInstanceSize)
+    {
+        MOS_FreeMemory(m_indirectStateCache);
+        m_indirectStateCacheSize = 0;
+        m_indirectStateCache     = (uint8_t *)MOS_AllocMemory(veboxHeap->uiInstanceSize);
+        if (m_indirectStateCache == nullptr)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+        m_indirectStateCacheSize = veboxHeap->uiInstanceSize;
+    }
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(m_indirectStateCache, m_indirectStateCacheSize, curState, veboxHeap->uiInstanceSize));
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&m_indirectStateKey, sizeof(m_indirectStateKey), &key, sizeof(key)));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpVeboxCmdPacket::GetIndirectStateKey(
+    VP_VEBOX_INDIRECT_STATE_KEY &key,
+    const char                  *&bypassReason)
+{
+    VP_FUNC_CALL();
+
+    VpVeboxRenderData        *renderData    = GetLastExecRenderData();
+    VP_PACKET_SHARED_CONTEXT *sharedContext = (VP_PACKET_SHARED_CONTEXT *)m_packetSharedContext;
+    VP_RENDER_CHK_NULL_RETURN(renderData);
+
+    MHW_VEBOX_IECP_PARAMS  &iecpParams  = renderData->GetIECPParams();
+    MHW_VEBOX_DNDI_PARAMS  &dndiParams  = renderData->GetDNDIParams();
+    MHW_VEBOX_GAMUT_PARAMS &gamutParams = renderData->GetGamutParams();
+
+    // States built from tables or statistics outside of the parameters are not cached
+    bypassReason = nullptr;
+    if (sharedContext == nullptr)
+    {
+        bypassReason = "no packet shared context";
+    }
+    else if (renderData->DN.bHvsDnEnabled)
+    {
+        bypassReason = "HVS denoise updates DNDI state from statistics";
+    }
+    else if (renderData->HDR3DLUT.bHdr3DLut || iecpParams.s3DLutParams.bActive || iecpParams.s1DLutParams.bActive)
+    {
+        bypassReason = "LUT tables in use";
+    }
+    else if (iecpParams.CapPipeParams.bActive)
+    {
+        bypassReason = "capture pipe in use";
+    }
+    else if (iecpParams.ColorPipeParams.bEnableLACE || iecpParams.ColorPipeParams.bEnableSTD)
+    {
+        bypassReason = "LACE or STD in use";
+    }
+    else if (dndiParams.bEnableSlimIPUDenoise)
+    {
+        bypassReason = "slim IPU denoise in use";
+    }
+    else if (gamutParams.pFwdGammaBias || gamutParams.pInvGammaBias)
+    {
+        bypassReason = "gamma bias tables in use";
+    }
+
+    if (bypassReason)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_ZeroMemory(&key, sizeof(key));
+
+    key.iecpEnabled = renderData->IECP.IsIecpEnabled();
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.iecpParams, sizeof(key.iecpParams), &iecpParams, sizeof(iecpParams)));
+    if (iecpParams.pfCscCoeff && iecpParams.pfCscInOffset && iecpParams.pfCscOutOffset)
+    {
+        MOS_SecureMemcpy(key.cscCoeff, sizeof(key.cscCoeff), iecpParams.pfCscCoeff, sizeof(key.cscCoeff));
+        MOS_SecureMemcpy(key.cscInOffset, sizeof(key.cscInOffset), iecpParams.pfCscInOffset, sizeof(key.cscInOffset));
+        MOS_SecureMemcpy(key.cscOutOffset, sizeof(key.cscOutOffset), iecpParams.pfCscOutOffset, sizeof(key.cscOutOffset));
+    }
+    if (iecpParams.pfFeCscCoeff && iecpParams.pfFeCscInOffset && iecpParams.pfFeCscOutOffset)
+    {
+        MOS_SecureMemcpy(key.feCscCoeff, sizeof(key.feCscCoeff), iecpParams.pfFeCscCoeff, sizeof(key.feCscCoeff));
+        MOS_SecureMemcpy(key.feCscInOffset, sizeof(key.feCscInOffset), iecpParams.pfFeCscInOffset, sizeof(key.feCscInOffset));
+        MOS_SecureMemcpy(key.feCscOutOffset, sizeof(key.feCscOutOffset), iecpParams.pfFeCscOutOffset, sizeof(key.feCscOutOffset));
+    }
+    key.iecpParams.pfCscCoeff                         = nullptr;
+    key.iecpParams.pfCscInOffset                      = nullptr;
+    key.iecpParams.pfCscOutOffset                     = nullptr;
+    key.iecpParams.pfFeCscCoeff                       = nullptr;
+    key.iecpParams.pfFeCscInOffset                    = nullptr;
+    key.iecpParams.pfFeCscOutOffset                   = nullptr;
+    key.iecpParams.ColorPipeParams.StdParams.param    = nullptr;
+    key.iecpParams.s3DLutParams.pLUT                  = nullptr;
+    key.iecpParams.s1DLutParams.p1DLUT                = nullptr;
+    key.iecpParams.s1DLutParams.pCCM                  = nullptr;
+
+    key.dndiEnabled = renderData->DN.bDnEnabled || renderData->DI.bDeinterlace || renderData->DI.bQueryVariance;
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.dndiParams, sizeof(key.dndiParams), &dndiParams, sizeof(dndiParams)));
+    key.dndiParams.pSystemMem = nullptr;
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.chromaParams, sizeof(key.chromaParams), &veboxChromaParams, sizeof(veboxChromaParams)));
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.tgneParams, sizeof(key.tgneParams), &sharedContext->tgneParams, sizeof(sharedContext->tgneParams)));
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.hvsParams, sizeof(key.hvsParams), &sharedContext->hvsParams, sizeof(sharedContext->hvsParams)));
+
+    key.gamutEnabled = IsVeboxGamutStateNeeded();
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(&key.gamutParams, sizeof(key.gamutParams), &gamutParams, sizeof(gamutParams)));
+
     return MOS_STATUS_SUCCESS;
 }
 
+const char *VpVeboxCmdPacket::CheckIndirectStateCache(
+    const VP_VEBOX_INDIRECT_STATE_KEY &key,
+    uint32_t                          size)
+{
+    const VP_VEBOX_INDIRECT_STATE_KEY &cached = m_indirectStateKey;
+
+    if (m_indirectStateCache == nullptr || m_indirectStateCacheSize != size)
+    {
+        return "no cached states";
+    }
+    if (key.iecpEnabled != cached.iecpEnabled ||
+        memcmp(&key.iecpParams, &cached.iecpParams, sizeof(key.iecpParams)) ||
+        memcmp(key.cscCoeff, cached.cscCoeff, sizeof(key.cscCoeff)) ||
+        memcmp(key.cscInOffset, cached.cscInOffset, sizeof(key.cscInOffset)) ||
+        memcmp(key.cscOutOffset, cached.cscOutOffset, sizeof(key.cscOutOffset)) ||
+        memcmp(key.feCscCoeff, cached.feCscCoeff, sizeof(key.feCscCoeff)) ||
+        memcmp(key.feCscInOffset, cached.feCscInOffset, sizeof(key.feCscInOffset)) ||
+        memcmp(key.feCscOutOffset, cached.feCscOutOffset, sizeof(key.feCscOutOffset)))
+    {
+        return "IECP parameters changed";
+    }
+    if (key.dndiEnabled != cached.dndiEnabled ||
+        memcmp(&key.dndiParams, &cached.dndiParams, sizeof(key.dndiParams)) ||
+        memcmp(&key.chromaParams, &cached.chromaParams, sizeof(key.chromaParams)))
+    {
+        return "DNDI parameters changed";
+    }
+    if (memcmp(&key.tgneParams, &cached.tgneParams, sizeof(key.tgneParams)) ||
+        memcmp(&key.hvsParams, &cached.hvsParams, sizeof(key.hvsParams)))
+    {
+        return "noise estimation state changed";
+    }
+    if (key.gamutEnabled != cached.gamutEnabled ||
+        memcmp(&key.gamutParams, &cached.gamutParams, sizeof(key.gamutParams)))
+    {
+        return "gamut parameters changed";
+    }
+
+    return nullptr;
+}
+
 void VpVeboxCmdPacket::VeboxGetBeCSCMatrix(
     VPHAL_CSPACE    inputColorSpace,
     VPHAL_CSPACE    outputColorSpace,
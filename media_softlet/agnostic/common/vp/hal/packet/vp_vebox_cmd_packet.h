@@ -337,6 +337,34 @@ typedef struct _VP_VEBOX_CACHE_CNTL
 
 namespace vp {
 
+//!
+//! \brief  Inputs of vebox indirect states (IECP, DNDI, gamut and HDR).
+//!         Vebox heap instance generated for a key is reused while key is unchanged.
+//!
+struct VP_VEBOX_INDIRECT_STATE_KEY
+{
+    // IECP
+    bool                                iecpEnabled;
+    MHW_VEBOX_IECP_PARAMS               iecpParams;                                 //!< Pointers cleared, CSC matrices copied below
+    float                               cscCoeff[9];
+    float                               cscInOffset[3];
+    float                               cscOutOffset[3];
+    float                               feCscCoeff[9];
+    float                               feCscInOffset[3];
+    float                               feCscOutOffset[3];
+
+    // DNDI
+    bool                                dndiEnabled;
+    MHW_VEBOX_DNDI_PARAMS               dndiParams;
+    mhw::vebox::MHW_VEBOX_CHROMA_PARAMS chromaParams;
+    decltype(VP_PACKET_SHARED_CONTEXT::tgneParams) tgneParams;                      //!< Mirrors noise estimation state in MHW
+    decltype(VP_PACKET_SHARED_CONTEXT::hvsParams)  hvsParams;
+
+    // Gamut
+    bool                                gamutEnabled;
+    MHW_VEBOX_GAMUT_PARAMS              gamutParams;
+};
+
 class VpVeboxCmdPacket : virtual public VpVeboxCmdPacketBase
 {
 public:
@@ -1070,6 +1098,33 @@ protected:
     //!
     virtual MOS_STATUS SetupIndirectStates();
 
+    //!
+    //! \brief    Get vebox indirect state key
+    //! \details  Collect all inputs of vebox indirect states for current frame
+    //! \param    [out] key
+    //!           Indirect state key
+    //! \param    [out] bypassReason
+    //!           Reason why states can not be cached, nullptr if cacheable
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS GetIndirectStateKey(
+        VP_VEBOX_INDIRECT_STATE_KEY &key,
+        const char                  *&bypassReason);
+
+    //!
+    //! \brief    Check vebox indirect state cache
+    //! \param    [in] key
+    //!           Indirect state key of current frame
+    //! \param    [in] size
+    //!           Size of vebox heap instance
+    //! \return   const char *
+    //!           nullptr if cached states can be reused, otherwise reason of regeneration
+    //!
+    const char *CheckIndirectStateCache(
+        const VP_VEBOX_INDIRECT_STATE_KEY &key,
+        uint32_t                          size);
+
     //!
     //! \brief    Vebox get the back-end colorspace conversion matrix
     //! \details  When the i/o is A8R8G8B8 or X8R8G8B8, the transfer matrix
@@ -1211,6 +1266,13 @@ protected:
     std::shared_ptr<mhw::mi::Itf> m_miItf                  = nullptr;
     vp::VpUserFeatureControl   *m_vpUserFeatureControl     = nullptr;
 
+    // Vebox indirect state cache
+    VP_VEBOX_INDIRECT_STATE_KEY m_indirectStateKey         = {};                 //!< Inputs of cached indirect states
+    uint8_t                    *m_indirectStateCache       = nullptr;            //!< Copy of vebox heap instance generated for m_indirectStateKey
+    uint32_t                    m_indirectStateCacheSize   = 0;                  //!< Size of m_indirectStateCache
+    uint32_t                    m_indirectStateVersion     = 0;                  //!< Increased each time indirect states are regenerated
+    uint32_t                    m_indirectStateReuseCount  = 0;                  //!< Frames reusing current version
+
 MEDIA_CLASS_DEFINE_END(vp__VpVeboxCmdPacket)
 };
 
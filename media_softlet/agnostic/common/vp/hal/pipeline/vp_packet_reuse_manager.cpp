@@ -434,6 +434,43 @@ MOS_STATUS VpColorFillReuse::UpdateFeatureParams(FeatureParamColorFill &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpColorFillReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterColorFill *colorfill = dynamic_cast<SwFilterColorFill *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(colorfill);
+    FeatureParamColorFill &params = colorfill->GetSwFilterParams();
+    auto                   it     = m_colorFillParams_Teams.find(index);
+
+    if (reusable &&
+        (nullptr == params.colorFillParams && m_colorFillParams_Teams.end() == it ||
+        nullptr != params.colorFillParams && m_colorFillParams_Teams.end() != it &&
+        0 == memcmp(params.colorFillParams, &it->second, sizeof(VPHAL_COLORFILL_PARAMS))))
+    {
+        reused = true;
+    }
+    else
+    {
+        reused = false;
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpColorFillReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterColorFill *colorfill = dynamic_cast<SwFilterColorFill *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(colorfill);
+    FeatureParamColorFill &params = colorfill->GetSwFilterParams();
+
+    m_colorFillParams_Teams.erase(index);
+    if (params.colorFillParams)
+    {
+        m_colorFillParams_Teams.insert(std::make_pair(index, *params.colorFillParams));
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpAlphaReuse********************************/
 /*******************************************************************/
@@ -486,6 +523,48 @@ MOS_STATUS VpAlphaReuse::UpdateFeatureParams(FeatureParamAlpha &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpAlphaReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterAlpha *alpha = dynamic_cast<SwFilterAlpha *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(alpha);
+    FeatureParamAlpha &params = alpha->GetSwFilterParams();
+    auto               it     = m_calculatingAlpha_Teams.find(index);
+    VP_PUBLIC_CHK_NOT_FOUND_RETURN(it, &m_calculatingAlpha_Teams);
+    auto               itAlpha = m_compAlpha_Teams.find(index);
+
+    if (reusable &&
+        params.calculatingAlpha == it->second &&
+        (nullptr == params.compAlpha && m_compAlpha_Teams.end() == itAlpha ||
+        nullptr != params.compAlpha && m_compAlpha_Teams.end() != itAlpha &&
+        0 == memcmp(params.compAlpha, &itAlpha->second, sizeof(VPHAL_ALPHA_PARAMS))))
+    {
+        reused = true;
+    }
+    else
+    {
+        reused = false;
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpAlphaReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterAlpha *alpha = dynamic_cast<SwFilterAlpha *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(alpha);
+    FeatureParamAlpha &params = alpha->GetSwFilterParams();
+
+    m_calculatingAlpha_Teams.erase(index);
+    m_calculatingAlpha_Teams.insert(std::make_pair(index, params.calculatingAlpha));
+    m_compAlpha_Teams.erase(index);
+    if (params.compAlpha)
+    {
+        m_compAlpha_Teams.insert(std::make_pair(index, *params.compAlpha));
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpDenoiseReuse********************************/
 /*******************************************************************/
@@ -538,6 +617,31 @@ MOS_STATUS VpDenoiseReuse::UpdateFeatureParams(FeatureParamDenoise &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpDenoiseReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterDenoise     *dn     = dynamic_cast<SwFilterDenoise *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(dn);
+    FeatureParamDenoise &params = dn->GetSwFilterParams();
+    auto                 it     = m_params_Teams.find(index);
+    VP_PUBLIC_CHK_NOT_FOUND_RETURN(it, &m_params_Teams);
+
+    reused = reusable && params == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpDenoiseReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterDenoise     *dn     = dynamic_cast<SwFilterDenoise *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(dn);
+    FeatureParamDenoise &params = dn->GetSwFilterParams();
+
+    m_params_Teams.erase(index);
+    m_params_Teams.insert(std::make_pair(index, params));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpTccReuse**********************************/
 /*******************************************************************/
@@ -590,6 +694,32 @@ MOS_STATUS VpTccReuse::UpdateFeatureParams(FeatureParamTcc &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpTccReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterTcc *tcc = dynamic_cast<SwFilterTcc *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(tcc);
+    FeatureParamTcc &params = tcc->GetSwFilterParams();
+    auto it = m_enableTcc_Teams.find(index);
+    VP_PUBLIC_CHK_NOT_FOUND_RETURN(it, &m_enableTcc_Teams);
+
+    // Same as UpdateFeatureParams, other parameters are updated by UpdatePacket.
+    reused = reusable && params.bEnableTCC == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpTccReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterTcc *tcc = dynamic_cast<SwFilterTcc *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(tcc);
+    FeatureParamTcc &params = tcc->GetSwFilterParams();
+
+    m_enableTcc_Teams.erase(index);
+    m_enableTcc_Teams.insert(std::make_pair(index, params.bEnableTCC));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpSteReuse**********************************/
 /*******************************************************************/
@@ -642,6 +772,32 @@ MOS_STATUS VpSteReuse::UpdateFeatureParams(FeatureParamSte &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpSteReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterSte *ste = dynamic_cast<SwFilterSte *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(ste);
+    FeatureParamSte &params = ste->GetSwFilterParams();
+    auto it = m_enableSte_Teams.find(index);
+    VP_PUBLIC_CHK_NOT_FOUND_RETURN(it, &m_enableSte_Teams);
+
+    // Same as UpdateFeatureParams, other parameters are updated by UpdatePacket.
+    reused = reusable && params.bEnableSTE == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpSteReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterSte *ste = dynamic_cast<SwFilterSte *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(ste);
+    FeatureParamSte &params = ste->GetSwFilterParams();
+
+    m_enableSte_Teams.erase(index);
+    m_enableSte_Teams.insert(std::make_pair(index, params.bEnableSTE));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpProcampReuse**********************************/
 /*******************************************************************/
@@ -695,6 +851,34 @@ MOS_STATUS VpProcampReuse::UpdateFeatureParams(FeatureParamProcamp &params)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpProcampReuse::CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterProcamp *procamp = dynamic_cast<SwFilterProcamp *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(procamp);
+    FeatureParamProcamp &params = procamp->GetSwFilterParams();
+    auto it = m_procampEnabled_Teams.find(index);
+    VP_PUBLIC_CHK_NOT_FOUND_RETURN(it, &m_procampEnabled_Teams);
+
+    // Same as UpdateFeatureParams, procamp values are updated by UpdatePacket.
+    int32_t enabled = params.procampParams ? (params.procampParams->bEnabled ? 1 : 0) : -1;
+    reused = reusable && enabled == it->second;
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpProcampReuse::StoreTeamsParams(SwFilter *filter, uint32_t index)
+{
+    VP_FUNC_CALL();
+    SwFilterProcamp *procamp = dynamic_cast<SwFilterProcamp *>(filter);
+    VP_PUBLIC_CHK_NULL_RETURN(procamp);
+    FeatureParamProcamp &params = procamp->GetSwFilterParams();
+
+    int32_t enabled = params.procampParams ? (params.procampParams->bEnabled ? 1 : 0) : -1;
+    m_procampEnabled_Teams.erase(index);
+    m_procampEnabled_Teams.insert(std::make_pair(index, enabled));
+    return MOS_STATUS_SUCCESS;
+}
+
 /*******************************************************************/
 /***********************VpPacketReuseManager************************/
 /*******************************************************************/
@@ -703,11 +887,16 @@ VpPacketReuseManager::VpPacketReuseManager(PacketPipeFactory &packetPipeFactory,
     m_packetPipeFactory(packetPipeFactory), m_disablePacketReuse(userFeatureControl.IsPacketReuseDisabled())
 {
     m_pipeReused_TeamsPacket.clear();
+    m_signature_TeamsPacket.clear();
     m_enablePacketReuseTeamsAlways = userFeatureControl.IsPacketReuseEnabledTeamsAlways();
+    m_enablePacketReusePlanCache   = userFeatureControl.IsPacketReusePlanCacheEnabled();
 }
 
 VpPacketReuseManager::~VpPacketReuseManager()
 {
+    VP_PUBLIC_NORMALMESSAGE("Packet reuse statistics: last pipe reused %llu, plan cache hit %llu, plan cache miss %llu.",
+        (unsigned long long)m_lastPipeReusedCount, (unsigned long long)m_planCacheHitCount, (unsigned long long)m_planCacheMissCount);
+
     for (uint32_t index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
     {
         auto pipeReuseHandle = m_pipeReused_TeamsPacket.find(index);
@@ -718,6 +907,7 @@ VpPacketReuseManager::~VpPacketReuseManager()
         }
     }
     m_pipeReused_TeamsPacket.clear();
+    m_signature_TeamsPacket.clear();
 
     if (m_pipeReused)
     {
@@ -810,13 +1000,25 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     }
 
     auto &pipe = *swFilterPipe;
-    auto featureRegistered = policy.GetFeatureRegistered();
+    auto &featureRegistered = policy.GetFeatureRegistered();
+
+    // Look up the sw filters of the pipe once instead of in every step below.
+    // Features in m_features are all in the feature pool of policy.
+    m_pipeSwFilters.clear();
+    for (auto feature : featureRegistered)
+    {
+        SwFilter *swfilter = pipe.GetSwFilter(true, 0, feature);
+        if (swfilter)
+        {
+            m_pipeSwFilters.push_back(std::make_pair(feature, swfilter));
+        }
+    }
 
     isPacketPipeReused = true;
 
     for (auto feature : featureRegistered)
     {
-        SwFilter *swfilter = pipe.GetSwFilter(true, 0, feature);
+        SwFilter *swfilter = GetPipeSwFilter(feature);
         auto it = m_features.find(feature);
         bool ignoreUpdateFeatureParams = false;
 
@@ -861,11 +1063,11 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     m_TeamsPacket       = false;
     m_TeamsPacket_reuse = false;
 
-    if (isTeamsWL || m_enablePacketReuseTeamsAlways)
+    if (isTeamsWL || m_enablePacketReuseTeamsAlways || m_enablePacketReusePlanCache)
     {
         for (auto feature : featureRegistered)
         {
-            SwFilter *swfilter = pipe.GetSwFilter(true, 0, feature);
+            SwFilter *swfilter = GetPipeSwFilter(feature);
             if (nullptr == swfilter)
             {
                 continue;
@@ -877,6 +1079,11 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
             {
                 // Teams feature
             }
+            else if (m_enablePacketReusePlanCache)
+            {
+                // All features reaching here have been registered in m_features,
+                // which can be cached in Teams slots with plan cache enabled.
+            }
             else
             {
                 m_TeamsPacket = false;
@@ -886,39 +1093,66 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
             m_TeamsPacket = true;
         }
 
+        // Composition pipes with more than one layer are never cached, since their render
+        // packets cannot be reinitialized from a stored pipe.
         if (nullptr == swFilterPipe || swFilterPipe->GetSurfaceCount(true) != 1 || swFilterPipe->GetSurfaceCount(false) != 1)
         {
             m_TeamsPacket = false;
         }
     }
 
-    if (!isPacketPipeReused && m_TeamsPacket)
+    if (isPacketPipeReused && m_pipeReused && m_pipeReused->IsSubmitPending())
     {
-        SwFilter *scaling = pipe.GetSwFilter(true, 0, FeatureTypeScaling);
-        SwFilter *csc     = pipe.GetSwFilter(true, 0, FeatureTypeCsc);
-        SwFilter *rot     = pipe.GetSwFilter(true, 0, FeatureTypeRotMir);
+        // Packets of last pipe are still in command task in scaling ladder mode and cannot be
+        // updated for current pipe. Handle it as not reusable.
+        VP_PUBLIC_NORMALMESSAGE("Packet not reused since last pipe not submitted yet.");
+        isPacketPipeReused = false;
+    }
 
-        bool reused = false;
+    if (isPacketPipeReused)
+    {
+        ++m_lastPipeReusedCount;
+    }
 
-        auto scalingreuse = m_features.find(FeatureTypeScaling);
-        auto cscreuse     = m_features.find(FeatureTypeCsc);
-        auto rotreuse     = m_features.find(FeatureTypeRotMir);
+    if (!isPacketPipeReused && m_TeamsPacket)
+    {
+        bool     reused    = false;
+        uint64_t signature = GetPipeSignature(pipe);
 
         for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
         {
-            scalingreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, scaling, index);
-            if (!reused)
+            // Signature covers surface layout and feature set. Only compare
+            // feature parameters for the slots with same signature.
+            auto signatureHandle = m_signature_TeamsPacket.find(index);
+            auto pipeHandle = m_pipeReused_TeamsPacket.find(index);
+            if (signatureHandle == m_signature_TeamsPacket.end() ||
+                signatureHandle->second != signature ||
+                pipeHandle == m_pipeReused_TeamsPacket.end() ||
+                pipeHandle->second->IsSubmitPending())
             {
+                // Pipe of slot not submitted yet in scaling ladder mode cannot be reused either.
+                reused = false;
                 continue;
             }
 
-            cscreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, csc, index);
-            if (!reused)
+            reused = true;
+            for (auto &it : m_features)
             {
-                continue;
+                SwFilter *swfilter = GetPipeSwFilter(it.first);
+                if (nullptr == swfilter)
+                {
+                    continue;
+                }
+                if (MOS_FAILED(it.second->CheckTeamsParams(reusableOfLastPipe, reused, swfilter, index)))
+                {
+                    reused = false;
+                }
+                if (!reused)
+                {
+                    break;
+                }
             }
 
-            rotreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, rot, index);
             if (reused)
             {
                 break;
@@ -927,11 +1161,21 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         // if not found, store the new params and packet
         if (!reused)
         {
-            scalingreuse->second->StoreTeamsParams(scaling, curIndex);
-            cscreuse->second->StoreTeamsParams(csc, curIndex);
-            rotreuse->second->StoreTeamsParams(rot, curIndex);
+            for (auto &it : m_features)
+            {
+                SwFilter *swfilter = GetPipeSwFilter(it.first);
+                if (nullptr == swfilter)
+                {
+                    continue;
+                }
+                VP_PUBLIC_CHK_STATUS_RETURN(it.second->StoreTeamsParams(swfilter, curIndex));
+            }
 
+            // Slot becomes valid only after new packet pipe being stored in UpdatePacketPipeConfig.
+            m_signature_TeamsPacket.erase(curIndex);
+            m_pendingSignature  = signature;
             m_TeamsPacket_reuse = false;
+            ++m_planCacheMissCount;
 
             foundPipe = false;
             for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
@@ -978,7 +1222,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
             // Update Packet
             for (auto it : m_features)
             {
-                SwFilter *swfilter = pipe.GetSwFilter(true, 0, it.first);
+                SwFilter *swfilter = GetPipeSwFilter(it.first);
                 if (nullptr == swfilter)
                 {
                     continue;
@@ -990,6 +1234,8 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 
             m_TeamsPacket_reuse = true;
             isPacketPipeReused  = true;
+            ++m_planCacheHitCount;
+            VP_PUBLIC_NORMALMESSAGE("Packet pipe reused from plan cache slot %d.", index);
             return MOS_STATUS_SUCCESS;
         }
     }
@@ -1046,7 +1292,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     // Update Packet
     for (auto it : m_features)
     {
-        SwFilter *swfilter = pipe.GetSwFilter(true, 0, it.first);
+        SwFilter *swfilter = GetPipeSwFilter(it.first);
         if (nullptr == swfilter)
         {
             continue;
@@ -1059,6 +1305,58 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpPacketReuseManager::GetPipeSignature(SwFilterPipe &pipe)
+{
+    // One multiply-xorshift round per 64 bit word. It is computed for every frame
+    // not reusing last pipe, so avoid the per byte rounds of FNV-1a.
+    uint64_t signature = 0xcbf29ce484222325ull;
+    auto hashCombine = [&](uint64_t value) {
+        signature = (signature ^ value) * 0x9e3779b97f4a7c15ull;
+        signature ^= signature >> 29;
+    };
+    auto hashRect = [&](RECT &rect) {
+        hashCombine((uint32_t)rect.left | ((uint64_t)(uint32_t)rect.top << 32));
+        hashCombine((uint32_t)rect.right | ((uint64_t)(uint32_t)rect.bottom << 32));
+    };
+    auto hashSurface = [&](VP_SURFACE *surf) {
+        if (nullptr == surf || nullptr == surf->osSurface)
+        {
+            hashCombine(0);
+            return;
+        }
+        hashCombine(surf->osSurface->Format);
+        hashCombine(surf->osSurface->dwWidth | ((uint64_t)surf->osSurface->dwHeight << 32));
+        hashCombine(surf->osSurface->dwPitch);
+        hashCombine(surf->osSurface->TileType);
+        hashCombine(surf->ColorSpace | ((uint64_t)surf->SampleType << 32));
+        hashCombine(surf->ChromaSiting);
+        hashRect(surf->rcSrc);
+        hashRect(surf->rcDst);
+    };
+
+    hashSurface(pipe.GetSurface(true, 0));
+    hashSurface(pipe.GetSurface(false, 0));
+    // Filters are in the order of featureRegistered.
+    for (auto &swFilter : m_pipeSwFilters)
+    {
+        hashCombine(swFilter.first);
+    }
+
+    return signature;
+}
+
+SwFilter *VpPacketReuseManager::GetPipeSwFilter(FeatureType type)
+{
+    for (auto &swFilter : m_pipeSwFilters)
+    {
+        if (swFilter.first == type)
+        {
+            return swFilter.second;
+        }
+    }
+    return nullptr;
+}
+
 // Be called for not reused case before packet pipe execution.
 MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
 {
@@ -1101,6 +1399,7 @@ MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
         }
 
         m_pipeReused_TeamsPacket.insert(std::make_pair(curIndex, pipe));
+        m_signature_TeamsPacket[curIndex] = m_pendingSignature;
 
         curIndex++;
         if (curIndex >= MaxTeamsPacketSize)
@@ -159,11 +159,17 @@ public:
     virtual ~VpColorFillReuse();
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
+
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamColorFill &params);
 
     FeatureParamColorFill m_params = {};
     VPHAL_COLORFILL_PARAMS m_colorFillParams = {};
+    std::map<uint32_t, VPHAL_COLORFILL_PARAMS> m_colorFillParams_Teams;     //!< nullptr colorFillParams not stored.
 
 MEDIA_CLASS_DEFINE_END(vp__VpColorFillReuse)
 };
@@ -176,11 +182,17 @@ public:
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamAlpha &params);
 
     FeatureParamAlpha m_params = {};
     VPHAL_ALPHA_PARAMS m_compAlpha = {};
+    std::map<uint32_t, bool> m_calculatingAlpha_Teams;
+    std::map<uint32_t, VPHAL_ALPHA_PARAMS> m_compAlpha_Teams;   //!< nullptr compAlpha not stored.
 
 MEDIA_CLASS_DEFINE_END(vp__VpAlphaReuse)
 };
@@ -193,10 +205,15 @@ public:
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamDenoise &params);
 
     FeatureParamDenoise m_params = {};
+    std::map<uint32_t, FeatureParamDenoise> m_params_Teams;
 
     MEDIA_CLASS_DEFINE_END(vp__VpDenoiseReuse)
 };
@@ -209,10 +226,15 @@ public:
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamTcc &params);
 
     FeatureParamTcc m_params = {};
+    std::map<uint32_t, bool> m_enableTcc_Teams;
 
 MEDIA_CLASS_DEFINE_END(vp__VpTccReuse)
 };
@@ -225,10 +247,15 @@ public:
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamSte &params);
 
     FeatureParamSte m_params = {};
+    std::map<uint32_t, bool> m_enableSte_Teams;
 
 MEDIA_CLASS_DEFINE_END(vp__VpSteReuse)
 };
@@ -241,10 +268,15 @@ public:
     MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    MOS_STATUS CheckTeamsParams(bool reusable, bool &reused, SwFilter *filter, uint32_t index);
+
+    MOS_STATUS StoreTeamsParams(SwFilter *filter, uint32_t index);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamProcamp &params);
 
     FeatureParamProcamp m_params = {};
+    std::map<uint32_t, int32_t> m_procampEnabled_Teams;     //!< -1: procampParams is nullptr, otherwise bEnabled.
 
     MEDIA_CLASS_DEFINE_END(vp__VpProcampReuse)
 };
@@ -263,7 +295,38 @@ public:
         return m_pipeReused;
     }
 
+    uint64_t GetPlanCacheHitCount()
+    {
+        return m_planCacheHitCount;
+    }
+
+    uint64_t GetPlanCacheMissCount()
+    {
+        return m_planCacheMissCount;
+    }
+
 protected:
+    //!
+    //! \brief    Get canonical signature of single layer pipe
+    //! \details  Signature covers input/output surface layout and the set of
+    //!            features in the pipe. Feature parameters are compared by
+    //!            CheckTeamsParams for the slots whose signature matches.
+    //! \param    [in] pipe
+    //!            Sw filter pipe, whose sw filters are in m_pipeSwFilters
+    //! \return   uint64_t
+    //!            Pipe signature
+    //!
+    uint64_t GetPipeSignature(SwFilterPipe &pipe);
+
+    //!
+    //! \brief    Get sw filter of current pipe from m_pipeSwFilters
+    //! \param    [in] type
+    //!            Feature type
+    //! \return   SwFilter *
+    //!            Sw filter of the feature, nullptr if not in pipe
+    //!
+    SwFilter *GetPipeSwFilter(FeatureType type);
+
     bool m_reusable = false;    // Current parameter can be reused.
     PacketPipe *m_pipeReused = nullptr;
     std::map<FeatureType, VpFeatureReuseBase *> m_features;
@@ -275,6 +338,13 @@ protected:
     bool m_TeamsPacket_reuse = false;
     bool m_enablePacketReuseTeamsAlways = false;
     std::map<uint32_t, PacketPipe *> m_pipeReused_TeamsPacket;
+    bool m_enablePacketReusePlanCache = false;             // Cache any reusable feature combination of single layer pipes in Teams slots.
+    std::map<uint32_t, uint64_t> m_signature_TeamsPacket;   // Signature of pipe stored in Teams slot.
+    uint64_t m_pendingSignature = 0;                        // Signature for pipe to be stored in UpdatePacketPipeConfig.
+    std::vector<std::pair<FeatureType, SwFilter *>> m_pipeSwFilters;  // Sw filters of current pipe in feature pool order.
+    uint64_t m_lastPipeReusedCount = 0;
+    uint64_t m_planCacheHitCount = 0;
+    uint64_t m_planCacheMissCount = 0;
 MEDIA_CLASS_DEFINE_END(vp__VpPacketReuseManager)
 };
 
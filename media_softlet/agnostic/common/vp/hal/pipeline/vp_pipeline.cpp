@@ -44,6 +44,9 @@ VpPipeline::VpPipeline(PMOS_INTERFACE osInterface) :
 
 VpPipeline::~VpPipeline()
 {
+    // Delete m_ladderPacketPipes before m_vpPipeContexts, since the packet reuse
+    // managers can only return the pipes in m_ladderPacketPipes after its release.
+    MOS_Delete(m_ladderPacketPipes);
     // Delete m_featureManager before m_resourceManager, since
     // m_resourceManager is referenced by m_featureManager.
     MOS_Delete(m_featureManager);
@@ -332,6 +335,9 @@ MOS_STATUS VpPipeline::Init(void *mhwInterface)
     m_pPacketPipeFactory = MOS_New(PacketPipeFactory, *m_pPacketFactory);
     VP_PUBLIC_CHK_NULL_RETURN(m_pPacketPipeFactory);
 
+    m_ladderPacketPipes = MOS_New(DeferredPacketPipes, *m_pPacketPipeFactory);
+    VP_PUBLIC_CHK_NULL_RETURN(m_ladderPacketPipes);
+
     if (m_vpPipeContexts.size() == 0)
     {
         VP_PUBLIC_CHK_STATUS_RETURN(CreateSinglePipeContext());
@@ -511,8 +517,14 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
 
     bool isPacketPipeReused = false;
     VP_PUBLIC_CHK_NULL_RETURN(m_pvpParams.renderParams);
+    // In scaling ladder mode, the pipes whose packets are still in command task are not reused,
+    // and the ones being dropped by packet reuse manager are returned after submission.
     VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, m_pvpParams.renderParams->bOptimizeCpuTiming)));
 
+    DeferredPacketPipes::Output ladderOutput = {};
+    ladderOutput.frameCounter                = frameCounter;
+    ladderOutput.target                      = m_pvpParams.renderParams->pTarget[0];
+
     if (isPacketPipeReused)
     {
         VP_PUBLIC_NORMALMESSAGE("Packet reused.");
@@ -525,11 +537,24 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         // Update output pipe mode.
         singlePipeCtx->SetOutputPipeMode(pipeReused->GetOutputPipeMode());
         singlePipeCtx->SetIsVeboxFeatureInuse(pipeReused->IsVeboxFeatureInuse());
+
+        bool deferSubmit = m_scalingLadderMode && pipeReused->IsSubmitDeferrable();
+        if (m_scalingLadderMode && !deferSubmit)
+        {
+            // Keep the submission order with the packets being deferred before.
+            VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(FlushScalingLadder()));
+        }
+
         // MediaPipeline::m_statusReport is always nullptr in VP APO path right now.
-        eStatus = pipeReused->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox);
+        eStatus = pipeReused->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox, deferSubmit);
         MT_LOG1(MT_VP_HAL_VEBOXNUM_CHECK, MT_NORMAL, MT_VP_HAL_VEBOX_NUMBER, m_numVebox)
         VP_PUBLIC_NORMALMESSAGE("Vebox Number for check %d", m_numVebox);
-        if (MOS_SUCCEEDED(eStatus))
+        if (MOS_SUCCEEDED(eStatus) && deferSubmit)
+        {
+            // Reused pipe is still held by packet reuse manager. Execute status is updated in FlushScalingLadder.
+            VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(m_ladderPacketPipes->Add(pipeReused, false, ladderOutput)));
+        }
+        else if (MOS_SUCCEEDED(eStatus))
         {
             VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(UpdateExecuteStatus(frameCounter)));
         }
@@ -559,11 +584,27 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     singlePipeCtx->SetOutputPipeMode(pPacketPipe->GetOutputPipeMode());
     singlePipeCtx->SetIsVeboxFeatureInuse(pPacketPipe->IsVeboxFeatureInuse());
 
+    bool deferSubmit = m_scalingLadderMode && pPacketPipe->IsSubmitDeferrable();
+    if (m_scalingLadderMode && !deferSubmit)
+    {
+        // Keep the submission order with the packets being deferred before.
+        VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(FlushScalingLadder()));
+    }
+
     // MediaPipeline::m_statusReport is always nullptr in VP APO path right now.
-    eStatus = pPacketPipe->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox);
+    eStatus = pPacketPipe->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox, deferSubmit);
     MT_LOG1(MT_VP_HAL_VEBOXNUM_CHECK, MT_NORMAL, MT_VP_HAL_VEBOX_NUMBER, m_numVebox)
     VP_PUBLIC_NORMALMESSAGE("Vebox Number for check %d", m_numVebox);
-    if (MOS_SUCCEEDED(eStatus))
+    if (MOS_SUCCEEDED(eStatus) && deferSubmit)
+    {
+        // Packet pipe is either taken by packet reuse manager or returned after being submitted in FlushScalingLadder.
+        PacketPipe *deferredPipe = pPacketPipe;
+        VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->UpdatePacketPipeConfig(pPacketPipe)));
+        bool owned  = (nullptr != pPacketPipe);
+        pPacketPipe = nullptr;
+        VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(m_ladderPacketPipes->Add(deferredPipe, owned, ladderOutput)));
+    }
+    else if (MOS_SUCCEEDED(eStatus))
     {
         VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->UpdatePacketPipeConfig(pPacketPipe)));
         VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(UpdateExecuteStatus(frameCounter)));
@@ -575,7 +616,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     return eStatus;
 }
 
-MOS_STATUS VpPipeline::UpdateExecuteStatus(uint32_t frameCnt)
+MOS_STATUS VpPipeline::UpdateExecuteStatus(uint32_t frameCnt, PVPHAL_SURFACE target)
 {
     VP_FUNC_CALL();
 
@@ -585,10 +626,13 @@ MOS_STATUS VpPipeline::UpdateExecuteStatus(uint32_t frameCnt)
     {
         PVP_PIPELINE_PARAMS params = m_pvpParams.renderParams;
         VP_PUBLIC_CHK_NULL(params);
+        // Target of the output submitted in scaling ladder mode, instead of the one of current params.
+        PVPHAL_SURFACE *targets  = target ? &target : params->pTarget;
+        uint32_t        dstCount = target ? 1 : params->uDstCount;
         VP_SURFACE_PTRS_DUMP(m_debugInterface,
-            params->pTarget,
-            VPHAL_MAX_TARGETS,
-            params->uDstCount,
+            targets,
+            target ? 1 : VPHAL_MAX_TARGETS,
+            dstCount,
             frameCnt,
             VPHAL_DUMP_TYPE_POST_ALL,
             params->uSrcCount > 0 ? VPHAL_SURF_DUMP_DDI_VP_BLT : VPHAL_SURF_DUMP_DDI_CLEAR_VIEW);
@@ -600,7 +644,7 @@ MOS_STATUS VpPipeline::UpdateExecuteStatus(uint32_t frameCnt)
         if (uiForceDecompressedOutput)
         {
             VP_PUBLIC_NORMALMESSAGE("uiForceDecompressedOutput: %d", uiForceDecompressedOutput);
-            m_mmc->DecompressVPResource(params->pTarget[0]);
+            m_mmc->DecompressVPResource(targets[0]);
         }
     }
 finish:
@@ -1210,6 +1254,72 @@ MOS_STATUS VpPipeline::Execute()
     return MOS_STATUS_SUCCESS;
 }
 
+bool VpPipeline::BeginScalingLadder()
+{
+    VP_FUNC_CALL();
+
+    m_scalingLadderMode = m_ladderPacketPipes && m_userFeatureControl && m_userFeatureControl->IsScalingLadderEnabled();
+    VP_PUBLIC_NORMALMESSAGE("Scaling ladder mode %d", m_scalingLadderMode);
+    return m_scalingLadderMode;
+}
+
+MOS_STATUS VpPipeline::EndScalingLadder()
+{
+    VP_FUNC_CALL();
+
+    MOS_STATUS eStatus  = FlushScalingLadder();
+    m_scalingLadderMode = false;
+    return eStatus;
+}
+
+MOS_STATUS VpPipeline::FlushScalingLadder()
+{
+    VP_FUNC_CALL();
+
+    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+
+    VP_PUBLIC_CHK_NULL_RETURN(m_ladderPacketPipes);
+    if (m_ladderPacketPipes->IsEmpty())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MediaTask *pTask = GetTask(MediaTask::TaskType::cmdTask);
+    if (nullptr == pTask)
+    {
+        m_ladderPacketPipes->Release();
+        VP_PUBLIC_CHK_NULL_RETURN(pTask);
+    }
+
+    VP_PUBLIC_NORMALMESSAGE("Submit %d deferred packet pipes in one command buffer.", m_ladderPacketPipes->Size());
+
+    eStatus = PacketPipe::SwitchContext(VP_PIPELINE_PACKET_VEBOX, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox);
+    if (MOS_SUCCEEDED(eStatus))
+    {
+        eStatus = pTask->Submit(true, m_scalability, nullptr);
+    }
+    if (MOS_FAILED(eStatus))
+    {
+        VP_PUBLIC_ASSERTMESSAGE("Failed to submit deferred packet pipes with 0x%x", eStatus);
+        pTask->Clear();
+    }
+    else
+    {
+        for (auto &output : m_ladderPacketPipes->GetOutputs())
+        {
+            MOS_STATUS status = UpdateExecuteStatus(output.frameCounter, output.target);
+            if (MOS_FAILED(status))
+            {
+                eStatus = status;
+            }
+        }
+    }
+
+    m_ladderPacketPipes->Release();
+
+    return eStatus;
+}
+
 /****************************************************************************************************/
 /*                                      VpSinglePipeContext                                         */
 /****************************************************************************************************/
@@ -149,6 +149,23 @@ public:
     //!
     virtual MOS_STATUS Execute() override;
 
+    //!
+    //! \brief  Start scaling ladder mode, in which the outputs of 1:N processing
+    //!         are submitted in one command buffer by EndScalingLadder.
+    //! \details Only the submission is shared by the outputs. Each output is still a vebox/SFC
+    //!          pass of its own, which reads the input and runs DN/DI/CSC again.
+    //! \return bool
+    //!         true if scaling ladder mode is enabled, else false
+    //!
+    virtual bool BeginScalingLadder();
+
+    //!
+    //! \brief  Submit all pending packets of scaling ladder and exit scaling ladder mode
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS EndScalingLadder();
+
     //!
     //! \brief  Get media pipeline execution status
     //! \param  [out] status
@@ -291,10 +308,14 @@ protected:
 
     //!
     //! \brief  updated Execute Vp Pipeline status
+    //! \param  [in] frameCn
+    //!         Frame counter of the pipe context
+    //! \param  [in] target
+    //!         Target of the output submitted in scaling ladder mode, nullptr for the targets of current params
     //! \return MOS_STATUS
     //!         MOS_STATUS_SUCCESS if success, else fail reason
     //!
-    virtual MOS_STATUS UpdateExecuteStatus(uint32_t frameCn);
+    virtual MOS_STATUS UpdateExecuteStatus(uint32_t frameCn, PVPHAL_SURFACE target = nullptr);
 
     //!
     //! \brief  Create SwFilterPipe
@@ -435,6 +456,13 @@ protected:
 
     MOS_STATUS ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipeCtx, SwFilterPipe *&pipe, PacketPipe *pPacketPipe, VpFeatureManagerNext *featureManagerNext);
 
+    //!
+    //! \brief  Submit the packets deferred in scaling ladder mode
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS FlushScalingLadder();
+
 protected:
     VP_PARAMS              m_pvpParams              = {};   //!< vp Pipeline params
     VP_MHWINTERFACE        m_vpMhwInterface         = {};   //!< vp Pipeline Mhw Interface
@@ -467,6 +495,8 @@ protected:
     VpUserFeatureControl  *m_userFeatureControl = nullptr;
     std::vector<VpSinglePipeContext *> m_vpPipeContexts     = {};
     VpPipelineParamFactory            *m_pipelineParamFactory = nullptr;
+    bool                               m_scalingLadderMode    = false;    //!< Defer submission for 1:N outputs.
+    DeferredPacketPipes               *m_ladderPacketPipes    = nullptr;  //!< Packet pipes with submission deferred.
 
     MEDIA_CLASS_DEFINE_END(vp__VpPipeline)
 };
@@ -142,6 +142,9 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
 
     if (1 == pcRenderParams->uSrcCount && pcRenderParams->uDstCount > 1)
     {
+        // In scaling ladder mode, all outputs are submitted in one command buffer by EndScalingLadder.
+        bool scalingLadder = m_vpPipeline->BeginScalingLadder();
+
         for (uint32_t dstIndex = 0; dstIndex < pcRenderParams->uDstCount; ++dstIndex)
         {
             params           = *(PVP_PIPELINE_PARAMS)pcRenderParams;
@@ -167,6 +170,15 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
                 break;
             }
         }
+
+        if (scalingLadder)
+        {
+            MOS_STATUS ladderStatus = m_vpPipeline->EndScalingLadder();
+            if (MOS_SUCCEEDED(eStatus))
+            {
+                eStatus = ladderStatus;
+            }
+        }
     }
     else
     {
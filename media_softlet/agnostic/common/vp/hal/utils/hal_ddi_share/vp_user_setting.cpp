@@ -111,6 +111,20 @@ MOS_STATUS VpUserSetting::InitVpUserSetting(MediaUserSettingSharedPtr userSettin
             0,
             true);
 
+        DeclareUserSettingKey(
+            userSettingPtr,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_PACKET_REUSE_PLAN_CACHE,
+            MediaUserSetting::Group::Sequence,
+            0,
+            true);
+
+        DeclareUserSettingKey(
+            userSettingPtr,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_SCALING_LADDER,
+            MediaUserSetting::Group::Sequence,
+            0,
+            true);
+
         DeclareUserSettingKey(
             userSettingPtr,
             __MEDIA_USER_FEATURE_VALUE_FORCE_ENABLE_VEBOX_OUTPUT_SURF,
@@ -183,6 +183,40 @@ VpUserFeatureControl::VpUserFeatureControl(MOS_INTERFACE &osInterface, VpPlatfor
     }
     VP_PUBLIC_NORMALMESSAGE("enablePacketReuseTeamsAlways %d", m_ctrlValDefault.enablePacketReuseTeamsAlways);
 
+    bool enablePacketReusePlanCache = false;
+    status = ReadUserSetting(
+        m_userSettingPtr,
+        enablePacketReusePlanCache,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_PACKET_REUSE_PLAN_CACHE,
+        MediaUserSetting::Group::Sequence);
+    if (MOS_SUCCEEDED(status))
+    {
+        m_ctrlValDefault.enablePacketReusePlanCache = enablePacketReusePlanCache;
+    }
+    else
+    {
+        // Default value
+        m_ctrlValDefault.enablePacketReusePlanCache = false;
+    }
+    VP_PUBLIC_NORMALMESSAGE("enablePacketReusePlanCache %d", m_ctrlValDefault.enablePacketReusePlanCache);
+
+    bool enableScalingLadder = false;
+    status = ReadUserSetting(
+        m_userSettingPtr,
+        enableScalingLadder,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_SCALING_LADDER,
+        MediaUserSetting::Group::Sequence);
+    if (MOS_SUCCEEDED(status))
+    {
+        m_ctrlValDefault.enableScalingLadder = enableScalingLadder;
+    }
+    else
+    {
+        // Default value
+        m_ctrlValDefault.enableScalingLadder = false;
+    }
+    VP_PUBLIC_NORMALMESSAGE("enableScalingLadder %d", m_ctrlValDefault.enableScalingLadder);
+
     // bComputeContextEnabled is true only if Gen12+. 
     // Gen12+, compute context(MOS_GPU_NODE_COMPUTE, MOS_GPU_CONTEXT_COMPUTE) can be used for render engine.
     // Before Gen12, we only use MOS_GPU_NODE_3D and MOS_GPU_CONTEXT_RENDER.
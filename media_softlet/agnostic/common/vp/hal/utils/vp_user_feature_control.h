@@ -60,6 +60,8 @@ public:
 #endif
         bool disablePacketReuse             = false;
         bool enablePacketReuseTeamsAlways   = false;
+        bool enablePacketReusePlanCache     = false;
+        bool enableScalingLadder            = false;    // Submit 1:N outputs in one command buffer.
 
         VPHAL_HDR_LUT_MODE globalLutMode      = VPHAL_HDR_LUT_MODE_NONE;  //!< Global LUT mode control for debugging purpose
         bool               gpuGenerate3DLUT   = false;                        //!< Flag for per frame GPU generation of 3DLUT
@@ -140,6 +142,16 @@ public:
         return m_ctrlVal.enablePacketReuseTeamsAlways;
     }
 
+    bool IsPacketReusePlanCacheEnabled()
+    {
+        return m_ctrlVal.enablePacketReusePlanCache;
+    }
+
+    bool IsScalingLadderEnabled()
+    {
+        return m_ctrlVal.enableScalingLadder;
+    }
+
     uint32_t GetGlobalLutMode()
     {
         return m_ctrlVal.globalLutMode;
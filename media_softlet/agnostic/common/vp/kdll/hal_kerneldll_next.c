@@ -261,6 +261,117 @@ void KernelDll_MatrixProduct(
     dest[11] = m1[8] * m2[3] + m1[9] * m2[7] + m1[10] * m2[11] + m1[11];
 }
 
+//---------------------------------------------------------------------------------------
+// KernelDll_MatchCscCoeffCacheEntry - Checks if a cached coefficient set matches the
+//                                     requested conversion and procamp parameters
+//
+// Parameters:
+//    Kdll_CscCoeffCacheEntry *pEntry   - [in] Cache entry
+//    VPHAL_CSPACE             src      - [in] Source color space
+//    VPHAL_CSPACE             dst      - [in] Destination color space
+//    Kdll_Procamp            *pProcamp - [in] Procamp parameters (nullptr if none)
+//
+// Output: true if entry matches
+//---------------------------------------------------------------------------------------
+static bool KernelDll_MatchCscCoeffCacheEntry(
+    Kdll_CscCoeffCacheEntry *pEntry,
+    VPHAL_CSPACE             src,
+    VPHAL_CSPACE             dst,
+    Kdll_Procamp            *pProcamp)
+{
+    if (!pEntry->bValid                          ||
+        pEntry->SrcSpace != src                  ||
+        pEntry->DstSpace != dst                  ||
+        pEntry->bProcamp != (pProcamp != nullptr))
+    {
+        return false;
+    }
+
+    if (pProcamp)
+    {
+        return (pEntry->fBrightness == pProcamp->fBrightness &&
+                pEntry->fContrast   == pProcamp->fContrast   &&
+                pEntry->fHue        == pProcamp->fHue        &&
+                pEntry->fSaturation == pProcamp->fSaturation);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+// KernelDll_LookupCscCoeffCache - Looks up kernel CSC coefficients computed earlier for
+//                                 the same conversion and procamp parameters
+//
+// Parameters:
+//    Kdll_State      *pState   - [in/out] Kernel Dll state
+//    Kdll_CSC_Matrix *pMatrix  - [in/out] CSC matrix to fill
+//    Kdll_Procamp    *pProcamp - [in]     Procamp parameters (nullptr if none)
+//
+// Output: true if coefficients were found in the cache
+//---------------------------------------------------------------------------------------
+static bool KernelDll_LookupCscCoeffCache(
+    Kdll_State      *pState,
+    Kdll_CSC_Matrix *pMatrix,
+    Kdll_Procamp    *pProcamp)
+{
+    Kdll_CscCoeffCache *pCache = &pState->CscCoeffCache;
+    int32_t             i;
+
+    for (i = 0; i < DL_CSC_COEFF_CACHE_SIZE; i++)
+    {
+        Kdll_CscCoeffCacheEntry *pEntry = &pCache->Entry[i];
+        if (KernelDll_MatchCscCoeffCacheEntry(pEntry, pMatrix->SrcSpace, pMatrix->DstSpace, pProcamp))
+        {
+            MOS_SecureMemcpy(pMatrix->Coeff, sizeof(pMatrix->Coeff), pEntry->Coeff, sizeof(pEntry->Coeff));
+            if (pProcamp)
+            {
+                pMatrix->iProcampVersion = pProcamp->iProcampVersion;
+            }
+            pCache->uiHits++;
+            return true;
+        }
+    }
+
+    pCache->uiMisses++;
+    return false;
+}
+
+//---------------------------------------------------------------------------------------
+// KernelDll_StoreCscCoeffCache - Saves kernel CSC coefficients for later reuse,
+//                                replacing the oldest entry when the cache is full
+//
+// Parameters:
+//    Kdll_State      *pState   - [in/out] Kernel Dll state
+//    Kdll_CSC_Matrix *pMatrix  - [in]     CSC matrix with calculated coefficients
+//    Kdll_Procamp    *pProcamp - [in]     Procamp parameters (nullptr if none)
+//
+// Output: none
+//---------------------------------------------------------------------------------------
+static void KernelDll_StoreCscCoeffCache(
+    Kdll_State      *pState,
+    Kdll_CSC_Matrix *pMatrix,
+    Kdll_Procamp    *pProcamp)
+{
+    Kdll_CscCoeffCache      *pCache = &pState->CscCoeffCache;
+    Kdll_CscCoeffCacheEntry *pEntry = &pCache->Entry[pCache->uiNext];
+
+    pCache->uiNext = (pCache->uiNext + 1) % DL_CSC_COEFF_CACHE_SIZE;
+
+    MOS_ZeroMemory(pEntry, sizeof(*pEntry));
+    pEntry->SrcSpace = pMatrix->SrcSpace;
+    pEntry->DstSpace = pMatrix->DstSpace;
+    if (pProcamp)
+    {
+        pEntry->bProcamp    = true;
+        pEntry->fBrightness = pProcamp->fBrightness;
+        pEntry->fContrast   = pProcamp->fContrast;
+        pEntry->fHue        = pProcamp->fHue;
+        pEntry->fSaturation = pProcamp->fSaturation;
+    }
+    MOS_SecureMemcpy(pEntry->Coeff, sizeof(pEntry->Coeff), pMatrix->Coeff, sizeof(pMatrix->Coeff));
+    pEntry->bValid = true;
+}
+
 void KernelDll_UpdateCscCoefficients(Kdll_State *pState,
     Kdll_CSC_Matrix *                            pMatrix)
 {
@@ -287,6 +398,12 @@ void KernelDll_UpdateCscCoefficients(Kdll_State *pState,
         pProcamp = pState->pProcamp + pMatrix->iProcampID;
     }
 
+    // Reuse coefficients computed earlier for the same conversion and procamp
+    if (KernelDll_LookupCscCoeffCache(pState, pMatrix, pProcamp))
+    {
+        return;
+    }
+
     // Setup CSC matrix
     if (src != dst)
     {
@@ -424,6 +541,8 @@ void KernelDll_UpdateCscCoefficients(Kdll_State *pState,
 
     // Save matrix as kernel CSC coefficients
     pState->pfnMapCSCMatrix(csctype, matrix, pMatrix->Coeff);
+
+    KernelDll_StoreCscCoeffCache(pState, pMatrix, pProcamp);
 }
 
 //---------------------------------------------------------------------------------------
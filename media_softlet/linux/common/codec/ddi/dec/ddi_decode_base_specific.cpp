@@ -355,7 +355,7 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
                     bufMgr->pSliceData[slcInd].uiLength,
                     bufMgr->pSliceData[slcInd].pSliceBuf,
                     bufMgr->pSliceData[slcInd].uiLength);
-                MOS_FreeMemory(bufMgr->pSliceData[slcInd].pSliceBuf);
+                // slice buffer is owned by frame arena
                 bufMgr->pSliceData[slcInd].pSliceBuf    = nullptr;
                 bufMgr->pSliceData[slcInd].bIsUseExtBuf = false;
             }
@@ -574,10 +574,12 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         buf->uiOffset = bufMgr->pSliceData[index-1].uiOffset + bufMgr->pSliceData[index-1].uiLength;
         if ((buf->uiOffset + buf->iSize) > bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]->iSize)
         {
-            sliceBuf = (uint8_t*)MOS_AllocAndZeroMemory(buf->iSize);
+            // slice data may be created before BeginPicture, so the frame arena
+            // is only recycled once EndPicture has combined it into the bitstream
+            sliceBuf = (uint8_t*)m_frameArena.Alloc(buf->iSize);
             if (sliceBuf == nullptr)
             {
-                DDI_CODEC_ASSERTMESSAGE("DDI:AllocAndZeroMem return failure.")
+                DDI_CODEC_ASSERTMESSAGE("DDI:frame arena allocation failure.");
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
             bufMgr->bIsSliceOverSize = true;
@@ -1000,6 +1002,8 @@ VAStatus DdiDecodeBase::EndPicture(
     }
 #endif
 
+    m_frameArena.Reset();
+
     return VA_STATUS_SUCCESS;
 }
 
@@ -375,11 +375,8 @@ VAStatus DdiEncodeAvc::ParseMiscParamMultiPassFrameSize(void *data)
         {
             return VA_STATUS_ERROR_INVALID_PARAMETER;
         }
-        if (picParams->pDeltaQp != nullptr)
-        {
-            MOS_FreeMemory(picParams->pDeltaQp);
-        }
-        picParams->pDeltaQp = (uint8_t *)MOS_AllocAndZeroMemory(sizeof(uint8_t) * picParams->dwNumPasses);
+        // The delta QP list is only read by the current frame, so keep it in the frame arena
+        picParams->pDeltaQp = (uint8_t *)m_frameArena.Alloc(sizeof(uint8_t) * picParams->dwNumPasses);
         if (!picParams->pDeltaQp)
         {
             return VA_STATUS_ERROR_INVALID_PARAMETER;
@@ -1147,6 +1144,13 @@ VAStatus DdiEncodeAvc::ResetAtFrameLevel()
     m_encodeCtx->indexNALUnit     = 0x0;
     m_encodeCtx->uiSliceHeaderCnt = 0x0;
 
+    // delta QP lists of a frame which never reached EndPicture point into the recycled frame arena
+    PCODEC_AVC_ENCODE_PIC_PARAMS picParams = (PCODEC_AVC_ENCODE_PIC_PARAMS)(m_encodeCtx->pPicParams);
+    for (uint32_t i = 0; picParams != nullptr && i < CODEC_AVC_MAX_PPS_NUM; i++)
+    {
+        picParams[i].pDeltaQp = nullptr;
+    }
+
     // reset bsbuffer every frame
     m_encodeCtx->pbsBuffer->pCurrent    = m_encodeCtx->pbsBuffer->pBase;
     m_encodeCtx->pbsBuffer->SliceOffset = 0x0;
@@ -1935,7 +1939,8 @@ MOS_STATUS DdiEncodeAvc::CheckPackedSlcHeaderData(
     // Force first_mb_in_slice to 0 for AVC VDENC
     uint32_t LeftBitSize = InBitSize - InBits.GetBitOffset();
     OutBitSize = LeftBitSize + HdrBitSize + 1;
-    *ppOutSlcHdr = MOS_AllocAndZeroMemory((OutBitSize + 7) / 8);
+    *ppOutSlcHdr = m_frameArena.Alloc((OutBitSize + 7) / 8);
+    DDI_CODEC_CHK_NULL(*ppOutSlcHdr, "nullptr *ppOutSlcHdr", MOS_STATUS_NO_SPACE);
 
     AvcOutBits OutBits((uint8_t*)(*ppOutSlcHdr), OutBitSize);
 
@@ -2006,13 +2011,6 @@ VAStatus DdiEncodeAvc::ParsePackedHeaderData(void *ptr)
             (uint8_t *)(temp_ptr ? temp_ptr : ptr),
             hdrDataSize);
 
-        if (temp_ptr)
-        {
-            MOS_FreeMemory(temp_ptr);
-            temp_size = 0;
-            temp_ptr = NULL;
-        }
-
         if (MOS_STATUS_SUCCESS != status)
         {
             DDI_CODEC_ASSERTMESSAGE("DDI:packed slice header size is too large to be supported!");
@@ -2272,9 +2270,9 @@ void DdiEncodeAvc::ClearPicParams()
     uint8_t ppsIdx = ((PCODEC_AVC_ENCODE_SLICE_PARAMS)(m_encodeCtx->pSliceParams))->pic_parameter_set_id;
     PCODEC_AVC_ENCODE_PIC_PARAMS  picParams = (PCODEC_AVC_ENCODE_PIC_PARAMS)m_encodeCtx->pPicParams + ppsIdx;
 
-    if (picParams != nullptr && picParams->pDeltaQp != nullptr)
+    // pDeltaQp is owned by the frame arena, which is recycled at the end of EndPicture
+    if (picParams != nullptr)
     {
-        MOS_FreeMemory(picParams->pDeltaQp);
         picParams->pDeltaQp = nullptr;
     }
 }
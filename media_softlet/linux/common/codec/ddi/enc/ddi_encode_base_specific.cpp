@@ -61,6 +61,7 @@ VAStatus DdiEncodeBase::BeginPicture(
     }
     // reset some the parameters in picture level
     ResetAtFrameLevel();
+    m_frameArena.Reset();
 
     return VA_STATUS_SUCCESS;
 }
@@ -92,6 +93,8 @@ VAStatus DdiEncodeBase::EndPicture(
     bufMgr->dwNumSliceData           = 0;
     bufMgr->dwEncodeNumSliceControl  = 0;
 
+    m_frameArena.Reset();
+
     return VA_STATUS_SUCCESS;
 }
 
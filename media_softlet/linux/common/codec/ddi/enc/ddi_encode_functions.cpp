@@ -72,27 +72,26 @@ VAStatus DdiEncodeFunctions::CreateConfig (
         }
     }
 
-    auto configList = mediaCtx->m_capsNext->GetConfigList();
-    DDI_CODEC_CHK_NULL(configList, "Get configList failed", VA_STATUS_ERROR_INVALID_PARAMETER);
+    auto configRange = mediaCtx->m_capsNext->GetConfigRange(profile, entrypoint);
+    DDI_CODEC_CHK_NULL(configRange, "Get configRange failed", VA_STATUS_ERROR_INVALID_PARAMETER);
 
-    for(int i = 0; i < configList->size(); i++)
+    for(uint32_t i = configRange->base; i < configRange->base + configRange->count; i++)
     {
-        if((configList->at(i).profile == profile)        &&
-           (configList->at(i).entrypoint == entrypoint))
+        auto configItem = mediaCtx->m_capsNext->GetConfigItem(i);
+        DDI_CODEC_CHK_NULL(configItem, "Get configItem failed", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+        if((rcMode      == configItem->componentData.data.rcMode)       &&
+           (feiFunction == configItem->componentData.data.feiFunction))
         {
-            if((rcMode      == configList->at(i).componentData.data.rcMode)       &&
-               (feiFunction == configList->at(i).componentData.data.feiFunction))
+            uint32_t curConfigID = ADD_CONFIG_ID_ENC_OFFSET(i);
+            if(!mediaCtx->m_capsNext->m_capsTable->IsEncConfigId(curConfigID))
             {
-                uint32_t curConfigID = ADD_CONFIG_ID_ENC_OFFSET(i);
-                if(!mediaCtx->m_capsNext->m_capsTable->IsEncConfigId(curConfigID))
-                {
-                    DDI_CODEC_ASSERTMESSAGE("DDI: Invalid configID.");
-                    return VA_STATUS_ERROR_INVALID_CONFIG;
-                }
-
-                *configId = curConfigID;
-                return VA_STATUS_SUCCESS;
+                DDI_CODEC_ASSERTMESSAGE("DDI: Invalid configID.");
+                return VA_STATUS_ERROR_INVALID_CONFIG;
             }
+
+            *configId = curConfigID;
+            return VA_STATUS_SUCCESS;
         }
     }
 
@@ -59,7 +59,6 @@ DdiEncodeJpeg::~DdiEncodeJpeg()
     MOS_FreeMemory(m_encodeCtx->pbsBuffer);
     m_encodeCtx->pbsBuffer = nullptr;
 
-    MOS_FreeMemory(m_appData);
     m_appData = nullptr;
 }
 
@@ -235,6 +234,7 @@ VAStatus DdiEncodeJpeg::ResetAtFrameLevel()
 
     picParams->m_inputSurfaceFormat = ConvertMediaFormatToInputSurfaceFormat(m_encodeCtx->RTtbl.pCurrentRT->format);
 
+    m_appData = nullptr;
     m_appDataSize = 0;
     m_appDataTotalSize = 0;
     m_appDataWholeHeader = false;
@@ -462,39 +462,18 @@ VAStatus DdiEncodeJpeg::ParseAppData(void *ptr, int32_t size)
 
     uint32_t prevAppDataSize = m_appDataTotalSize;
 
-    if (m_appData == nullptr)
-    {
-        m_appData = (void *)MOS_AllocAndZeroMemory(size);
-
-        if (!m_appData)
-        {
-            return VA_STATUS_ERROR_ALLOCATION_FAILED;
-        }
+    // App data only lives until EndPicture, so it is kept in the frame arena.
+    // App data sent before in the same frame is copied in front of the new part.
+    void *appData = m_frameArena.Alloc(size + (int32_t)prevAppDataSize);
+    DDI_CODEC_CHK_NULL(appData, "nullptr appData.", VA_STATUS_ERROR_ALLOCATION_FAILED);
 
-        MOS_SecureMemcpy(m_appData, size, ptr, size);
-    }
-    else  // app data had been sent before
+    if (prevAppDataSize > 0)
     {
-        void *tempAppData = (void *)MOS_AllocAndZeroMemory(size + (int32_t)prevAppDataSize);
-
-        if (nullptr == tempAppData)
-        {
-            return VA_STATUS_ERROR_ALLOCATION_FAILED;
-        }
-
-        // Copy over previous app data to a new location
-        MOS_SecureMemcpy(tempAppData, prevAppDataSize, (uint8_t *)m_appData, prevAppDataSize);
-
-        uint8_t *newAddress = (uint8_t *)tempAppData + prevAppDataSize;
-
-        // Add new app data buffer to the new location
-        MOS_SecureMemcpy(newAddress, size, (uint8_t *)ptr, size);
-
-        // Now free the previous location containing app data and overwrite with new app data buffer
-        MOS_FreeMemory(m_appData);
-        m_appData = tempAppData;
-
+        MOS_SecureMemcpy(appData, prevAppDataSize, (uint8_t *)m_appData, prevAppDataSize);
     }
+    MOS_SecureMemcpy((uint8_t *)appData + prevAppDataSize, size, (uint8_t *)ptr, size);
+
+    m_appData = appData;
 
     m_appDataTotalSize += size;
 
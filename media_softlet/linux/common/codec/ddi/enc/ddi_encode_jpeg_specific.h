@@ -276,7 +276,7 @@ private:
     uint32_t ConvertMediaFormatToInputSurfaceFormat(DDI_MEDIA_FORMAT format);
 
     CodecEncodeJpegHuffmanDataArray    *m_huffmanTable = nullptr;    //!< Huffman table.
-    void                               *m_appData      = nullptr;    //!< Application data.
+    void                               *m_appData      = nullptr;    //!< Application data, kept in the frame arena.
     bool                               m_quantSupplied = false;      //!< whether Quant table is supplied by the app for JPEG encoder.
     uint32_t                           m_appDataTotalSize   = 0;          //!< Total size of application data.
     uint32_t                           m_appDataSize   = 0;          //!< Size of application data.
@@ -284,11 +284,11 @@ VAStatus DdiEncodeVp9::EncodeInCodecHal(uint32_t numSlices)
             codecProfile = m_encodeCtx->vaProfile - VAProfileVP9Profile0;
         }
 
-        Vp9WriteUncompressHeader(m_encodeCtx,
-                                   codecProfile,
-                                   m_encodeCtx->pbsBuffer->pBase,
-                                   &headerLen,
-                                   &picBitOffset);
+        m_headerWriter.Write(m_encodeCtx,
+                             codecProfile,
+                             m_encodeCtx->pbsBuffer->pBase,
+                             &headerLen,
+                             &picBitOffset);
 
         vp9PicParam->BitOffsetForFirstPartitionSize = picBitOffset.bit_offset_first_partition_size;
         vp9PicParam->BitOffsetForQIndex             = picBitOffset.bit_offset_qindex;
@@ -30,6 +30,7 @@
 #define __DDI_ENCODER_VP9_SPECIFIC_H__
 
 #include "ddi_encode_base_specific.h"
+#include "media_libvpx_vp9_next.h"
 namespace encode
 {
 //!
@@ -311,6 +312,8 @@ private:
 
     VACodedBufferVP9Status *m_codedBufStatus = nullptr; //!< .Coded buffer status
 
+    Vp9UncompressHeaderWriter m_headerWriter; //!< Uncompressed header writer, keeps the header of the last frame
+
 private:
 
 //!
@@ -44,65 +44,23 @@
 #include <stdint.h>
 
 #include "media_libvpx_vp9_next.h"
+#include "bitstream_writer.h"
 
-struct vp9_write_bit_buffer {
-    uint8_t *bit_buffer;
-    int bit_offset;
-};
-
-static
-void vp9_wb_write_bit(struct vp9_write_bit_buffer *wb, int bit)
-{
-    const int off = wb->bit_offset;
-    const int p = off / 8;
-    const int q = 7 - off % 8;
-
-    if (q == 7)
-    {
-        wb->bit_buffer[p] = bit << q;
-    }
-    else
-    {
-        wb->bit_buffer[p] &= ~(1 << q);
-        wb->bit_buffer[p] |= bit << q;
-    }
-    wb->bit_offset = off + 1;
-}
+#define    VP9_SYNC_CODE_0    0x49
+#define    VP9_SYNC_CODE_1    0x83
+#define    VP9_SYNC_CODE_2    0x42
 
-static
-void vp9_wb_write_literal(struct vp9_write_bit_buffer *wb, int data, int bits)
-{
-    int bit;
-    for (bit = bits - 1; bit >= 0; bit--)
-        vp9_wb_write_bit(wb, (data >> bit) & 1);
-}
+#define    VP9_FRAME_MARKER   0x2
 
-static
-void write_bitdepth_colorspace_sampling(uint32_t codecProfile,
-                                        struct vp9_write_bit_buffer *wb)
-{
+#define    REFS_PER_FRAME     3
 
-    if (codecProfile >= VP9_PROFILE_2)
-    {
-        /* Profile 2 can support 10/12 bits */
-        /* Currently it is 10 bits */
-        vp9_wb_write_literal(wb, 0, 1);
-    }
+#define    REF_FRAMES_LOG2    3
+#define    REF_FRAMES         (1 << REF_FRAMES_LOG2)
 
-    /* Add the default color-space */
-    vp9_wb_write_literal(wb, 0, 3);
-    vp9_wb_write_bit(wb, 0);  // 0: [16, 235] (i.e. xvYCC), 1: [0, 255]
+#define    VP9_KEY_FRAME      0
 
-    if ((codecProfile == VP9_PROFILE_1) ||
-        (codecProfile == VP9_PROFILE_3))
-    {
-        /* sub_sampling_x/y */
-        /* Currently the sub_sampling_x = 0, sub_sampling_y = 0 */
-        vp9_wb_write_bit(wb, 0);
-        vp9_wb_write_bit(wb, 0);
-        vp9_wb_write_bit(wb, 0); // unused
-    }
-}
+#define    SWITCHABLE_FILTER    4
+#define    FILTER_MASK          3
 
 #define    MAX_TILE_WIDTH_B64    64
 #define    MIN_TILE_WIDTH_B64    4
@@ -127,195 +85,199 @@ static int get_max_log2_tile_cols(const int sb_cols)
     return max_log2 - 1;
 }
 
-bool Vp9WriteUncompressHeader(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
-                                uint32_t codecProfile,
-                                uint8_t  *headerData,
-                                uint32_t *headerLen,
-                                vp9_header_bitoffset *headerBitoffset)
+//!
+//! \brief  Value of a frame varying header field, as written to the header
+//!
+static uint32_t GetFieldValue(uint8_t id, const CODEC_VP9_ENCODE_PIC_PARAMS *picParam)
 {
-#define    VP9_SYNC_CODE_0    0x49
-#define    VP9_SYNC_CODE_1    0x83
-#define    VP9_SYNC_CODE_2    0x42
-
-#define    VP9_FRAME_MARKER   0x2
-
-#define    REFS_PER_FRAME     3
+    static const uint32_t filter_to_literal[4] = { 1, 0, 2, 3 };
 
-#define    REF_FRAMES_LOG2    3
-#define    REF_FRAMES         (1 << REF_FRAMES_LOG2)
+    switch (id)
+    {
+    case Vp9UncompressHeaderWriter::resetFrameContext:
+        return picParam->PicFlags.fields.reset_frame_context;
+    case Vp9UncompressHeaderWriter::refreshFrameFlags:
+        return picParam->RefFlags.fields.refresh_frame_flags;
+    case Vp9UncompressHeaderWriter::lastRef:
+        return (picParam->RefFlags.fields.LastRefIdx << 1) | picParam->RefFlags.fields.LastRefSignBias;
+    case Vp9UncompressHeaderWriter::goldenRef:
+        return (picParam->RefFlags.fields.GoldenRefIdx << 1) | picParam->RefFlags.fields.GoldenRefSignBias;
+    case Vp9UncompressHeaderWriter::altRef:
+        return (picParam->RefFlags.fields.AltRefIdx << 1) | picParam->RefFlags.fields.AltRefSignBias;
+    case Vp9UncompressHeaderWriter::allowHighPrecisionMv:
+        return picParam->PicFlags.fields.allow_high_precision_mv;
+    case Vp9UncompressHeaderWriter::interpFilter:
+        return filter_to_literal[picParam->PicFlags.fields.mcomp_filter_type & FILTER_MASK];
+    case Vp9UncompressHeaderWriter::refreshFrameContext:
+        return (picParam->PicFlags.fields.refresh_frame_context << 1) | picParam->PicFlags.fields.frame_parallel_decoding_mode;
+    case Vp9UncompressHeaderWriter::frameContextIdx:
+        return picParam->PicFlags.fields.frame_context_idx;
+    case Vp9UncompressHeaderWriter::filterLevel:
+        return (picParam->filter_level << 3) | (picParam->sharpness_level & 7);
+    case Vp9UncompressHeaderWriter::qIndex:
+        return picParam->LumaACQIndex;
+    default:
+        break;
+    }
 
-#define    VP9_KEY_FRAME      0
+    int delta = 0;
+    if (id >= Vp9UncompressHeaderWriter::refLfDelta && id < Vp9UncompressHeaderWriter::refLfDelta + 4)
+    {
+        delta = picParam->LFRefDelta[id - Vp9UncompressHeaderWriter::refLfDelta];
+    }
+    else if (id >= Vp9UncompressHeaderWriter::modeLfDelta && id < Vp9UncompressHeaderWriter::modeLfDelta + 2)
+    {
+        // The mode deltas have always been written from LFRefDelta, keep the same bits
+        delta = picParam->LFRefDelta[id - Vp9UncompressHeaderWriter::modeLfDelta];
+    }
+    else
+    {
+        delta = (id == Vp9UncompressHeaderWriter::yDcDeltaQ)  ? picParam->LumaDCQIndexDelta :
+                (id == Vp9UncompressHeaderWriter::uvDcDeltaQ) ? picParam->ChromaDCQIndexDelta :
+                                                                picParam->ChromaACQIndexDelta;
+    }
 
-    if ((ddiEncContext == nullptr) ||
-        (headerData == nullptr) ||
-        (headerLen == nullptr) ||
-        (headerBitoffset == nullptr))
-        return false;
+    // Magnitude followed by the sign bit
+    return ((uint32_t)abs(delta) << 1) | (delta < 0);
+}
 
-    CODEC_VP9_ENCODE_PIC_PARAMS *picParam = (CODEC_VP9_ENCODE_PIC_PARAMS *)ddiEncContext->pPicParams;
-    CODEC_VP9_ENCODE_SEGMENT_PARAMS *segParams = (CODEC_VP9_ENCODE_SEGMENT_PARAMS *)ddiEncContext->pVpxSegParams;
+static void write_bitdepth_colorspace_sampling(uint32_t codecProfile,
+                                        BitstreamWriter &bs)
+{
+    if (codecProfile >= VP9_PROFILE_2)
+    {
+        /* Profile 2 can support 10/12 bits */
+        /* Currently it is 10 bits */
+        bs.PutBit(0);
+    }
 
-    if (picParam == nullptr)
-        return false;
+    /* Add the default color-space, 0: [16, 235] (i.e. xvYCC), 1: [0, 255] */
+    bs.PutBits(4, 0);
 
-    struct vp9_write_bit_buffer *wb, vp9_wb;
+    if ((codecProfile == VP9_PROFILE_1) ||
+        (codecProfile == VP9_PROFILE_3))
+    {
+        /* sub_sampling_x/y */
+        /* Currently the sub_sampling_x = 0, sub_sampling_y = 0 */
+        bs.PutBits(3, 0);  // last bit unused
+    }
+}
 
-    memset(headerBitoffset, 0, sizeof(vp9_header_bitoffset));
+static void write_frame_size(const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, BitstreamWriter &bs)
+{
+    /* write the encoded frame size */
+    bs.PutBits(16, picParam->DstFrameWidthMinus1);
+    bs.PutBits(16, picParam->DstFrameHeightMinus1);
 
-    vp9_wb.bit_buffer = (uint8_t *)headerData;
-    vp9_wb.bit_offset = 0;
-    wb = &vp9_wb;
-    vp9_wb_write_literal(wb, VP9_FRAME_MARKER, 2);
+    /* write display size */
+    if ((picParam->DstFrameWidthMinus1 != picParam->SrcFrameWidthMinus1) ||
+        (picParam->DstFrameHeightMinus1 != picParam->SrcFrameHeightMinus1))
+    {
+        bs.PutBit(1);
+        bs.PutBits(16, picParam->SrcFrameWidthMinus1);
+        bs.PutBits(16, picParam->SrcFrameHeightMinus1);
+    }
+    else
+    {
+        bs.PutBit(0);
+    }
+}
 
-    /* Only Profile0/1/2/3 is supported */
-    if (codecProfile > VP9_PROFILE_3)
-        codecProfile = VP9_PROFILE_0;
+void Vp9UncompressHeaderWriter::PutField(BitstreamWriter &bs, const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, uint8_t id, uint8_t bits)
+{
+    if (m_numFields < maxFields)
+    {
+        m_fields[m_numFields++] = {(uint16_t)bs.GetOffset(), id, bits};
+    }
+    bs.PutBits(bits, GetFieldValue(id, picParam) & ((1 << bits) - 1));
+}
 
-    switch(codecProfile)
+void Vp9UncompressHeaderWriter::PutDelta(BitstreamWriter &bs, const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, uint8_t id, int delta)
+{
+    if (delta)
     {
-    case VP9_PROFILE_0:
-        //Profile 0
-        vp9_wb_write_literal(wb, 0, 2);
-        break;
-    case VP9_PROFILE_1:
-        //Profile 1
-        vp9_wb_write_literal(wb, 2, 2);
-        break;
-    case VP9_PROFILE_2:
-        //Profile 2
-        vp9_wb_write_literal(wb, 1, 2);
-        break;
-    case VP9_PROFILE_3:
-        vp9_wb_write_literal(wb, 6, 3);
-        break;
-    default:
-        break;
+        bs.PutBit(1);
+        PutField(bs, picParam, id, 5);
     }
+    else
+    {
+        bs.PutBit(0);
+    }
+}
+
+void Vp9UncompressHeaderWriter::WriteHeader(
+    BitstreamWriter                   &bs,
+    const CODEC_VP9_ENCODE_PIC_PARAMS *picParam,
+    uint32_t                           codecProfile,
+    vp9_header_bitoffset              *headerBitoffset)
+{
+    static const uint32_t profile_to_literal[4] = { 0, 2, 1, 6 };
+
+    m_numFields = 0;
+
+    bs.PutBits(2, VP9_FRAME_MARKER);
+    /* Profile 3 has a reserved zero bit */
+    bs.PutBits(codecProfile == VP9_PROFILE_3 ? 3 : 2, profile_to_literal[codecProfile]);
 
-    vp9_wb_write_bit(wb, 0);  // show_existing_frame
-    vp9_wb_write_bit(wb, picParam->PicFlags.fields.frame_type);
-    vp9_wb_write_bit(wb, picParam->PicFlags.fields.show_frame);
-    vp9_wb_write_bit(wb, picParam->PicFlags.fields.error_resilient_mode);
+    bs.PutBit(0);  // show_existing_frame
+    bs.PutBit(picParam->PicFlags.fields.frame_type);
+    bs.PutBit(picParam->PicFlags.fields.show_frame);
+    bs.PutBit(picParam->PicFlags.fields.error_resilient_mode);
 
     if (picParam->PicFlags.fields.frame_type == VP9_KEY_FRAME)
     {
-        vp9_wb_write_literal(wb, VP9_SYNC_CODE_0, 8);
-        vp9_wb_write_literal(wb, VP9_SYNC_CODE_1, 8);
-        vp9_wb_write_literal(wb, VP9_SYNC_CODE_2, 8);
-
-        write_bitdepth_colorspace_sampling(codecProfile, wb);
-
-        /* write the encoded frame size */
-        vp9_wb_write_literal(wb, picParam->DstFrameWidthMinus1, 16);
-        vp9_wb_write_literal(wb, picParam->DstFrameHeightMinus1, 16);
-        /* write display size */
-        if ((picParam->DstFrameWidthMinus1 != picParam->SrcFrameWidthMinus1) ||
-            (picParam->DstFrameHeightMinus1 != picParam->SrcFrameHeightMinus1))
-        {
-            vp9_wb_write_bit(wb, 1);
-            vp9_wb_write_literal(wb, picParam->SrcFrameWidthMinus1, 16);
-            vp9_wb_write_literal(wb, picParam->SrcFrameHeightMinus1, 16);
-        }
-        else
-        {
-            vp9_wb_write_bit(wb, 0);
-        }
+        bs.PutBits(24, (VP9_SYNC_CODE_0 << 16) | (VP9_SYNC_CODE_1 << 8) | VP9_SYNC_CODE_2);
+
+        write_bitdepth_colorspace_sampling(codecProfile, bs);
+        write_frame_size(picParam, bs);
     }
     else
     {
         /* for the non-Key frame */
         if (!picParam->PicFlags.fields.show_frame)
         {
-            vp9_wb_write_bit(wb, picParam->PicFlags.fields.intra_only);
+            bs.PutBit(picParam->PicFlags.fields.intra_only);
         }
 
         if (!picParam->PicFlags.fields.error_resilient_mode)
         {
-            vp9_wb_write_literal(wb, picParam->PicFlags.fields.reset_frame_context, 2);
+            PutField(bs, picParam, resetFrameContext, 2);
         }
 
         if (picParam->PicFlags.fields.intra_only)
         {
-            vp9_wb_write_literal(wb, VP9_SYNC_CODE_0, 8);
-            vp9_wb_write_literal(wb, VP9_SYNC_CODE_1, 8);
-            vp9_wb_write_literal(wb, VP9_SYNC_CODE_2, 8);
+            bs.PutBits(24, (VP9_SYNC_CODE_0 << 16) | (VP9_SYNC_CODE_1 << 8) | VP9_SYNC_CODE_2);
 
             /* Add the bit_depth for VP9Profile1/2/3 */
             if (codecProfile)
-                write_bitdepth_colorspace_sampling(codecProfile, wb);
-
-            /* write the refreshed_frame_flags */
-            vp9_wb_write_literal(wb, picParam->RefFlags.fields.refresh_frame_flags, REF_FRAMES);
-            /* write the encoded frame size */
-            vp9_wb_write_literal(wb, picParam->DstFrameWidthMinus1, 16);
-            vp9_wb_write_literal(wb, picParam->DstFrameHeightMinus1, 16);
-            /* write display size */
-            if ((picParam->DstFrameWidthMinus1 != picParam->SrcFrameWidthMinus1) ||
-                (picParam->DstFrameHeightMinus1 != picParam->SrcFrameHeightMinus1))
-            {
-                vp9_wb_write_bit(wb, 1);
-                vp9_wb_write_literal(wb, picParam->SrcFrameWidthMinus1, 16);
-                vp9_wb_write_literal(wb, picParam->SrcFrameHeightMinus1, 16);
-            }
-            else
-            {
-                vp9_wb_write_bit(wb, 0);
-            }
+                write_bitdepth_colorspace_sampling(codecProfile, bs);
+
+            PutField(bs, picParam, refreshFrameFlags, REF_FRAMES);
+            write_frame_size(picParam, bs);
         }
         else
         {
             /* The refresh_frame_map is  for the next frame so that it can select Last/Godlen/Alt ref_index */
-            /*
-            if ((picParam->RefFlags.fields.ref_frame_ctrl_l0) & (1 << 0))
-                refresh_flags = 1 << picParam->RefFlags.fields.ref_last_idx;
-            if ((picParam->RefFlags.fields.ref_frame_ctrl_l0) & (1 << 0))
-                refresh_flags = 1 << picParam->RefFlags.fields.ref_last_idx;
-            if ((picParam->RefFlags.fields.ref_frame_ctrl_l0) & (1 << 0))
-                refresh_flags = 1 << picParam->RefFlags.fields.ref_last_idx;
-            */
-            vp9_wb_write_literal(wb, picParam->RefFlags.fields.refresh_frame_flags, REF_FRAMES);
-
-            vp9_wb_write_literal(wb, picParam->RefFlags.fields.LastRefIdx, REF_FRAMES_LOG2);
-            vp9_wb_write_bit(wb, picParam->RefFlags.fields.LastRefSignBias);
-            vp9_wb_write_literal(wb, picParam->RefFlags.fields.GoldenRefIdx, REF_FRAMES_LOG2);
-            vp9_wb_write_bit(wb, picParam->RefFlags.fields.GoldenRefSignBias);
-            vp9_wb_write_literal(wb, picParam->RefFlags.fields.AltRefIdx, REF_FRAMES_LOG2);
-            vp9_wb_write_bit(wb, picParam->RefFlags.fields.AltRefSignBias);
+            PutField(bs, picParam, refreshFrameFlags, REF_FRAMES);
 
-            /* write three bits with zero so that it can parse width/height directly */
-            vp9_wb_write_literal(wb, 0, 3);
-            vp9_wb_write_literal(wb, picParam->DstFrameWidthMinus1, 16);
-            vp9_wb_write_literal(wb, picParam->DstFrameHeightMinus1, 16);
+            PutField(bs, picParam, lastRef, REF_FRAMES_LOG2 + 1);
+            PutField(bs, picParam, goldenRef, REF_FRAMES_LOG2 + 1);
+            PutField(bs, picParam, altRef, REF_FRAMES_LOG2 + 1);
 
-            /* write display size */
-            if ((picParam->DstFrameWidthMinus1 != picParam->SrcFrameWidthMinus1) ||
-                (picParam->DstFrameHeightMinus1 != picParam->SrcFrameHeightMinus1))
-            {
-                vp9_wb_write_bit(wb, 1);
-                vp9_wb_write_literal(wb, picParam->SrcFrameWidthMinus1, 16);
-                vp9_wb_write_literal(wb, picParam->SrcFrameHeightMinus1, 16);
-            }
-            else
-            {
-                vp9_wb_write_bit(wb, 0);
-            }
+            /* write three bits with zero so that it can parse width/height directly */
+            bs.PutBits(3, 0);
+            write_frame_size(picParam, bs);
 
-            vp9_wb_write_bit(wb, picParam->PicFlags.fields.allow_high_precision_mv);
-
-#define    SWITCHABLE_FILTER    4
-#define    FILTER_MASK          3
+            PutField(bs, picParam, allowHighPrecisionMv, 1);
 
             if (picParam->PicFlags.fields.mcomp_filter_type == SWITCHABLE_FILTER)
             {
-                vp9_wb_write_bit(wb, 1);
+                bs.PutBit(1);
             }
             else
             {
-                const int filter_to_literal[4] = { 1, 0, 2, 3 };
-                uint8_t filter_flag = picParam->PicFlags.fields.mcomp_filter_type;
-                filter_flag = filter_flag & FILTER_MASK;
-                vp9_wb_write_bit(wb, 0);
-                vp9_wb_write_literal(wb, filter_to_literal[filter_flag], 2);
+                bs.PutBit(0);
+                PutField(bs, picParam, interpFilter, 2);
             }
         }
     }
@@ -323,121 +285,51 @@ bool Vp9WriteUncompressHeader(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
     /* write refresh_frame_context/paralle frame_decoding */
     if (!picParam->PicFlags.fields.error_resilient_mode)
     {
-        vp9_wb_write_bit(wb, picParam->PicFlags.fields.refresh_frame_context);
-        vp9_wb_write_bit(wb, picParam->PicFlags.fields.frame_parallel_decoding_mode);
+        PutField(bs, picParam, refreshFrameContext, 2);
     }
 
-    vp9_wb_write_literal(wb, picParam->PicFlags.fields.frame_context_idx, 2);
+    PutField(bs, picParam, frameContextIdx, 2);
 
     /* write loop filter */
-    headerBitoffset->bit_offset_lf_level = wb->bit_offset;
-    vp9_wb_write_literal(wb, picParam->filter_level, 6);
-    vp9_wb_write_literal(wb, picParam->sharpness_level, 3);
-
-    {
-        int i, mode_flag;
-
-        vp9_wb_write_bit(wb, 1);
-        vp9_wb_write_bit(wb, 1);
-        headerBitoffset->bit_offset_ref_lf_delta = wb->bit_offset;
-        for (i = 0; i < 4; i++)
-        {
-            /*
-             * This check is skipped to prepare the bit_offset_lf_ref
-            if (picParam->LFRefDelta[i] == 0) {
-                vp9_wb_write_bit(wb, 0);
-                continue;
-            }
-             */
-            vp9_wb_write_bit(wb, 1);
-            mode_flag = picParam->LFRefDelta[i];
-            if (mode_flag >= 0)
-            {
-                vp9_wb_write_literal(wb, mode_flag & (0x3F), 6);
-                vp9_wb_write_bit(wb, 0);
-            }
-            else
-            {
-                mode_flag = -mode_flag;
-                vp9_wb_write_literal(wb, mode_flag & (0x3F), 6);
-                vp9_wb_write_bit(wb, 1);
-            }
-        }
+    headerBitoffset->bit_offset_lf_level = bs.GetOffset();
+    PutField(bs, picParam, filterLevel, 9);
 
-        headerBitoffset->bit_offset_mode_lf_delta = wb->bit_offset;
-        for (i = 0; i < 2; i++)
-        {
-            /*
-             * This check is skipped to prepare the bit_offset_lf_mode
-            if (picParam->LFModeDelta[i] == 0) {
-                vp9_wb_write_bit(wb, 0);
-                continue;
-            }
-             */
-            vp9_wb_write_bit(wb, 1);
-            mode_flag = picParam->LFRefDelta[i];
-            if (mode_flag >= 0)
-            {
-                vp9_wb_write_literal(wb, mode_flag & (0x3F), 6);
-                vp9_wb_write_bit(wb, 0);
-            }
-            else
-            {
-                mode_flag = -mode_flag;
-                vp9_wb_write_literal(wb, mode_flag & (0x3F), 6);
-                vp9_wb_write_bit(wb, 1);
-            }
-        }
-    }
+    /* mode_ref_delta_enabled and mode_ref_delta_update */
+    bs.PutBits(2, 3);
 
-    /* write basic quantizer */
-    headerBitoffset->bit_offset_qindex = wb->bit_offset;
-    vp9_wb_write_literal(wb, picParam->LumaACQIndex, 8);
-    if (picParam->LumaDCQIndexDelta)
-    {
-        int delta_q = picParam->LumaDCQIndexDelta;
-        vp9_wb_write_bit(wb, 1);
-        vp9_wb_write_literal(wb, abs(delta_q), 4);
-        vp9_wb_write_bit(wb, delta_q < 0);
-    }
-    else
+    /* every delta is sent so that the bit offsets of the deltas are fixed */
+    headerBitoffset->bit_offset_ref_lf_delta = bs.GetOffset();
+    for (uint8_t i = 0; i < 4; i++)
     {
-        vp9_wb_write_bit(wb, 0);
+        bs.PutBit(1);
+        PutField(bs, picParam, refLfDelta + i, 7);
     }
 
-    if (picParam->ChromaDCQIndexDelta)
+    headerBitoffset->bit_offset_mode_lf_delta = bs.GetOffset();
+    for (uint8_t i = 0; i < 2; i++)
     {
-        int delta_q = picParam->ChromaDCQIndexDelta;
-        vp9_wb_write_bit(wb, 1);
-        vp9_wb_write_literal(wb, abs(delta_q), 4);
-        vp9_wb_write_bit(wb, delta_q < 0);
-    }
-    else
-    {
-        vp9_wb_write_bit(wb, 0);
+        bs.PutBit(1);
+        PutField(bs, picParam, modeLfDelta + i, 7);
     }
 
-    if (picParam->ChromaACQIndexDelta)
-    {
-        int delta_q = picParam->ChromaACQIndexDelta;
-        vp9_wb_write_bit(wb, 1);
-        vp9_wb_write_literal(wb, abs(delta_q), 4);
-        vp9_wb_write_bit(wb, delta_q < 0);
-    }
-    else
-    {
-        vp9_wb_write_bit(wb, 0);
-    }
+    /* write basic quantizer */
+    headerBitoffset->bit_offset_qindex = bs.GetOffset();
+    PutField(bs, picParam, qIndex, 8);
+    PutDelta(bs, picParam, yDcDeltaQ, picParam->LumaDCQIndexDelta);
+    PutDelta(bs, picParam, uvDcDeltaQ, picParam->ChromaDCQIndexDelta);
+    PutDelta(bs, picParam, uvAcDeltaQ, picParam->ChromaACQIndexDelta);
 
-    headerBitoffset->bit_offset_segmentation = wb->bit_offset;
-    vp9_wb_write_bit(wb, picParam->PicFlags.fields.segmentation_enabled);
+    headerBitoffset->bit_offset_segmentation = bs.GetOffset();
     if (picParam->PicFlags.fields.segmentation_enabled)
     {
         // Segmentation syntax will be filled by HW, need leave dummy here.
-        vp9_wb_write_bit(wb, 0);
-        vp9_wb_write_bit(wb, 0);
+        bs.PutBits(3, 4);
     }
-    headerBitoffset->bit_size_segmentation = wb->bit_offset - headerBitoffset->bit_offset_segmentation;
+    else
+    {
+        bs.PutBit(0);
+    }
+    headerBitoffset->bit_size_segmentation = bs.GetOffset() - headerBitoffset->bit_offset_segmentation;
 
     /* write tile info */
     {
@@ -450,30 +342,127 @@ bool Vp9WriteUncompressHeader(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
         max_log2_tile_cols = get_max_log2_tile_cols(sb_cols);
 
         col_data = picParam->log2_tile_columns - min_log2_tile_cols;
-        while (col_data--)
+        if (col_data > 0)
         {
-            vp9_wb_write_bit(wb, 1);
+            bs.PutBits(col_data, (1 << col_data) - 1);
         }
         if (picParam->log2_tile_columns < max_log2_tile_cols)
         {
-            vp9_wb_write_bit(wb, 0);
+            bs.PutBit(0);
         }
 
-        /* write tile row info */
-        vp9_wb_write_bit(wb, picParam->log2_tile_rows);
+        /* write tile row info: 0 as "0", 1 as "1 0" and 2 as "1 1". The
+         * bit by bit writer used before passed log2_tile_rows itself as
+         * the first bit, so 2 wrote "0" and set the previous bit instead. */
+        bs.PutBit(picParam->log2_tile_rows != 0);
         if (picParam->log2_tile_rows)
         {
-            vp9_wb_write_bit(wb, (picParam->log2_tile_rows != 1));
+            bs.PutBit(picParam->log2_tile_rows != 1);
         }
     }
 
     /* get the bit_offset of the first partition size */
-    headerBitoffset->bit_offset_first_partition_size = wb->bit_offset;
+    headerBitoffset->bit_offset_first_partition_size = bs.GetOffset();
 
     /* reserve the space for writing the first partitions ize */
-    vp9_wb_write_literal(wb, 0, 16);
+    bs.PutBits(16, 0);
+}
 
-    *headerLen = (wb->bit_offset + 7) / 8;
+void Vp9UncompressHeaderWriter::GetLayout(
+    const CODEC_VP9_ENCODE_PIC_PARAMS *picParam,
+    uint32_t                           codecProfile,
+    Layout                            &layout)
+{
+    MOS_ZeroMemory(&layout, sizeof(layout));
+
+    layout.profile    = codecProfile;
+    layout.frameFlags = picParam->PicFlags.fields.frame_type |
+                        (picParam->PicFlags.fields.show_frame << 1) |
+                        (picParam->PicFlags.fields.error_resilient_mode << 2) |
+                        (picParam->PicFlags.fields.intra_only << 3) |
+                        (picParam->PicFlags.fields.segmentation_enabled << 4) |
+                        ((picParam->PicFlags.fields.mcomp_filter_type == SWITCHABLE_FILTER) << 5) |
+                        ((picParam->LumaDCQIndexDelta != 0) << 6) |
+                        ((picParam->ChromaDCQIndexDelta != 0) << 7) |
+                        ((picParam->ChromaACQIndexDelta != 0) << 8);
+    layout.dstSize    = (picParam->DstFrameWidthMinus1 << 16) | picParam->DstFrameHeightMinus1;
+    layout.srcSize    = (picParam->SrcFrameWidthMinus1 << 16) | picParam->SrcFrameHeightMinus1;
+    layout.tiles      = (picParam->log2_tile_columns << 8) | picParam->log2_tile_rows;
+}
+
+bool Vp9UncompressHeaderWriter::Write(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
+                                      uint32_t codecProfile,
+                                      uint8_t  *headerData,
+                                      uint32_t *headerLen,
+                                      vp9_header_bitoffset *headerBitoffset)
+{
+    if ((ddiEncContext == nullptr) ||
+        (headerData == nullptr) ||
+        (headerLen == nullptr) ||
+        (headerBitoffset == nullptr))
+        return false;
+
+    CODEC_VP9_ENCODE_PIC_PARAMS *picParam = (CODEC_VP9_ENCODE_PIC_PARAMS *)ddiEncContext->pPicParams;
+
+    if (picParam == nullptr)
+        return false;
+
+    /* Only Profile0/1/2/3 is supported */
+    if (codecProfile > VP9_PROFILE_3)
+        codecProfile = VP9_PROFILE_0;
+
+    Layout layout;
+    GetLayout(picParam, codecProfile, layout);
+
+    if (m_headerLen && !memcmp(&layout, &m_layout, sizeof(layout)))
+    {
+        // Same layout as the cached header: only the frame varying fields move
+        MOS_SecureMemcpy(headerData, m_headerLen, m_header, m_headerLen);
+        for (uint32_t i = 0; i < m_numFields; i++)
+        {
+            // The 16 bit first partition size follows every field, so a field
+            // of up to 9 bits never reaches past the end of the header
+            const Field &field = m_fields[i];
+            uint8_t     *data  = headerData + (field.offset >> 3);
+            uint32_t     shift = 16 - (field.offset & 7) - field.bits;
+            uint32_t     mask  = ((1 << field.bits) - 1) << shift;
+            uint32_t     word  = (data[0] << 8) | data[1];
+
+            word    = (word & ~mask) | ((GetFieldValue(field.id, picParam) << shift) & mask);
+            data[0] = (uint8_t)(word >> 8);
+            data[1] = (uint8_t)word;
+        }
+
+        *headerBitoffset = m_bitOffset;
+        *headerLen       = m_headerLen;
+        return true;
+    }
+
+    memset(headerBitoffset, 0, sizeof(vp9_header_bitoffset));
+
+    BitstreamWriter bs(headerData, sizeof(m_header));
+    WriteHeader(bs, picParam, codecProfile, headerBitoffset);
+    *headerLen = (bs.GetOffset() + 7) / 8;
+
+    m_headerLen = 0;
+    if (*headerLen <= sizeof(m_header) && m_numFields < maxFields)
+    {
+        MOS_SecureMemcpy(m_header, sizeof(m_header), headerData, *headerLen);
+        m_layout    = layout;
+        m_bitOffset = *headerBitoffset;
+        m_headerLen = *headerLen;
+    }
 
     return true;
 }
+
+bool Vp9WriteUncompressHeader(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
+                                uint32_t codecProfile,
+                                uint8_t  *headerData,
+                                uint32_t *headerLen,
+                                vp9_header_bitoffset *headerBitoffset)
+{
+    Vp9UncompressHeaderWriter writer;
+
+    return writer.Write(ddiEncContext, codecProfile, headerData, headerLen, headerBitoffset);
+}
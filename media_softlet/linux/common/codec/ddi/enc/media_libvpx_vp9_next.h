@@ -62,6 +62,92 @@ typedef struct _vp9_header_bitoffset_ {
     uint32_t    bit_size_segmentation;
 } vp9_header_bitoffset;
 
+class BitstreamWriter;
+
+//!
+//! \class  Vp9UncompressHeaderWriter
+//! \brief  Writes the VP9 uncompressed header with word level writes
+//! \details The header of the last frame is kept together with the bit offsets of
+//!          its frame varying fields. A frame with the same layout (profile, frame
+//!          type and flags, frame size, delta q presence and tile info) reuses it and
+//!          only patches those fields in.
+//!
+class Vp9UncompressHeaderWriter
+{
+public:
+    //!
+    //! \brief  Frame varying header fields, patched in on a cached header
+    //!
+    enum FieldId
+    {
+        resetFrameContext = 0,
+        refreshFrameFlags,
+        lastRef,                //!< Ref index and sign bias
+        goldenRef,
+        altRef,
+        allowHighPrecisionMv,
+        interpFilter,
+        refreshFrameContext,    //!< refresh_frame_context and frame_parallel_decoding_mode
+        frameContextIdx,
+        filterLevel,            //!< filter_level and sharpness_level
+        qIndex,
+        refLfDelta,             //!< Four ref deltas
+        modeLfDelta = refLfDelta + 4,  //!< Two mode deltas
+        yDcDeltaQ = modeLfDelta + 2,
+        uvDcDeltaQ,
+        uvAcDeltaQ
+    };
+
+    //!
+    //! \brief  Write the uncompressed header of the current picture
+    //! \return bool
+    //!         true if success, else false
+    //!
+    bool Write(encode::DDI_ENCODE_CONTEXT *ddiEncContext,
+               uint32_t codecProfile,
+               uint8_t  *headerData,
+               uint32_t *headerLen,
+               vp9_header_bitoffset *headerBitoffset);
+
+protected:
+    struct Layout
+    {
+        uint32_t profile;
+        uint32_t frameFlags;
+        uint32_t dstSize;
+        uint32_t srcSize;
+        uint32_t tiles;
+    };
+
+    struct Field
+    {
+        uint16_t offset;
+        uint8_t  id;
+        uint8_t  bits;
+    };
+
+    static constexpr uint32_t maxFields     = 24;
+    static constexpr uint32_t maxHeaderSize = 64;
+
+    void GetLayout(const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, uint32_t codecProfile, Layout &layout);
+
+    void WriteHeader(BitstreamWriter &bs,
+                     const CODEC_VP9_ENCODE_PIC_PARAMS *picParam,
+                     uint32_t codecProfile,
+                     vp9_header_bitoffset *headerBitoffset);
+
+    void PutField(BitstreamWriter &bs, const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, uint8_t id, uint8_t bits);
+
+    void PutDelta(BitstreamWriter &bs, const CODEC_VP9_ENCODE_PIC_PARAMS *picParam, uint8_t id, int delta);
+
+    Layout               m_layout    = {};
+    vp9_header_bitoffset m_bitOffset = {};
+    Field                m_fields[maxFields];
+    uint32_t             m_numFields = 0;
+    uint8_t              m_header[maxHeaderSize];
+    uint32_t             m_headerLen = 0;  //!< 0 if no header is cached
+};
+
 bool Vp9WriteUncompressHeader(encode::DDI_ENCODE_CONTEXT *ddiContext,
                                        uint32_t codecProfile,
                                        uint8_t  *headerData,
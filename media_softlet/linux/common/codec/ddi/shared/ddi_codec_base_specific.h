@@ -32,6 +32,7 @@
 #include <va/va_backend.h>
 
 #include "ddi_codec_def_specific.h"
+#include "ddi_codec_frame_arena_specific.h"
 #include "media_libva_common_next.h"
 
 namespace codec
@@ -186,6 +187,8 @@ protected:
     //!           VA_STATUS_SUCCESS if success, else fail reason
     //!
     VAStatus UpdateRegisteredRTSurfaceFlag(DDI_CODEC_RENDER_TARGET_TABLE *rtTbl, DDI_MEDIA_SURFACE *surface);
+
+    DdiCodecFrameArena m_frameArena;  //!< Storage for per frame parameters, recycled at EndPicture
 MEDIA_CLASS_DEFINE_END(codec__DdiCodecBase)
 };
 
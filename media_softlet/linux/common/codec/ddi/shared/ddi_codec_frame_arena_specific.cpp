@@ -0,0 +1,124 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     ddi_codec_frame_arena_specific.cpp
+//! \brief    Implements per context frame arena for softlet DDI codec parameter marshaling.
+//!
+
+#include "ddi_codec_frame_arena_specific.h"
+#include "media_libva_util_next.h"
+
+namespace codec
+{
+static const size_t blockHeaderSize = MOS_ALIGN_CEIL(sizeof(void *) + 2 * sizeof(size_t), DdiCodecFrameArena::m_alignment);
+
+DdiCodecFrameArena::~DdiCodecFrameArena()
+{
+    Release();
+}
+
+DdiCodecFrameArena::Block *DdiCodecFrameArena::AddBlock(size_t size)
+{
+    Block *block = (Block *)MOS_AllocMemory(blockHeaderSize + size);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    block->next = m_blocks;
+    block->size = size;
+    block->used = 0;
+    m_blocks    = block;
+
+    m_frameHeapAllocCount++;
+    m_heapAllocCount++;
+    return block;
+}
+
+void *DdiCodecFrameArena::Alloc(size_t size)
+{
+    size = MOS_ALIGN_CEIL(size ? size : 1, m_alignment);
+
+    Block *block = m_blocks;
+    if (block == nullptr || block->size - block->used < size)
+    {
+        size_t blockSize = m_defaultBlockSize;
+        if (block)
+        {
+            blockSize = block->size * 2;
+        }
+        block = AddBlock(MOS_MAX(blockSize, size));
+        if (block == nullptr)
+        {
+            DDI_CODEC_ASSERTMESSAGE("DDI: frame arena failed to allocate %zu bytes.", size);
+            return nullptr;
+        }
+    }
+
+    uint8_t *data = (uint8_t *)block + blockHeaderSize + block->used;
+    block->used += size;
+    m_frameAllocCount++;
+
+    MOS_ZeroMemory(data, size);
+    return data;
+}
+
+void DdiCodecFrameArena::Reset()
+{
+    if (m_frameAllocCount || m_frameHeapAllocCount)
+    {
+        DDI_CODEC_VERBOSEMESSAGE("DDI: frame arena served %u allocations with %u heap allocations.",
+            m_frameAllocCount, m_frameHeapAllocCount);
+    }
+
+    if (m_blocks && m_blocks->next)
+    {
+        // The frame spilled over several blocks; replace them with one block
+        // big enough for the whole frame so the next one stays off the heap.
+        size_t totalSize = 0;
+        for (Block *block = m_blocks; block; block = block->next)
+        {
+            totalSize += block->size;
+        }
+        Release();
+        AddBlock(totalSize);
+    }
+    else if (m_blocks)
+    {
+        m_blocks->used = 0;
+    }
+
+    m_frameAllocCount     = 0;
+    m_frameHeapAllocCount = 0;
+}
+
+void DdiCodecFrameArena::Release()
+{
+    while (m_blocks)
+    {
+        Block *next = m_blocks->next;
+        MOS_FreeMemory(m_blocks);
+        m_blocks = next;
+    }
+}
+
+}
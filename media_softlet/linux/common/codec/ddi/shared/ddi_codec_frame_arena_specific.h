@@ -0,0 +1,125 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     ddi_codec_frame_arena_specific.h
+//! \brief    Defines per context frame arena for softlet DDI codec parameter marshaling
+//!
+
+#ifndef _DDI_CODEC_FRAME_ARENA_SPECIFIC_H_
+#define _DDI_CODEC_FRAME_ARENA_SPECIFIC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "media_class_trace.h"
+
+namespace codec
+{
+//!
+//! \class  DdiCodecFrameArena
+//! \brief  Bump allocator for storage which only lives until the EndPicture of a frame.
+//! \details It serves the DDI allocations made anew for every frame: oversized decode
+//!          slice data, AVC VDENC packed slice headers, AVC delta QP lists and JPEG
+//!          app data. Parameter arrays kept for the life of the context stay on the heap.
+//!          Decode slice data may be allocated before BeginPicture, so the owner must
+//!          only call Reset() once the frame has consumed it.
+//!          Memory is returned zeroed, is never freed individually and is recycled as a
+//!          whole by Reset(). When a frame spills into more than one block the blocks
+//!          are merged on Reset(), so steady state runs without heap traffic.
+//!
+class DdiCodecFrameArena
+{
+public:
+    //!
+    //! \brief Constructor
+    //!
+    DdiCodecFrameArena() {}
+
+    //!
+    //! \brief Destructor
+    //!
+    virtual ~DdiCodecFrameArena();
+
+    //!
+    //! \brief    Allocate zeroed storage valid until next Reset
+    //!
+    //! \param    [in] size
+    //!           Size in bytes
+    //!
+    //! \return   void *
+    //!           Pointer to storage if success, else nullptr
+    //!
+    void *Alloc(size_t size);
+
+    //!
+    //! \brief    Recycle all storage handed out in current frame
+    //!
+    void Reset();
+
+    //!
+    //! \brief    Free all blocks owned by the arena
+    //!
+    void Release();
+
+    //!
+    //! \brief    Get number of allocations served in current frame
+    //!
+    uint32_t GetFrameAllocCount() const { return m_frameAllocCount; }
+
+    //!
+    //! \brief    Get number of heap allocations made by the arena in current frame
+    //!
+    uint32_t GetFrameHeapAllocCount() const { return m_frameHeapAllocCount; }
+
+    //!
+    //! \brief    Get number of heap allocations made by the arena since creation
+    //!
+    uint32_t GetHeapAllocCount() const { return m_heapAllocCount; }
+
+    static const size_t m_alignment        = 16;          //!< Alignment of each allocation
+    static const size_t m_defaultBlockSize = 64 * 1024;   //!< Size of first block
+
+private:
+    //!
+    //! \brief    Block header, payload follows directly
+    //!
+    struct Block
+    {
+        Block  *next;
+        size_t  size;
+        size_t  used;
+    };
+
+    //!
+    //! \brief    Allocate a new block and make it current
+    //!
+    Block *AddBlock(size_t size);
+
+    Block    *m_blocks              = nullptr;  //!< Current block, older blocks are chained after it
+    uint32_t  m_frameAllocCount     = 0;        //!< Allocations served since last Reset
+    uint32_t  m_frameHeapAllocCount = 0;        //!< Heap blocks acquired since last Reset
+    uint32_t  m_heapAllocCount      = 0;        //!< Heap blocks acquired since creation
+
+MEDIA_CLASS_DEFINE_END(codec__DdiCodecFrameArena)
+};
+
+}
+#endif /*  _DDI_CODEC_FRAME_ARENA_SPECIFIC_H_ */
@@ -31,6 +31,7 @@
 #include "linux_system_info.h"
 #include "media_libva_caps_factory.h"
 #include "ddi_cp_caps_interface.h"
+#include <algorithm>
 
 bool operator<(const ComponentInfo &lhs, const ComponentInfo &rhs)
 {
@@ -39,6 +40,15 @@ bool operator<(const ComponentInfo &lhs, const ComponentInfo &rhs)
 
 MediaCapsTableSpecific::~MediaCapsTableSpecific()
 {
+    DDI_NORMALMESSAGE("Materialized %d of %d configs", (int)m_materializedConfigNum, (int)m_configNum);
+
+    for (auto configs : m_configBlocks)
+    {
+        MOS_DeleteArray(configs);
+    }
+    m_configBlocks.clear();
+    MOS_DeleteArray(m_configList);
+
     if(m_cpCaps)
     {
         MOS_Delete(m_cpCaps);
@@ -96,27 +106,114 @@ VAStatus MediaCapsTableSpecific::Init(DDI_MEDIA_CONTEXT *mediaCtx)
             auto attriblist     = entrypointData->attribList;
             DDI_CHK_NULL(attriblist, "Null pointer", VA_STATUS_ERROR_INVALID_PARAMETER);
 
-            auto componentData  = entrypointData->configDataList;
-            int32_t numAttribList = attriblist->size();
-            if(componentData && componentData->size() != 0)
-            {
-                for(int i = 0; i < componentData->size(); i++)
-                {
-                    auto configData = componentData->at(i);
-                    m_configList.emplace_back(profile, entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
-                }
-            }
-            else
-            {
-                ComponentData configData = {};
-                m_configList.emplace_back(profile, entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
-            }
+            // Only reserve config index range here, configs are materialized on first query
+            auto        componentData = entrypointData->configDataList;
+            ConfigRange range         = {};
+            range.base  = m_configNum;
+            range.count = (componentData && componentData->size() != 0) ? componentData->size() : 1;
+
+            ComponentInfo info(profile, entrypoint);
+            m_configRangeMap[info] = range;
+            m_configBaseList.emplace_back(range.base, info);
+            m_configNum += range.count;
         }
     }
 
+    m_configList = MOS_NewArray(std::atomic<ConfigLinux *>, m_configNum);
+    DDI_CHK_NULL(m_configList, "Null pointer", VA_STATUS_ERROR_ALLOCATION_FAILED);
+
     return VA_STATUS_SUCCESS;
 }
 
+VAStatus MediaCapsTableSpecific::MaterializeConfigs(const ComponentInfo &info, const ConfigRange &range)
+{
+    DDI_FUNC_ENTER;
+
+    auto entrypointData = m_profileMap->at(info.profile)->at(info.entrypoint);
+    DDI_CHK_NULL(entrypointData, "Null pointer", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    auto attriblist = entrypointData->attribList;
+    DDI_CHK_NULL(attriblist, "Null pointer", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    ConfigLinux *configs = MOS_NewArray(ConfigLinux, range.count);
+    DDI_CHK_NULL(configs, "Null pointer", VA_STATUS_ERROR_ALLOCATION_FAILED);
+    m_configBlocks.push_back(configs);
+
+    auto    componentData = entrypointData->configDataList;
+    int32_t numAttribList = attriblist->size();
+    for (uint32_t i = 0; i < range.count; i++)
+    {
+        ComponentData configData = {};
+        if (componentData && componentData->size() != 0)
+        {
+            configData = componentData->at(i);
+        }
+        configs[i] = ConfigLinux(info.profile, info.entrypoint, const_cast<VAConfigAttrib*>(attriblist->data()), numAttribList, configData);
+        // Publish the config only after it is complete, lock free readers may pick it up right away
+        m_configList[range.base + i].store(&configs[i], std::memory_order_release);
+    }
+    m_materializedConfigNum += range.count;
+
+    return VA_STATUS_SUCCESS;
+}
+
+const ConfigRange* MediaCapsTableSpecific::QueryConfigRange(
+    VAProfile      profile,
+    VAEntrypoint   entrypoint)
+{
+    DDI_FUNC_ENTER;
+
+    auto it = m_configRangeMap.find(ComponentInfo(profile, entrypoint));
+    if (it == m_configRangeMap.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+ConfigLinux* MediaCapsTableSpecific::QueryConfigItem(uint32_t index)
+{
+    DDI_FUNC_ENTER;
+
+    if (index >= m_configNum || m_configList == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Materialized configs are never changed again, so no lock is needed to read them
+    ConfigLinux *config = m_configList[index].load(std::memory_order_acquire);
+    if (config != nullptr)
+    {
+        return config;
+    }
+
+    std::lock_guard<std::mutex> lock(m_configMutex);
+
+    // Another thread may have materialized the range while waiting for the lock
+    config = m_configList[index].load(std::memory_order_acquire);
+    if (config != nullptr)
+    {
+        return config;
+    }
+
+    // Find the profile and entrypoint which owns the index, and materialize all its configs
+    auto baseIter = std::upper_bound(
+        m_configBaseList.begin(),
+        m_configBaseList.end(),
+        index,
+        [](uint32_t idx, const std::pair<uint32_t, ComponentInfo> &item) { return idx < item.first; });
+    DDI_CHK_CONDITION((baseIter == m_configBaseList.begin()), "Invalid config index", nullptr);
+    --baseIter;
+
+    if (MaterializeConfigs(baseIter->second, m_configRangeMap[baseIter->second]) != VA_STATUS_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    return m_configList[index].load(std::memory_order_acquire);
+}
+
 VAStatus MediaCapsTableSpecific::QueryConfigProfiles(
     VAProfile *profileList,
     int32_t   *profilesNum)
@@ -171,13 +268,6 @@ AttribList* MediaCapsTableSpecific::QuerySupportedAttrib(
     return const_cast<AttribList*>(m_profileMap->at(profile)->at(entrypoint)->attribList);
 }
 
-ConfigList* MediaCapsTableSpecific::GetConfigList()
-{
-    DDI_FUNC_ENTER;
-
-    return &m_configList;
-}
-
 ConfigLinux* MediaCapsTableSpecific::QueryConfigItemFromIndex(
     VAConfigID     configId)
 {
@@ -189,24 +279,24 @@ ConfigLinux* MediaCapsTableSpecific::QueryConfigItemFromIndex(
         return nullptr;
     }
 
-    if(IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < m_configList.size())
+    if(IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < m_configNum)
     {
-        return &m_configList[REMOVE_CONFIG_ID_DEC_OFFSET(configId)];
+        return QueryConfigItem(REMOVE_CONFIG_ID_DEC_OFFSET(configId));
     }
-    else if(IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < m_configList.size())
+    else if(IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < m_configNum)
     {
-        return &m_configList[REMOVE_CONFIG_ID_ENC_OFFSET(configId)];
+        return QueryConfigItem(REMOVE_CONFIG_ID_ENC_OFFSET(configId));
     }
-    else if(IsVpConfigId(configId) && REMOVE_CONFIG_ID_VP_OFFSET(configId) < m_configList.size())
+    else if(IsVpConfigId(configId) && REMOVE_CONFIG_ID_VP_OFFSET(configId) < m_configNum)
     {
-        return &m_configList[REMOVE_CONFIG_ID_VP_OFFSET(configId)];
+        return QueryConfigItem(REMOVE_CONFIG_ID_VP_OFFSET(configId));
     }
     else if((m_cpCaps != nullptr) && (m_cpCaps->IsCpConfigId(configId)))
     {
         uint32_t index = m_cpCaps->GetCpConfigId(configId);
-        DDI_CHK_CONDITION((index >=  m_configList.size()), "Invalid config ID", nullptr)
+        DDI_CHK_CONDITION((index >=  m_configNum), "Invalid config ID", nullptr)
 
-        return &m_configList[index];
+        return QueryConfigItem(index);
     }
     else
     {
@@ -228,22 +318,19 @@ VAStatus MediaCapsTableSpecific::CreateConfig(
     DDI_UNUSED(numAttribs);
     DDI_UNUSED(configId);
 
-    VAStatus ret = VA_STATUS_ERROR_UNSUPPORTED_PROFILE;
-    for (auto configItem : m_configList)
+    // check profile, entrypoint here
+    auto profileIter = m_profileMap->find(profile);
+    if (profileIter == m_profileMap->end() || profileIter->second == nullptr || profileIter->second->empty())
     {
-        // check profile, entrypoint here
-        if (configItem.profile == profile)
-        {
-            ret = VA_STATUS_ERROR_UNSUPPORTED_ENTRYPOINT;
-            if(configItem.entrypoint == entrypoint)
-            {
-                ret = VA_STATUS_SUCCESS;
-                break;
-            }
-        }
+        return VA_STATUS_ERROR_UNSUPPORTED_PROFILE;
     }
 
-    return ret;
+    if (QueryConfigRange(profile, entrypoint) == nullptr)
+    {
+        return VA_STATUS_ERROR_UNSUPPORTED_ENTRYPOINT;
+    }
+
+    return VA_STATUS_SUCCESS;
 }
 
 bool MediaCapsTableSpecific::IsDecConfigId(VAConfigID configId)
@@ -304,7 +391,7 @@ VAStatus MediaCapsTableSpecific::DestroyConfig(VAConfigID configId)
         return VA_STATUS_ERROR_INVALID_CONFIG;
     }
 
-    if(index < m_configList.size())
+    if(index < m_configNum)
     {
         DDI_NORMALMESSAGE("Succeed Destroy config ID");
         status = VA_STATUS_SUCCESS;
@@ -30,6 +30,8 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <mutex>
+#include <atomic>
 
 #include "va/va.h"
 #include "va/va_drmcommon.h"
@@ -76,6 +78,16 @@ struct ConfigLinux
 
 typedef std::vector<ConfigLinux> ConfigList;
 
+//!
+//! \struct ConfigRange
+//! \brief  Range of config index for one profile and entrypoint
+//!
+struct ConfigRange
+{
+    uint32_t base  = 0;
+    uint32_t count = 0;
+};
+
 #define CONFIG_ATTRIB_NONE 0x00000000
 
 // This offset is for cap fallback enabling, can be removed when all refactor done
@@ -103,11 +115,42 @@ private:
     ImgTable      *m_imgTbl     = nullptr;
     DdiCpCapsInterface *m_cpCaps = nullptr;
 
-public:
     //!
-    //! \brief  Store config
+    //! \brief  Config index range of each profile and entrypoint, built at init
+    //!
+    std::map<ComponentInfo, ConfigRange>        m_configRangeMap = {};
+    //!
+    //! \brief  Profile and entrypoint of each range, sorted by base index
+    //!
+    std::vector<std::pair<uint32_t, ComponentInfo>> m_configBaseList = {};
+    //!
+    //! \brief  Config of each config index, nullptr until its range is materialized on first query.
+    //!         Entries are only written once under m_configMutex, so readers of a set entry need no lock.
+    //!
+    std::atomic<ConfigLinux *>                   *m_configList = nullptr;
     //!
-    ConfigList m_configList = {};
+    //! \brief  Config arrays of the materialized ranges
+    //!
+    std::vector<ConfigLinux *>                   m_configBlocks = {};
+    uint32_t                                     m_configNum  = 0;
+    uint32_t                                     m_materializedConfigNum = 0;
+    std::mutex                                   m_configMutex;
+
+    //!
+    //! \brief    Materialize all configs of specific profile and entrypoint
+    //!
+    //! \param    [in] info
+    //!           profile and entrypoint
+    //!
+    //! \param    [in] range
+    //!           config index range of the profile and entrypoint
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success
+    //!
+    VAStatus MaterializeConfigs(const ComponentInfo &info, const ConfigRange &range);
+
+public:
 
     //!
     //! \brief    Constructor
@@ -128,9 +171,46 @@ public:
     VAStatus Init(DDI_MEDIA_CONTEXT *mediaCtx);
 
     //!
-    //! \brief    Get configlist, this is for component createConfig
+    //! \brief    Get config index range of specific profile and entrypoint,
+    //!           this is for component createConfig
+    //!
+    //! \param    [in] profile
+    //!           VA profile
+    //!
+    //! \param    [in] entrypoint
+    //!           VA entrypoint
+    //!
+    //! \return   ConfigRange*
+    //!           nullptr if profile and entrypoint is not supported
+    //!
+    const ConfigRange* QueryConfigRange(
+        VAProfile      profile,
+        VAEntrypoint   entrypoint);
+
+    //!
+    //! \brief    Get config item by config list index, config is materialized on first query
+    //!
+    //! \param    [in] index
+    //!           config list index
+    //!
+    //! \return   ConfigLinux*
+    //!           nullptr if invalid index
+    //!
+    ConfigLinux* QueryConfigItem(uint32_t index);
+
+    //!
+    //! \brief    Get total number of configs
+    //!
+    uint32_t GetConfigNum() { return m_configNum; }
+
+    //!
+    //! \brief    Get number of configs materialized so far, to measure the saving of lazy materializing
     //!
-    ConfigList* GetConfigList();
+    uint32_t GetMaterializedConfigNum()
+    {
+        std::lock_guard<std::mutex> lock(m_configMutex);
+        return m_materializedConfigNum;
+    }
 
     //!
     //! \brief    Get Image Table
@@ -65,9 +65,18 @@ VAStatus MediaLibvaCapsNext::Init()
     return m_capsTable->Init(m_mediaCtx);
 }
 
-ConfigList* MediaLibvaCapsNext::GetConfigList()
+const ConfigRange* MediaLibvaCapsNext::GetConfigRange(VAProfile profile, VAEntrypoint entrypoint)
 {
-    return m_capsTable->GetConfigList();
+    DDI_CHK_NULL(m_capsTable, "Caps table is null", nullptr);
+
+    return m_capsTable->QueryConfigRange(profile, entrypoint);
+}
+
+ConfigLinux* MediaLibvaCapsNext::GetConfigItem(uint32_t index)
+{
+    DDI_CHK_NULL(m_capsTable, "Caps table is null", nullptr);
+
+    return m_capsTable->QueryConfigItem(index);
 }
 
 VAStatus MediaLibvaCapsNext::GetAttribValue(
@@ -53,11 +53,29 @@ public:
     VAStatus Init();
 
     //!
-    //! \brief    Get configlist for create configs
+    //! \brief    Get config index range of profile and entrypoint for create configs
     //!
-    //! \return   All supported ConfigLinuxList
+    //! \param    [in] profile
+    //!           VA profile
+    //!
+    //! \param    [in] entrypoint
+    //!           VA entrypoint
+    //!
+    //! \return   ConfigRange*
+    //!           nullptr if profile and entrypoint is not supported
+    //!
+    const ConfigRange* GetConfigRange(VAProfile profile, VAEntrypoint entrypoint);
+
+    //!
+    //! \brief    Get config item by config list index
+    //!
+    //! \param    [in] index
+    //!           config list index
+    //!
+    //! \return   ConfigLinux*
+    //!           nullptr if invalid index
     //!
-    ConfigList* GetConfigList();
+    ConfigLinux* GetConfigItem(uint32_t index);
 
     //!
     //! \brief    Get Attrib Value
@@ -1123,19 +1123,19 @@ VAStatus MediaLibvaInterfaceNext::CreateContext (
         }
     }
 
-    if(mediaDrvCtx->m_capsNext->m_capsTable->IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    if(mediaDrvCtx->m_capsNext->m_capsTable->IsDecConfigId(configId) && REMOVE_CONFIG_ID_DEC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->GetConfigNum())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompDecode],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompDecode]->CreateContext(
             ctx, configId, pictureWidth, pictureHeight, flag, renderTarget, renderTargetsNum, context);
     }
-    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsEncConfigId(configId) && REMOVE_CONFIG_ID_ENC_OFFSET(configId) < mediaDrvCtx->m_capsNext->m_capsTable->GetConfigNum())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompEncode],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompEncode]->CreateContext(
             ctx, configId, pictureWidth, pictureHeight, flag, renderTarget, renderTargetsNum, context);
     }
-    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsVpConfigId(configId) && mediaDrvCtx->m_capsNext->m_capsTable->m_configList.size())
+    else if(mediaDrvCtx->m_capsNext->m_capsTable->IsVpConfigId(configId) && mediaDrvCtx->m_capsNext->m_capsTable->GetConfigNum())
     {
         DDI_CHK_NULL(mediaDrvCtx->m_compList[CompVp],  "nullptr complist",  VA_STATUS_ERROR_INVALID_CONTEXT);
         vaStatus = mediaDrvCtx->m_compList[CompVp]->CreateContext(
@@ -4981,12 +4981,28 @@ VAStatus MediaLibvaInterfaceNext::CopyInternal(
     PMOS_RESOURCE   dst,
     uint32_t        copy_mode
 )
+{
+    return CopyListInternal(mosCtx, &src, &dst, 1, copy_mode);
+}
+
+VAStatus MediaLibvaInterfaceNext::CopyListInternal(
+    PMOS_CONTEXT    mosCtx,
+    PMOS_RESOURCE   *src,
+    PMOS_RESOURCE   *dst,
+    uint32_t        copyNum,
+    uint32_t        copy_mode
+)
 {
     VAStatus   vaStatus  = VA_STATUS_SUCCESS;
     MOS_STATUS mosStatus = MOS_STATUS_UNINITIALIZED;
     DDI_CHK_NULL(mosCtx, "nullptr mosCtx",            VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CHK_NULL(src,    "nullptr input osResource",  VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_CHK_NULL(dst,    "nullptr output osResource", VA_STATUS_ERROR_INVALID_SURFACE);
+    for (uint32_t i = 0; i < copyNum; i++)
+    {
+        DDI_CHK_NULL(src[i], "nullptr input osResource",  VA_STATUS_ERROR_INVALID_SURFACE);
+        DDI_CHK_NULL(dst[i], "nullptr output osResource", VA_STATUS_ERROR_INVALID_SURFACE);
+    }
 
     MediaCopyBaseState *mediaCopyState = static_cast<MediaCopyBaseState*>(*mosCtx->ppMediaCopyState);
 
@@ -4998,7 +5014,7 @@ VAStatus MediaLibvaInterfaceNext::CopyInternal(
 
     DDI_CHK_NULL(mediaCopyState, "Invalid mediaCopy State", VA_STATUS_ERROR_INVALID_PARAMETER);
 
-    mosStatus = mediaCopyState->SurfaceCopy(src, dst, (MCPY_METHOD)copy_mode);
+    mosStatus = mediaCopyState->SurfaceCopyList(src, dst, copyNum, (MCPY_METHOD)copy_mode);
     if (mosStatus != MOS_STATUS_SUCCESS)
     {
         vaStatus = VA_STATUS_ERROR_INVALID_PARAMETER;
@@ -1123,6 +1123,31 @@ public:
         uint32_t        copy_mode
     );
 
+    //!
+    //! \brief  media copy list internal
+    //!
+    //! \param  [in] mosCtx
+    //!         Pointer to mos context
+    //! \param  [in] src
+    //!         Array of VA copy mos resource src.
+    //! \param  [in] dst
+    //!         Array of VA copy mos resrouce dst.
+    //! \param  [in] copyNum
+    //!         Number of copies.
+    //! \param  [in] option
+    //!         VA copy option, copy mode.
+    //!
+    //! \return VAStatus
+    //!     VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    static VAStatus CopyListInternal(
+        PMOS_CONTEXT    mosCtx,
+        PMOS_RESOURCE   *src,
+        PMOS_RESOURCE   *dst,
+        uint32_t        copyNum,
+        uint32_t        copy_mode
+    );
+
 #if VA_CHECK_VERSION(1,10,0)
     //!
     //! \brief  media copy
@@ -30,6 +30,7 @@
 #include "mos_os.h"
 #include "mos_defs.h"
 #include "hwinfo_linux.h"
+#include "mos_context_specific_next.h"
 #include "ddi_decode_base_specific.h"
 #include "media_ddi_encode_base.h"
 //#include "ddi_libva_decoder_specific.h"
@@ -1159,6 +1160,11 @@ void* MediaLibvaUtilNext::LockSurfaceInternal(DDI_MEDIA_SURFACE  *surface, uint3
     DDI_CHK_NULL(surface->bo, "nullptr surface->bo", nullptr);
     DDI_CHK_NULL(surface->pMediaCtx, "nullptr surface->pMediaCtx", nullptr);
 
+    // Mapping a BO which is still referenced by GPU waits for GPU idle.
+    OsContextSpecificNext *lockStallProfiler = GetLockStallProfiler(surface->pMediaCtx);
+    bool                   boBusy            = lockStallProfiler ? (mos_bo_busy(surface->bo) != 0) : false;
+    double                 lockStartTime     = lockStallProfiler ? MosUtilities::MosGetTime() : 0;
+
     if (surface->pMediaCtx->bIsAtomSOC)
     {
         mos_bo_map_gtt(surface->bo);
@@ -1251,9 +1257,30 @@ void* MediaLibvaUtilNext::LockSurfaceInternal(DDI_MEDIA_SURFACE  *surface, uint3
     surface->data_size = surface->bo->size;
     surface->bMapped   = true;
 
+    if (lockStallProfiler)
+    {
+        char resName[64];
+        MOS_SecureStringPrint(resName, sizeof(resName), sizeof(resName), "VA surface %dx%d format %d",
+            surface->iWidth, surface->iRealHeight, surface->format);
+        lockStallProfiler->RecordLockStall(resName, (flag & MOS_LOCKFLAG_WRITEONLY) != 0, boBusy,
+            MosUtilities::MosGetTime() - lockStartTime);
+    }
+
     return surface->pData;
 }
 
+OsContextSpecificNext *MediaLibvaUtilNext::GetLockStallProfiler(PDDI_MEDIA_CONTEXT mediaCtx)
+{
+    if (mediaCtx == nullptr || mediaCtx->m_osDeviceContext == MOS_INVALID_HANDLE)
+    {
+        return nullptr;
+    }
+
+    // OS device context of DDI is always created as OsContextSpecificNext on Linux
+    OsContextSpecificNext *osContext = static_cast<OsContextSpecificNext *>(mediaCtx->m_osDeviceContext);
+    return osContext->IsLockStallProfilerEnabled() ? osContext : nullptr;
+}
+
 void MediaLibvaUtilNext::UnlockSurface(DDI_MEDIA_SURFACE  *surface)
 {
     DDI_FUNC_ENTER;
@@ -1370,6 +1397,10 @@ void* MediaLibvaUtilNext::LockBuffer(DDI_MEDIA_BUFFER *buf, uint32_t flag)
         }
         else
         {
+            OsContextSpecificNext *lockStallProfiler = GetLockStallProfiler(buf->pMediaCtx);
+            bool                   boBusy            = lockStallProfiler ? (mos_bo_busy(buf->bo) != 0) : false;
+            double                 lockStartTime     = lockStallProfiler ? MosUtilities::MosGetTime() : 0;
+
             if (buf->pMediaCtx->bIsAtomSOC)
             {
                 mos_bo_map_gtt(buf->bo);
@@ -1387,6 +1418,14 @@ void* MediaLibvaUtilNext::LockBuffer(DDI_MEDIA_BUFFER *buf, uint32_t flag)
              }
 
             buf->pData = (uint8_t*)(buf->bo->virt);
+
+            if (lockStallProfiler)
+            {
+                char resName[64];
+                MOS_SecureStringPrint(resName, sizeof(resName), sizeof(resName), "VA buffer type %u", buf->uiType);
+                lockStallProfiler->RecordLockStall(resName, (flag & MOS_LOCKFLAG_WRITEONLY) != 0, boBusy,
+                    MosUtilities::MosGetTime() - lockStartTime);
+            }
         }
 
         buf->bMapped = true;
@@ -214,6 +214,8 @@ struct MEDIA_SURFACE_ALLOCATE_PARAM
 #define FPS_FILE_NAME   "./fps.txt"
 #endif
 
+class OsContextSpecificNext;
+
 class MediaLibvaUtilNext
 {
 private:
@@ -451,6 +453,16 @@ private:
         PDDI_MEDIA_BUFFER     mediaBuffer,
         MOS_BUFMGR            *bufmgr);
 
+    //!
+    //! \brief  Get OS device context recording lock stalls
+    //! \param  [in] mediaCtx
+    //!         Pointer to media context
+    //!
+    //! \return OsContextSpecificNext*
+    //!     OS device context, nullptr if lock stall profiler is disabled
+    //!
+    static OsContextSpecificNext *GetLockStallProfiler(PDDI_MEDIA_CONTEXT mediaCtx);
+
 public:
     //!
     //! \brief  Allocate pmedia surface from heap
@@ -32,6 +32,11 @@
 #include "linux_shadow_skuwa.h"
 #include "mos_solo_generic.h"
 #include "media_user_setting_specific.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+#include <string>
+#include <vector>
 
 typedef DeviceInfoFactory<struct GfxDeviceInfo> DeviceInfoFact;
 typedef DeviceInfoFactory<struct LinuxDeviceInit> DeviceInitFact;
@@ -85,54 +90,22 @@ MOS_STATUS HWInfo_GetGfxProductFamily(int32_t fd, PRODUCT_FAMILY &eProductFamily
 
 /*****************************************************************************\
 Description:
-    Get Sku/Wa tables and platform information according to input device FD
+    Probe system info and platform information from KMD
 
 Input:
-    fd         - file descriptor to the /dev/dri/cardX
+    pDrmBufMgr   - buffer manager of the device
+    devInfo      - device info of current device id
+    drvInfo      - driver info queried from KMD
 Output:
-    gfxPlatform  - describing current platform. is it mobile, desk,
-                   server? Sku/Wa must know.
-    skuTable     - describing SKU
-    waTable      - the constraints list
+    gfxPlatform  - describing current platform
     gtSystemInfo - describing current system information
-    userSettingPtr - shared pointer to user setting instance
 \*****************************************************************************/
-MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
-                          MOS_BUFMGR           *pDrmBufMgr,
-                          PLATFORM             *gfxPlatform,
-                          MEDIA_FEATURE_TABLE  *skuTable,
-                          MEDIA_WA_TABLE       *waTable,
-                          MEDIA_SYSTEM_INFO    *gtSystemInfo,
-                          MediaUserSettingSharedPtr userSettingPtr)
+static MOS_STATUS HWInfo_ProbeDeviceInfo(MOS_BUFMGR    *pDrmBufMgr,
+                          GfxDeviceInfo             *devInfo,
+                          LinuxDriverInfo           *drvInfo,
+                          PLATFORM                  *gfxPlatform,
+                          MEDIA_SYSTEM_INFO         *gtSystemInfo)
 {
-    if ((fd < 0) ||
-        (pDrmBufMgr == nullptr) ||
-        (gfxPlatform == nullptr) ||
-        (skuTable == nullptr) ||
-        (waTable == nullptr) ||
-        (gtSystemInfo == nullptr))
-    {
-        MOS_OS_ASSERTMESSAGE("Invalid parameter \n");
-        return MOS_STATUS_INVALID_PARAMETER;
-    }
-
-#if (_DEBUG || _RELEASE_INTERNAL)
-    MOS_USER_FEATURE_VALUE_DATA         UserFeatureData;
-#endif
-
-    LinuxDriverInfo drvInfo = {18, 3, 0, 23172, 3, 1, 0, 1, 0, 0, 1, 0, 0};
-    if (!Mos_Solo_IsEnabled(nullptr) && mos_get_driver_info(pDrmBufMgr, &drvInfo))
-    {
-        MOS_OS_ASSERTMESSAGE("Failed to get the chipset id\n");
-        return MOS_STATUS_INVALID_HANDLE;
-    }
-
-    GfxDeviceInfo *devInfo = getDeviceInfo(drvInfo.devId);
-    if (devInfo == nullptr)
-    {
-        MOS_OS_ASSERTMESSAGE("Failed to get the device info for Device id: %x\n", drvInfo.devId);
-        return MOS_STATUS_PLATFORM_NOT_SUPPORTED;
-    }
     /* Initialize Platform Info */
     gfxPlatform->ePlatformType      = (PLATFORM_TYPE)devInfo->platformType;
     gfxPlatform->eProductFamily     = (PRODUCT_FAMILY)devInfo->productFamily;
@@ -140,8 +113,8 @@ MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
     gfxPlatform->eDisplayCoreFamily = (GFXCORE_FAMILY)devInfo->displayFamily;
     gfxPlatform->eRenderCoreFamily  = (GFXCORE_FAMILY)devInfo->renderFamily;
     gfxPlatform->eGTType            = (GTTYPE)devInfo->eGTType;
-    gfxPlatform->usDeviceID         = drvInfo.devId;
-    gfxPlatform->usRevId            = drvInfo.devRev;
+    gfxPlatform->usDeviceID         = drvInfo->devId;
+    gfxPlatform->usRevId            = drvInfo->devRev;
 
     if (mos_query_device_blob(pDrmBufMgr, gtSystemInfo) == 0)
     {
@@ -153,9 +126,9 @@ MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
     else
     {
         MOS_OS_NORMALMESSAGE("Device blob query is not supported yet.\n");
-        gtSystemInfo->SliceCount        = drvInfo.sliceCount;
-        gtSystemInfo->SubSliceCount     = drvInfo.subSliceCount;
-        gtSystemInfo->EUCount           = drvInfo.euCount;
+        gtSystemInfo->SliceCount        = drvInfo->sliceCount;
+        gtSystemInfo->SubSliceCount     = drvInfo->subSliceCount;
+        gtSystemInfo->EUCount           = drvInfo->euCount;
 
         if (devInfo->InitMediaSysInfo &&
             devInfo->InitMediaSysInfo(devInfo, gtSystemInfo))
@@ -175,13 +148,50 @@ MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
         return MOS_STATUS_PLATFORM_NOT_SUPPORTED;
     }
 
+    return MOS_STATUS_SUCCESS;
+}
+
+/*****************************************************************************\
+Description:
+    Init Sku/Wa tables from device init factories. Sku/Wa init reads user
+    settings, so it runs on every device open, also when platform and system
+    info come from the device probe cache.
+
+Input:
+    pDrmBufMgr   - buffer manager of the device
+    devInfo      - device info of current device id
+    drvInfo      - driver info queried from KMD
+    userSettingPtr - shared pointer to user setting instance
+Output:
+    gfxPlatform  - describing current platform
+    skuTable     - describing SKU
+    waTable      - the constraints list
+\*****************************************************************************/
+MOS_STATUS HWInfo_InitSkuWa(MOS_BUFMGR           *pDrmBufMgr,
+                          GfxDeviceInfo             *devInfo,
+                          LinuxDriverInfo           *drvInfo,
+                          PLATFORM                  *gfxPlatform,
+                          MEDIA_FEATURE_TABLE       *skuTable,
+                          MEDIA_WA_TABLE            *waTable,
+                          MediaUserSettingSharedPtr userSettingPtr)
+{
+    if ((devInfo == nullptr) ||
+        (drvInfo == nullptr) ||
+        (gfxPlatform == nullptr) ||
+        (skuTable == nullptr) ||
+        (waTable == nullptr))
+    {
+        MOS_OS_ASSERTMESSAGE("Invalid parameter \n");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
     uint32_t platformKey = devInfo->productFamily;
     LinuxDeviceInit *devInit = getDeviceInit(platformKey);
 
     if (devInit && devInit->InitMediaFeature &&
         devInit->InitMediaWa &&
-        devInit->InitMediaFeature(devInfo, skuTable, &drvInfo, userSettingPtr) &&
-        devInit->InitMediaWa(devInfo, waTable, &drvInfo))
+        devInit->InitMediaFeature(devInfo, skuTable, drvInfo, userSettingPtr) &&
+        devInit->InitMediaWa(devInfo, waTable, drvInfo))
     {
 #ifdef _MEDIA_RESERVED
         MOS_OS_NORMALMESSAGE("Init Media SKU/WA info successfully\n");
@@ -232,11 +242,288 @@ MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
     /* The initializationof Ext SKU/WA is optional. So skip the check of return value */
     if (devExtInit && devExtInit->InitMediaFeature &&
         devExtInit->InitMediaWa &&
-        devExtInit->InitMediaFeature(devInfo, skuTable, &drvInfo, userSettingPtr) &&
-        devExtInit->InitMediaWa(devInfo, waTable, &drvInfo))
+        devExtInit->InitMediaFeature(devInfo, skuTable, drvInfo, userSettingPtr) &&
+        devExtInit->InitMediaWa(devInfo, waTable, drvInfo))
     {
         MOS_OS_NORMALMESSAGE("Init Media SystemInfo successfully\n");
     }
+    return MOS_STATUS_SUCCESS;
+}
+
+#define HWINFO_PROBE_CACHE_MAGIC    0x42505948  // "HYPB"
+#define HWINFO_PROBE_CACHE_VERSION  2
+
+//!
+//! \brief  Header of device probe cache file, all fields must match before the payload is used
+//!
+struct HWInfoProbeCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t devId;
+    uint32_t devRev;
+    uint32_t euCount;
+    uint32_t subSliceCount;
+    uint32_t sliceCount;
+    uint32_t drvFlags;
+    char     kernelRelease[sizeof(((struct utsname *)nullptr)->release)];
+    char     driverVersion[64];
+    uint32_t platformSize;
+    uint32_t systemInfoSize;
+    uint32_t payloadSize;
+    uint64_t payloadHash;
+};
+
+static uint32_t HWInfo_GetDriverInfoFlags(const LinuxDriverInfo &drvInfo)
+{
+    return (drvInfo.hasBsd << 0)   | (drvInfo.hasBsd2 << 1)         | (drvInfo.hasVebox << 2) |
+           (drvInfo.hasBltRing << 3) | (drvInfo.hasHuc << 4)        | (drvInfo.hasProtectedHuc << 5) |
+           (drvInfo.hasPpgtt << 6) | (drvInfo.hasPreemption << 7)   | (drvInfo.isServer << 8);
+}
+
+static uint64_t HWInfo_HashProbeCache(const uint8_t *data, size_t size)
+{
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static void HWInfo_InitProbeCacheHeader(const LinuxDriverInfo &drvInfo, HWInfoProbeCacheHeader &header)
+{
+    MOS_ZeroMemory(&header, sizeof(header));
+    header.magic          = HWINFO_PROBE_CACHE_MAGIC;
+    header.version        = HWINFO_PROBE_CACHE_VERSION;
+    header.devId          = drvInfo.devId;
+    header.devRev         = drvInfo.devRev;
+    header.euCount        = drvInfo.euCount;
+    header.subSliceCount  = drvInfo.subSliceCount;
+    header.sliceCount     = drvInfo.sliceCount;
+    header.drvFlags       = HWInfo_GetDriverInfoFlags(drvInfo);
+    header.platformSize   = sizeof(PLATFORM);
+    header.systemInfoSize = sizeof(MEDIA_SYSTEM_INFO);
+
+    struct utsname sysName = {};
+    if (uname(&sysName) == 0)
+    {
+        MosUtilities::MosSecureStrcpy(header.kernelRelease, sizeof(header.kernelRelease), sysName.release);
+    }
+    MosUtilities::MosSecureStrcpy(header.driverVersion, sizeof(header.driverVersion), MEDIA_VERSION " " MEDIA_VERSION_DETAILS);
+}
+
+static std::string HWInfo_GetProbeCacheFile(const LinuxDriverInfo &drvInfo, MediaUserSettingSharedPtr userSettingPtr)
+{
+    std::string cacheDir;
+    ReadUserSetting(
+        userSettingPtr,
+        cacheDir,
+        __MEDIA_USER_FEATURE_VALUE_DEVICE_PROBE_CACHE_PATH,
+        MediaUserSetting::Group::Device);
+    // String value read from registry may carry the terminating null
+    cacheDir = cacheDir.c_str();
+    if (cacheDir.empty())
+    {
+        return cacheDir;
+    }
+
+    char fileName[64] = {};
+    MosUtilities::MosSecureStringPrint(fileName, sizeof(fileName), sizeof(fileName), "/ihd_probe_%04x_%02x.bin", drvInfo.devId, drvInfo.devRev);
+    return cacheDir + fileName;
+}
+
+/*****************************************************************************\
+Description:
+    Load platform and system info from device probe cache. The cache is only
+    used when the header matches current KMD, kernel and driver version.
+
+Input:
+    fileName     - device probe cache file
+    drvInfo      - driver info queried from KMD
+Output:
+    gfxPlatform  - describing current platform
+    gtSystemInfo - describing current system information
+Return:
+    true if the cache is valid and loaded
+\*****************************************************************************/
+bool HWInfo_LoadProbeCache(const std::string    &fileName,
+                           const LinuxDriverInfo &drvInfo,
+                           PLATFORM              *gfxPlatform,
+                           MEDIA_SYSTEM_INFO     *gtSystemInfo)
+{
+    if (fileName.empty() || gfxPlatform == nullptr || gtSystemInfo == nullptr)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    HWInfoProbeCacheHeader expected = {};
+    HWInfoProbeCacheHeader header   = {};
+    HWInfo_InitProbeCacheHeader(drvInfo, expected);
+
+    bool                 valid   = false;
+    std::vector<uint8_t> payload;
+    if (fread(&header, sizeof(header), 1, file) == 1 &&
+        header.payloadSize == sizeof(PLATFORM) + sizeof(MEDIA_SYSTEM_INFO))
+    {
+        expected.payloadSize = header.payloadSize;
+        expected.payloadHash = header.payloadHash;
+        payload.resize(header.payloadSize);
+        valid = memcmp(&header, &expected, sizeof(header)) == 0 &&
+                fread(payload.data(), payload.size(), 1, file) == 1 &&
+                HWInfo_HashProbeCache(payload.data(), payload.size()) == header.payloadHash;
+    }
+    fclose(file);
+
+    if (!valid)
+    {
+        MOS_OS_NORMALMESSAGE("Device probe cache %s is out of date, reprobe device.", fileName.c_str());
+        return false;
+    }
+
+    MosUtilities::MosSecureMemcpy(gfxPlatform, sizeof(PLATFORM), payload.data(), sizeof(PLATFORM));
+    MosUtilities::MosSecureMemcpy(gtSystemInfo, sizeof(MEDIA_SYSTEM_INFO), payload.data() + sizeof(PLATFORM), sizeof(MEDIA_SYSTEM_INFO));
+    MOS_OS_NORMALMESSAGE("Device info loaded from probe cache %s.", fileName.c_str());
+    return true;
+}
+
+/*****************************************************************************\
+Description:
+    Store platform and system info into device probe cache. Sku/Wa tables are
+    not stored since they depend on user settings.
+
+Input:
+    fileName     - device probe cache file
+    drvInfo      - driver info queried from KMD
+    gfxPlatform  - describing current platform
+    gtSystemInfo - describing current system information
+Return:
+    true if the cache is written
+\*****************************************************************************/
+bool HWInfo_StoreProbeCache(const std::string    &fileName,
+                            const LinuxDriverInfo &drvInfo,
+                            const PLATFORM        *gfxPlatform,
+                            const MEDIA_SYSTEM_INFO *gtSystemInfo)
+{
+    if (fileName.empty() || gfxPlatform == nullptr || gtSystemInfo == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> payload;
+    payload.insert(payload.end(), (const uint8_t *)gfxPlatform, (const uint8_t *)gfxPlatform + sizeof(PLATFORM));
+    payload.insert(payload.end(), (const uint8_t *)gtSystemInfo, (const uint8_t *)gtSystemInfo + sizeof(MEDIA_SYSTEM_INFO));
+
+    HWInfoProbeCacheHeader header = {};
+    HWInfo_InitProbeCacheHeader(drvInfo, header);
+    header.payloadSize = (uint32_t)payload.size();
+    header.payloadHash = HWInfo_HashProbeCache(payload.data(), payload.size());
+
+    std::string tmpName = fileName + "." + std::to_string(getpid());
+    FILE *file = fopen(tmpName.c_str(), "wb");
+    if (file == nullptr)
+    {
+        MOS_OS_NORMALMESSAGE("Failed to create device probe cache %s.", tmpName.c_str());
+        return false;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(payload.data(), payload.size(), 1, file) == 1;
+    written = (fclose(file) == 0) && written;
+
+    if (!written || rename(tmpName.c_str(), fileName.c_str()) != 0)
+    {
+        MOS_OS_NORMALMESSAGE("Failed to store device probe cache %s.", fileName.c_str());
+        remove(tmpName.c_str());
+        return false;
+    }
+    return true;
+}
+
+/*****************************************************************************\
+Description:
+    Get Sku/Wa tables and platform information according to input device FD
+
+Input:
+    fd         - file descriptor to the /dev/dri/cardX
+Output:
+    gfxPlatform  - describing current platform. is it mobile, desk,
+                   server? Sku/Wa must know.
+    skuTable     - describing SKU
+    waTable      - the constraints list
+    gtSystemInfo - describing current system information
+    userSettingPtr - shared pointer to user setting instance
+\*****************************************************************************/
+MOS_STATUS HWInfo_GetGfxInfo(int32_t           fd,
+                          MOS_BUFMGR           *pDrmBufMgr,
+                          PLATFORM             *gfxPlatform,
+                          MEDIA_FEATURE_TABLE  *skuTable,
+                          MEDIA_WA_TABLE       *waTable,
+                          MEDIA_SYSTEM_INFO    *gtSystemInfo,
+                          MediaUserSettingSharedPtr userSettingPtr)
+{
+    if ((fd < 0) ||
+        (pDrmBufMgr == nullptr) ||
+        (gfxPlatform == nullptr) ||
+        (skuTable == nullptr) ||
+        (waTable == nullptr) ||
+        (gtSystemInfo == nullptr))
+    {
+        MOS_OS_ASSERTMESSAGE("Invalid parameter \n");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+    MOS_USER_FEATURE_VALUE_DATA         UserFeatureData;
+#endif
+
+    LinuxDriverInfo drvInfo = {18, 3, 0, 23172, 3, 1, 0, 1, 0, 0, 1, 0, 0};
+    if (!Mos_Solo_IsEnabled(nullptr) && mos_get_driver_info(pDrmBufMgr, &drvInfo))
+    {
+        MOS_OS_ASSERTMESSAGE("Failed to get the chipset id\n");
+        return MOS_STATUS_INVALID_HANDLE;
+    }
+
+    GfxDeviceInfo *devInfo = getDeviceInfo(drvInfo.devId);
+    if (devInfo == nullptr)
+    {
+        MOS_OS_ASSERTMESSAGE("Failed to get the device info for Device id: %x\n", drvInfo.devId);
+        return MOS_STATUS_PLATFORM_NOT_SUPPORTED;
+    }
+
+    // Only KMD queries are cached, Sku/Wa init depends on user settings and always runs.
+    std::string cacheFile = HWInfo_GetProbeCacheFile(drvInfo, userSettingPtr);
+    bool        cached    = HWInfo_LoadProbeCache(cacheFile, drvInfo, gfxPlatform, gtSystemInfo);
+    MOS_STATUS  eStatus   = MOS_STATUS_SUCCESS;
+    if (!cached)
+    {
+        eStatus = HWInfo_ProbeDeviceInfo(pDrmBufMgr, devInfo, &drvInfo, gfxPlatform, gtSystemInfo);
+        if (eStatus != MOS_STATUS_SUCCESS)
+        {
+            return eStatus;
+        }
+    }
+
+    eStatus = HWInfo_InitSkuWa(pDrmBufMgr, devInfo, &drvInfo, gfxPlatform, skuTable, waTable, userSettingPtr);
+    if (eStatus != MOS_STATUS_SUCCESS)
+    {
+        return eStatus;
+    }
+
+    // Stored after Sku/Wa init, which completes the IP versions of platform
+    if (!cached)
+    {
+        HWInfo_StoreProbeCache(cacheFile, drvInfo, gfxPlatform, gtSystemInfo);
+    }
+
     if (drvInfo.isServer)
     {
         mos_set_platform_information(pDrmBufMgr, PLATFORM_INFORMATION_IS_SERVER);
@@ -30,6 +30,8 @@
 #include "mos_bufmgr_api.h"
 #include "linux_shadow_skuwa.h"
 #include "igfxfmid.h"
+#include "linux_system_info.h"
+#include <string>
 //------------------------------------------------------------------------------
 //| Definitions specific to Linux
 //------------------------------------------------------------------------------
@@ -56,6 +58,24 @@ extern MOS_STATUS HWInfo_GetGfxInfo(int32_t    fd,
                           MEDIA_SYSTEM_INFO    *gtSystemInfo,
                           MediaUserSettingSharedPtr userSettingPtr);
 
+extern MOS_STATUS HWInfo_InitSkuWa(MOS_BUFMGR *pDrmBufMgr,
+                          GfxDeviceInfo        *devInfo,
+                          LinuxDriverInfo      *drvInfo,
+                          PLATFORM             *gfxPlatform,
+                          MEDIA_FEATURE_TABLE  *skuTable,
+                          MEDIA_WA_TABLE       *waTable,
+                          MediaUserSettingSharedPtr userSettingPtr);
+
+extern bool HWInfo_LoadProbeCache(const std::string &fileName,
+                          const LinuxDriverInfo &drvInfo,
+                          PLATFORM             *gfxPlatform,
+                          MEDIA_SYSTEM_INFO    *gtSystemInfo);
+
+extern bool HWInfo_StoreProbeCache(const std::string &fileName,
+                          const LinuxDriverInfo   &drvInfo,
+                          const PLATFORM          *gfxPlatform,
+                          const MEDIA_SYSTEM_INFO *gtSystemInfo);
+
 extern MOS_STATUS HWInfo_GetGmmInfo(MOS_BUFMGR        *pDrmBufMgr,
                           SHADOW_MEDIA_FEATURE_TABLE  *shadowSkuTable,
                           SHADOW_MEDIA_WA_TABLE       *shadowWaTable,
@@ -226,6 +226,20 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
             MediaUserSetting::Group::Device);
 #endif
 
+        ReadUserSetting(
+            userSettingPtr,
+            m_lockStallProfilerEnabled,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_LOCK_STALL_PROFILER,
+            MediaUserSetting::Group::Device);
+        if (m_lockStallProfilerEnabled)
+        {
+            ReadUserSetting(
+                userSettingPtr,
+                m_lockStallOutputFileName,
+                __MEDIA_USER_FEATURE_VALUE_LOCK_STALL_PROFILER_OUTPUT_FILE_NAME,
+                MediaUserSetting::Group::Device);
+        }
+
         m_useSwSwizzling = osDriverContext->bSimIsActive || MEDIA_IS_SKU(&m_skuTable, FtrUseSwSwizzling);
 
         m_tileYFlag      = MEDIA_IS_SKU(&m_skuTable, FtrTileY);
@@ -299,6 +313,8 @@ void OsContextSpecificNext::Destroy()
 
     if (GetOsContextValid() == true)
     {
+        ReportLockStall();
+
         if (m_auxTableMgr != nullptr)
         {
             MOS_Delete(m_auxTableMgr);
@@ -332,3 +348,66 @@ void OsContextSpecificNext::Destroy()
 
 }
 
+
+void OsContextSpecificNext::RecordLockStall(const std::string &resName, bool writeRequest, bool busy, double waitUs)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lockStallMutex);
+
+        LockStallStat &stat = m_lockStallStats[resName + (writeRequest ? " (W)" : " (R)")];
+        stat.lockCount++;
+        stat.totalWaitUs += waitUs;
+        stat.maxWaitUs   = waitUs > stat.maxWaitUs ? waitUs : stat.maxWaitUs;
+        if (busy)
+        {
+            stat.busyCount++;
+        }
+    }
+
+    if (busy)
+    {
+        struct
+        {
+            uint32_t writeRequest;
+            uint32_t waitUs;
+        } eventData = {writeRequest ? 1u : 0u, (uint32_t)waitUs};
+        MOS_TraceEventExt(EVENT_RESOURCE_LOCK_STALL, EVENT_TYPE_INFO,
+            &eventData, sizeof(eventData), resName.c_str(), resName.size() + 1);
+    }
+}
+
+void OsContextSpecificNext::ReportLockStall()
+{
+    if (!m_lockStallProfilerEnabled)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lockStallMutex);
+
+    // Written to file, since the messages are compiled out of release driver
+    char        line[MOS_MAX_PATH_LENGTH + 1];
+    std::string report;
+
+    MOS_SecureStringPrint(line, sizeof(line), sizeof(line), "Lock stall report: %d resource(s) mapped by CPU.\n",
+        (int32_t)m_lockStallStats.size());
+    report += line;
+    for (auto &item : m_lockStallStats)
+    {
+        const LockStallStat &stat = item.second;
+        MOS_SecureStringPrint(line, sizeof(line), sizeof(line), "  %s: locks %d, busy %d, total wait %.1f us, max wait %.1f us.\n",
+            item.first.c_str(), stat.lockCount, stat.busyCount, stat.totalWaitUs, stat.maxWaitUs);
+        report += line;
+    }
+    MOS_OS_NORMALMESSAGE("%s", report.c_str());
+
+    if (!m_lockStallOutputFileName.empty())
+    {
+        std::string fileName = m_lockStallOutputFileName + "-pid" + std::to_string(MosUtilities::MosGetPid()) + ".txt";
+        if (MosUtilities::MosWriteFileFromPtr(fileName.c_str(), (void *)report.c_str(), (uint32_t)report.size()) != MOS_STATUS_SUCCESS)
+        {
+            MOS_OS_ASSERTMESSAGE("Failed to write lock stall report to %s.", fileName.c_str());
+        }
+    }
+    m_lockStallStats.clear();
+}
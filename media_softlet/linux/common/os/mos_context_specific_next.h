@@ -27,6 +27,9 @@
 #ifndef __MOS_CONTEXT_SPECIFIC_NEXT_H__
 #define __MOS_CONTEXT_SPECIFIC_NEXT_H__
 
+#include <map>
+#include <mutex>
+#include <string>
 #include "mos_context_next.h"
 #include "mos_auxtable_mgr.h"
 
@@ -110,6 +113,42 @@ public:
         return m_deviceType;
     }
 
+    //!
+    //! \brief  Lock stall statistics of resources with same name
+    //!
+    struct LockStallStat
+    {
+        uint32_t lockCount   = 0;   //!< Number of CPU mappings
+        uint32_t busyCount   = 0;   //!< Number of mappings while BO was busy on GPU
+        double   totalWaitUs = 0;   //!< Total time spent in mapping
+        double   maxWaitUs   = 0;   //!< Max time spent in one mapping
+    };
+
+    //!
+    //! \brief  Return whether lock stall profiler is enabled
+    //!
+    bool IsLockStallProfilerEnabled() { return m_lockStallProfilerEnabled; }
+
+    //!
+    //! \brief  Record one CPU mapping of resource for lock stall profiler
+    //! \details Busy mappings also emit EVENT_RESOURCE_LOCK_STALL.
+    //! \param  [in] resName
+    //!         Resource name given at allocation, or VA surface/buffer description for DDI mappings
+    //! \param  [in] writeRequest
+    //!         Whether the lock is for write
+    //! \param  [in] busy
+    //!         Whether the BO was busy on GPU before mapping
+    //! \param  [in] waitUs
+    //!         Time spent in mapping in us
+    //!
+    void RecordLockStall(const std::string &resName, bool writeRequest, bool busy, double waitUs);
+
+    //!
+    //! \brief  Print lock stall report of current device and write it to the
+    //!         "Lock Stall Profiler Output File Name" file, also in release driver
+    //!
+    void ReportLockStall();
+
 private:
     //!
     //! \brief  Performance specific switch for debug purpose
@@ -147,6 +186,14 @@ private:
     int                 m_deviceType   = DEVICE_TYPE_COUNT;
     AuxTableMgr         *m_auxTableMgr = nullptr;
     PERF_DATA           *m_perfData =   nullptr;
+
+    //!
+    //! \brief  Lock stall profiler, keyed by resource name and lock type
+    //!
+    bool                                 m_lockStallProfilerEnabled = false;
+    std::string                          m_lockStallOutputFileName;
+    std::map<std::string, LockStallStat> m_lockStallStats;
+    std::mutex                           m_lockStallMutex;
 MEDIA_CLASS_DEFINE_END(OsContextSpecificNext)
 };
 #endif // #ifndef __MOS_CONTEXT_SPECIFIC_NEXT_H__
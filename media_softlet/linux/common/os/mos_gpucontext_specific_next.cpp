@@ -686,6 +686,8 @@ void GpuContextSpecificNext::Clear()
     }
 
     m_cmdBufPool.clear();
+    m_inFlightHead  = 0;
+    m_inFlightCount = 0;
 
     MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
     MosUtilities::MosDestroyMutex(m_cmdBufPoolMutex);
@@ -855,6 +857,7 @@ MOS_STATUS GpuContextSpecificNext::GetCommandBuffer(
                 return MOS_STATUS_NULL_POINTER;
             }
             cmdBufSpecificOld->waitReady();
+            RemoveInFlightCmdBuffer(cmdBufOld);
             cmdBufSpecificOld->UnBindToGpuContext();
             m_cmdBufMgr->ReleaseCmdBuf(cmdBufOld);  // here just return old command buffer to available pool
 
@@ -1025,6 +1028,70 @@ MOS_STATUS GpuContextSpecificNext::SetIndirectStateSize(const uint32_t size)
     }
 }
 
+uint32_t GpuContextSpecificNext::GetBusyCmdBufferCount()
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    if (m_cmdBufPoolMutex == nullptr)
+    {
+        return 0;
+    }
+
+    MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
+    // GPU completes command buffers of one context in order, stop at the first busy one.
+    while (m_inFlightCount > 0)
+    {
+        auto cmdBufSpecific = static_cast<CommandBufferSpecificNext *>(m_inFlightCmdBufs[m_inFlightHead]);
+        if (cmdBufSpecific && cmdBufSpecific->isBusy())
+        {
+            break;
+        }
+        m_inFlightCmdBufs[m_inFlightHead] = nullptr;
+        m_inFlightHead = (m_inFlightHead + 1) % MAX_CMD_BUF_NUM;
+        m_inFlightCount--;
+    }
+    uint32_t busyCount = m_inFlightCount;
+    MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
+
+    return busyCount;
+}
+
+void GpuContextSpecificNext::AddInFlightCmdBuffer(CommandBufferNext *cmdBuf)
+{
+    if (cmdBuf == nullptr)
+    {
+        return;
+    }
+
+    if (m_inFlightCount == MAX_CMD_BUF_NUM)
+    {
+        // Pool has no more command buffers than the ring, the oldest one must be reused already.
+        m_inFlightHead = (m_inFlightHead + 1) % MAX_CMD_BUF_NUM;
+        m_inFlightCount--;
+    }
+    m_inFlightCmdBufs[(m_inFlightHead + m_inFlightCount) % MAX_CMD_BUF_NUM] = cmdBuf;
+    m_inFlightCount++;
+}
+
+void GpuContextSpecificNext::RemoveInFlightCmdBuffer(CommandBufferNext *cmdBuf)
+{
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < m_inFlightCount; i++)
+    {
+        CommandBufferNext *entry = m_inFlightCmdBufs[(m_inFlightHead + i) % MAX_CMD_BUF_NUM];
+        if (entry != cmdBuf)
+        {
+            m_inFlightCmdBufs[(m_inFlightHead + kept) % MAX_CMD_BUF_NUM] = entry;
+            kept++;
+        }
+    }
+    for (uint32_t i = kept; i < m_inFlightCount; i++)
+    {
+        m_inFlightCmdBufs[(m_inFlightHead + i) % MAX_CMD_BUF_NUM] = nullptr;
+    }
+    m_inFlightCount = kept;
+}
+
 MOS_STATUS GpuContextSpecificNext::GetIndirectState(
     uint32_t &offset,
     uint32_t &size)
@@ -1607,6 +1674,15 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         {
             eStatus = MOS_STATUS_UNKNOWN;
         }
+        else if (cmdBuffer->iCmdIndex >= 0)
+        {
+            MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
+            if ((uint32_t)cmdBuffer->iCmdIndex < m_cmdBufPool.size())
+            {
+                AddInFlightCmdBuffer(m_cmdBufPool[cmdBuffer->iCmdIndex]);
+            }
+            MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
+        }
     }
 
     if (eStatus != MOS_STATUS_SUCCESS)
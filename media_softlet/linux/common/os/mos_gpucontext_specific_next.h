@@ -133,6 +133,17 @@ public:
 
     MOS_STATUS SetIndirectStateSize(const uint32_t size);
 
+    //!
+    //! \brief    Get busy command buffer count
+    //! \details  Get number of command buffers submitted to this gpu context and not
+    //!           completed by GPU yet, i.e. the queue depth of this gpu context.
+    //!           Command buffers are retired in submission order, so only the oldest
+    //!           in-flight ones are checked for busy.
+    //! \return   uint32_t
+    //!           Number of busy command buffers
+    //!
+    uint32_t GetBusyCmdBufferCount();
+
     //!
     //! \brief    Set patch entry
     //! \details  Sets the patch entry in patch list
@@ -331,6 +342,26 @@ protected:
 
     void UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuffer, PMOS_CONTEXT mosContext);
 
+    //!
+    //! \brief    Track submitted command buffer
+    //! \details  Append command buffer to the in-flight ring, m_cmdBufPoolMutex should be held
+    //! \param    [in] cmdBuf
+    //!           Command buffer submitted to GPU
+    //! \return   void
+    //!
+    void AddInFlightCmdBuffer(CommandBufferNext *cmdBuf);
+
+    //!
+    //! \brief    Retire command buffer
+    //! \details  Remove command buffer from the in-flight ring when it is known to be
+    //!           completed, e.g. before it is returned to command buffer manager.
+    //!           m_cmdBufPoolMutex should be held
+    //! \param    [in] cmdBuf
+    //!           Completed command buffer
+    //! \return   void
+    //!
+    void RemoveInFlightCmdBuffer(CommandBufferNext *cmdBuf);
+
 protected:
     //! \brief    internal command buffer pool per gpu context
     std::vector<CommandBufferNext *> m_cmdBufPool;
@@ -341,6 +372,16 @@ protected:
     //! \brief    next fetch index of m_cmdBufPool
     uint32_t m_nextFetchIndex = 0;
 
+    //! \brief    submitted and not retired command buffers in submission order,
+    //!           ring buffer protected by m_cmdBufPoolMutex
+    CommandBufferNext *m_inFlightCmdBufs[MAX_CMD_BUF_NUM] = {};
+
+    //! \brief    index of the oldest in-flight command buffer in m_inFlightCmdBufs
+    uint32_t m_inFlightHead = 0;
+
+    //! \brief    number of in-flight command buffers in m_inFlightCmdBufs
+    uint32_t m_inFlightCount = 0;
+
     //! \brief    initialized comamnd buffer size
     uint32_t m_commandBufferSize = 0;
 
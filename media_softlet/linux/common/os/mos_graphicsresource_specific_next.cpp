@@ -483,6 +483,11 @@ void* GraphicsResourceSpecificNext::Lock(OsContextNext* osContextPtr, LockParams
 
         if(false == m_mapped)
         {
+            // Mapping a BO which is still referenced by GPU waits for GPU idle.
+            bool   lockStallProfiled = pOsContextSpecific->IsLockStallProfilerEnabled();
+            bool   boBusy            = lockStallProfiled ? (mos_bo_busy(boPtr) != 0) : false;
+            double lockStartTime     = lockStallProfiled ? MosUtilities::MosGetTime() : 0;
+
             if (pOsContextSpecific->IsAtomSoc())
             {
                 mos_bo_map_gtt(boPtr);
@@ -530,6 +535,12 @@ void* GraphicsResourceSpecificNext::Lock(OsContextNext* osContextPtr, LockParams
             }
             m_mapped = true;
             m_pData  = m_systemShadow ? m_systemShadow : (uint8_t *)boPtr->virt;
+
+            if (lockStallProfiled)
+            {
+                double waitUs = MosUtilities::MosGetTime() - lockStartTime;
+                pOsContextSpecific->RecordLockStall(m_name, params.m_writeRequest, boBusy, waitUs);
+            }
         }
 
         dataPtr = m_pData;
@@ -2617,6 +2617,26 @@ uint32_t MosInterface::GetGpuStatusTag(
     return 0;
 }
 
+uint32_t MosInterface::GetGpuBusyCmdBufferCount(
+    MOS_STREAM_HANDLE  streamState,
+    GPU_CONTEXT_HANDLE gpuContext)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    if (streamState == nullptr || gpuContext == MOS_GPU_CONTEXT_INVALID_HANDLE)
+    {
+        return 0;
+    }
+
+    auto gpuContextIns = MosInterface::GetGpuContext(streamState, gpuContext);
+    if (gpuContextIns == nullptr)
+    {
+        return 0;
+    }
+
+    return gpuContextIns->GetBusyCmdBufferCount();
+}
+
 MOS_STATUS MosInterface::IncrementGpuStatusTag(
     MOS_STREAM_HANDLE  streamState,
     GPU_CONTEXT_HANDLE gpuContext)
@@ -3257,6 +3277,18 @@ uint64_t MosInterface::GetResourceHandle(MOS_STREAM_HANDLE streamState, PMOS_RES
     }
 }
 
+bool MosInterface::IsResourceBusy(MOS_STREAM_HANDLE streamState, PMOS_RESOURCE osResource)
+{
+    if (osResource && osResource->bo)
+    {
+        return mos_bo_busy(osResource->bo) != 0;
+    }
+    else
+    {
+        return false;
+    }
+}
+
 MediaUserSettingSharedPtr MosInterface::MosGetUserSettingInstance(
     PMOS_CONTEXT osContext)
 {
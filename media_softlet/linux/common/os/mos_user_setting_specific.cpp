@@ -52,5 +52,28 @@ MOS_STATUS MosUserSetting::InitMosUserSettingSpecific(MediaUserSettingSharedPtr
         0,
         true); //"Enable VM Bind."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_LOCK_STALL_PROFILER,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Enable profiling of CPU locks on GPU busy resources."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_LOCK_STALL_PROFILER_OUTPUT_FILE_NAME,
+        MediaUserSetting::Group::Device,
+        "Lock_Stall_Report",
+        true,
+        true,
+        USER_SETTING_CONFIG_PERF_PATH); //"Lock stall report file name, pid and .txt appended."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_DEVICE_PROBE_CACHE_PATH,
+        MediaUserSetting::Group::Device,
+        std::string(),
+        false); //"Directory of device probe cache, empty to disable."
+
     return MOS_STATUS_SUCCESS;
 }
@@ -2226,6 +2226,10 @@ MOS_STATUS MosUtilities::MosLockMutex(PMOS_MUTEX pMutex)
     {
         eStatus = MOS_STATUS_UNKNOWN;
     }
+    else if (m_mosPerfCounterEnabled)
+    {
+        MosAtomicIncrement(&m_mosMutexLockCounter);
+    }
 
     return eStatus;
 }
@@ -578,23 +578,18 @@ VAStatus DdiVpFunctions::CreateConfig (
     status = mediaCtx->m_capsNext->CreateConfig(profile, entrypoint, attribList, attribsNum, configId);
     DDI_CHK_RET(status, "Create common config failed");
 
-    auto configList = mediaCtx->m_capsNext->GetConfigList();
-    DDI_VP_CHK_NULL(configList, "Get configList failed", VA_STATUS_ERROR_INVALID_PARAMETER);
-
-    for(int i = 0; i < configList->size(); i++)
+    auto configRange = mediaCtx->m_capsNext->GetConfigRange(profile, entrypoint);
+    if(configRange != nullptr && configRange->count > 0)
     {
-        if((configList->at(i).profile == profile) && (configList->at(i).entrypoint == entrypoint))
+        uint32_t curConfigID = ADD_CONFIG_ID_VP_OFFSET(configRange->base);
+        if(!mediaCtx->m_capsNext->m_capsTable->IsVpConfigId(curConfigID))
         {
-            uint32_t curConfigID = ADD_CONFIG_ID_VP_OFFSET(i);
-            if(!mediaCtx->m_capsNext->m_capsTable->IsVpConfigId(curConfigID))
-            {
-                 DDI_VP_ASSERTMESSAGE("DDI: Invalid configID.");
-                 return VA_STATUS_ERROR_INVALID_CONFIG;
-            }
-
-            *configId = curConfigID;
-            return VA_STATUS_SUCCESS;
+             DDI_VP_ASSERTMESSAGE("DDI: Invalid configID.");
+             return VA_STATUS_ERROR_INVALID_CONFIG;
         }
+
+        *configId = curConfigID;
+        return VA_STATUS_SUCCESS;
     }
 
     return VA_STATUS_ERROR_ATTR_NOT_SUPPORTED;